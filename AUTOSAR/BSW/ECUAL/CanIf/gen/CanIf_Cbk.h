@@ -0,0 +1,179 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	CanIf_Cbk.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : CanIf callback notifications header file.						 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_CANInterface, AUTOSAR Release 4.3.1			 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef CANIF_CBK_H
+#define CANIF_CBK_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "CanIf_Types.h"
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/**********************************************************************************
+**	Service name: CanIf_TxConfirmation                        					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_TxConfirmation	    		 **
+**				  (																 **
+**					PduIdType CanTxPduId                                         **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver after the L-PDU CanTxPduId has 	 **
+**				  been transmitted, the freed hardware object is refilled from   **
+**				  the Tx buffer of its HTH.                                      **
+**                                                        						 **
+**	Service ID:   0x13                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): CanTxPduId - L-PDU handle of the transmitted L-PDU.  		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_TxConfirmation
+(
+	PduIdType CanTxPduId
+);
+
+/**********************************************************************************
+**	Service name: CanIf_RxIndication                          					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_RxIndication	    		 	 **
+**				  (																 **
+**					const Can_HwType* Mailbox,                                   **
+**					const PduInfoType* PduInfoPtr                                **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver after a frame was received, the 	 **
+**				  HRH and CAN ID of the frame are resolved to the Rx L-PDU and   **
+**				  the upper layer is notified.                                   **
+**                                                        						 **
+**	Service ID:   0x14                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): Mailbox    - CAN ID, HOH and controller of the frame. 		 **
+**				     PduInfoPtr - Length and data of the received L-SDU. 		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_RxIndication
+(
+	const Can_HwType* Mailbox,
+	const PduInfoType* PduInfoPtr
+);
+
+/**********************************************************************************
+**	Service name: CanIf_ControllerBusOff                      					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_ControllerBusOff	    		 **
+**				  (																 **
+**					uint8 ControllerId                                           **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver when the controller went bus-off,	 **
+**				  the controller is stopped, its Tx buffers are flushed or		 **
+**				  retained per CanIfCtrlBusOffTxBuffers and the recovery		 **
+**				  schedule of CanIf_MainFunctionBusOff() starts.				 **
+**                                                        						 **
+**	Service ID:   0x16                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller in bus-off.		  		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_ControllerBusOff
+(
+	uint8 ControllerId
+);
+
+/**********************************************************************************
+**	Service name: CanIf_ControllerModeIndication              					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_ControllerModeIndication	 	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**					Can_ControllerStateType ControllerMode                       **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver when the controller reached the	 **
+**				  mode requested by Can_SetControllerMode(). STARTED sends the	 **
+**				  retained Tx L-PDUs, a requested STOPPED or SLEEP flushes the	 **
+**				  Tx buffers of the controller.									 **
+**                                                        						 **
+**	Service ID:   0x17                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId   - CAN controller.		  		 			 **
+**				     ControllerMode - Mode the controller reached.		 		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_ControllerModeIndication
+(
+	uint8 ControllerId,
+	Can_ControllerStateType ControllerMode
+);
+
+#endif /* CANIF_CBK_H */
@@ -0,0 +1,281 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	CanIf_Cfg.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2021-4-8													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : CanIf link time configuration file							 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_CANInterface, AUTOSAR Release 4.3.1			 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No													 **
+**                                                       					     **
+***********************************************************************************/
+
+/* Generated by tools/CfgGen/CfgGen.py from Ecu.json, changes are lost on the next generation */
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "CanIf.h"
+#include "PduR_CanIf.h"
+
+/*****************************************************************/
+/*				        Configuration Objects      		         */
+/*****************************************************************/
+
+/* Tx L-PDUs in Tx PDU ID order, the current CAN ID of a dynamic L-PDU is kept in RAM by CanIf */
+const CanIfTxPduCfgType CanIfTxPduCfg[TX_CAN_L_PDU_NUM] =
+{
+	/* ENGINE_CMD */
+	{
+		0x100UL,
+		0,
+		0,
+		8,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		8,
+		FALSE,
+		CANIF_TXPDU_STATIC,
+		TRUE,
+		CANIF_INVALID_DYNAMIC_ID,
+		PduR_CanIfTxConfirmation
+	},
+	/* BRAKE_CMD */
+	{
+		0x120UL,
+		1,
+		0,
+		8,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		4,
+		FALSE,
+		CANIF_TXPDU_STATIC,
+		TRUE,
+		CANIF_INVALID_DYNAMIC_ID,
+		PduR_CanIfTxConfirmation
+	},
+	/* NODE_STATUS */
+	{
+		0x300UL,
+		2,
+		0,
+		8,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		2,
+		TRUE,
+		CANIF_TXPDU_DYNAMIC,
+		FALSE,
+		0,
+		PduR_CanIfTxConfirmation
+	},
+	/* DIAG_RESP */
+	{
+		0x7E8UL,
+		3,
+		1,
+		9,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		8,
+		FALSE,
+		CANIF_TXPDU_STATIC,
+		FALSE,
+		CANIF_INVALID_DYNAMIC_ID,
+		PduR_CanIfTxConfirmation
+	}
+};
+
+/* Rx L-PDUs in Rx PDU ID order */
+const CanIfRxPduCfgType CanIfRxPduCfg[RX_CAN_L_PDU_NUM] =
+{
+	/* VEHICLE_CFG */
+	{
+		(0x18FEF100UL | CAN_ID_TYPE_EXTENDED),
+		0,
+		0,
+		8,
+		FALSE,
+		FALSE,
+		0,
+		PduR_CanIfRxIndication
+	},
+	/* WHEEL_SPEED */
+	{
+		0x210UL,
+		1,
+		0,
+		8,
+		TRUE,
+		TRUE,
+		0,
+		NULL_PTR
+	},
+	/* ENGINE_STATUS */
+	{
+		0x200UL,
+		2,
+		0,
+		8,
+		TRUE,
+		TRUE,
+		8,
+		PduR_CanIfRxIndication
+	},
+	/* DIAG_REQ_PHYS */
+	{
+		0x7E0UL,
+		3,
+		1,
+		8,
+		FALSE,
+		FALSE,
+		0,
+		PduR_CanIfRxIndication
+	},
+	/* DIAG_REQ_FUNC */
+	{
+		0x7DFUL,
+		4,
+		1,
+		8,
+		FALSE,
+		FALSE,
+		0,
+		PduR_CanIfRxIndication
+	},
+	/* BODY_NODES */
+	{
+		0x400UL,
+		5,
+		0,
+		8,
+		FALSE,
+		FALSE,
+		0,
+		PduR_CanIfRxIndication
+	},
+	/* CRUISE_CTRL_ANY */
+	{
+		(0x18FEF100UL | CAN_ID_TYPE_EXTENDED),
+		6,
+		0,
+		8,
+		FALSE,
+		FALSE,
+		0,
+		PduR_CanIfRxIndication
+	}
+};
+
+/* 
+   Rx CAN ID table, the disjoint [Lower, Upper] entries of an HRH follow each other
+   sorted by CAN ID so a received frame is resolved to its L-PDU with a binary search
+*/
+const CanIfRxIdEntryType CanIfRxId[CANIF_NUM_OF_RX_IDS] =
+{
+	/* HRH_VEHICLE */
+	{ 0x200UL, 0x200UL, CanIfConf_CanIfRxPduCfg_ENGINE_STATUS },
+	{ 0x210UL, 0x210UL, CanIfConf_CanIfRxPduCfg_WHEEL_SPEED },
+	{ 0x400UL, 0x40FUL, CanIfConf_CanIfRxPduCfg_BODY_NODES },
+	{ (0x18FEF100UL | CAN_ID_TYPE_EXTENDED), (0x18FEF100UL | CAN_ID_TYPE_EXTENDED), CanIfConf_CanIfRxPduCfg_VEHICLE_CFG },
+	{ (0x18FEF101UL | CAN_ID_TYPE_EXTENDED), (0x18FEF1FFUL | CAN_ID_TYPE_EXTENDED), CanIfConf_CanIfRxPduCfg_CRUISE_CTRL_ANY },
+	/* HRH_DIAG */
+	{ 0x7DFUL, 0x7DFUL, CanIfConf_CanIfRxPduCfg_DIAG_REQ_FUNC },
+	{ 0x7E0UL, 0x7E0UL, CanIfConf_CanIfRxPduCfg_DIAG_REQ_PHYS }
+};
+
+/* Hardware transmit handles */
+const CanIfHthCfgType CanIfHthCfg[CANIF_NUM_OF_HTHS] =
+{
+	/* HTH_CONTROL */
+	{
+		8,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		0,
+		3
+	},
+	/* HTH_DIAG */
+	{
+		9,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		3,
+		1
+	}
+};
+
+/* Hardware receive handles and their runs of the Rx CAN ID table */
+const CanIfHrhCfgType CanIfHrhCfg[CANIF_NUM_OF_HRHS] =
+{
+	/* HRH_VEHICLE */
+	{
+		0,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		0,
+		5
+	},
+	/* HRH_DIAG */
+	{
+		1,
+		CanIfConf_CanIfCtrlCfg_CAN0,
+		5,
+		2
+	}
+};
+
+/* HRH index of every hardware object of the CAN driver, resolves CanIf_RxIndication() in constant time */
+const uint16 CanIfHohToHrh[CANIF_NUM_OF_HOHS] =
+{
+	/* 0 */	0u,
+	/* 1 */	1u,
+	/* 2 */	CANIF_INVALID_HRH,
+	/* 3 */	CANIF_INVALID_HRH,
+	/* 4 */	CANIF_INVALID_HRH,
+	/* 5 */	CANIF_INVALID_HRH,
+	/* 6 */	CANIF_INVALID_HRH,
+	/* 7 */	CANIF_INVALID_HRH,
+	/* 8 */	CANIF_INVALID_HRH,
+	/* 9 */	CANIF_INVALID_HRH
+};
+
+/* CAN controllers in controller ID order */
+const CanIfCtrlCfgType CanIfCtrlCfg[CANIF_NUM_OF_CONTROLLERS] =
+{
+	/* CAN0 */
+	{
+		CANIF_BUSOFF_RETAIN_TX_BUFFERS,
+		5,
+		2,
+		200,
+		NULL_PTR,
+		NULL_PTR
+	}
+};
+
+const CanIfInitCfgType CanIfInitCfg =
+{
+	CanIfTxPduCfg,
+	CanIfRxPduCfg,
+	CanIfRxId,
+	CanIfHthCfg,
+	CanIfHrhCfg,
+	CanIfHohToHrh,
+	CanIfCtrlCfg
+};
+
+const CanIf_ConfigType CanIf_Config =
+{
+	&CanIfInitCfg
+};
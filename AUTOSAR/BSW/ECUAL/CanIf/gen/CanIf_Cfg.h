@@ -0,0 +1,139 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	CanIf_Cfg.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2021-4-8													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : CanIf pre-compile configuration file							 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_CANInterface, AUTOSAR Release 4.3.1			 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No													 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef CANIF_CFG_H
+#define CANIF_CFG_H
+
+/* Generated by tools/CfgGen/CfgGen.py from Ecu.json, changes are lost on the next generation */
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/* Development error detection and notification */
+#define CANIF_DEV_ERROR_DETECT						STD_ON
+
+/* Adds / removes the service CanIf_ReadTxNotifStatus() from the code */
+#define CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API	STD_ON
+
+/* Adds / removes the service CanIf_ReadRxNotifStatus() from the code */
+#define CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API	STD_ON
+
+/* Adds / removes the service CanIf_ReadRxPduData() from the code */
+#define CANIF_PUBLIC_READRXPDU_DATA_API				STD_ON
+
+/* Adds / removes the service CanIf_SetDynamicTxId() from the code */
+#define CANIF_PUBLIC_SETDYNAMICTXID_API				STD_ON
+
+/* Adds / removes the buffering of Tx L-PDUs which find no free hardware object */
+#define CANIF_PUBLIC_TX_BUFFERING					STD_ON
+
+/* 
+   Adds / removes the Rx queue, CanIf_RxIndication() only queues the frame and
+   CanIf_MainFunctionRx() resolves it to its L-PDU and notifies the upper layer
+*/
+#define CANIF_RX_DEFERRED_PROCESSING				STD_ON
+
+/* Adds / removes the time measurement of CanIf_RxIndication() in the receive interrupt */
+#define CANIF_RX_ISR_MEASUREMENT					STD_ON
+
+/* 
+   Adds / removes the bus-off restart schedule of CanIf_MainFunctionBusOff() and
+   the service CanIf_GetBusOffStatistics()
+*/
+#define CANIF_BUSOFF_RECOVERY						STD_ON
+
+/* Configured L-PDUs, hardware objects and controllers */
+#define TX_CAN_L_PDU_NUM					(4u)
+#define RX_CAN_L_PDU_NUM					(7u)
+#define CANIF_NUM_OF_HTHS					(2u)
+#define CANIF_NUM_OF_HRHS					(2u)
+#define CANIF_NUM_OF_CONTROLLERS			(1u)
+
+/* Hardware objects of the CAN driver, size of the HOH to HRH table */
+#define CANIF_NUM_OF_HOHS					(10u)
+
+/* Rx CAN ID table entries, longest run of one HRH (bounds the binary search) */
+#define CANIF_NUM_OF_RX_IDS					(7u)
+#define CANIF_MAX_RX_IDS_PER_HRH			(5u)
+
+/* Byte the L-SDUs shorter than the DLC of their Tx L-PDU are padded with */
+#define CANIF_TX_PADDING_VALUE				(0xCCu)
+
+/* Longest Tx L-PDU, size of the padding buffer of CanIf_Transmit() */
+#define CANIF_TX_MAX_DLC					(8u)
+
+/* Tx L-PDUs of type CANIF_TXPDU_DYNAMIC, size of the RAM table of their current CAN IDs */
+#define CANIF_NUM_OF_DYNAMIC_TX_PDUS		(1u)
+
+/* Tx buffer entries of all HTHs, each HTH owns CanIfHthBufferSize entries from CanIfHthBufferOffset */
+#define CANIF_TX_BUFFER_SIZE				(4u)
+
+/* Frames queued between the receive interrupt and CanIf_MainFunctionRx(), shall be a power of two */
+#define CANIF_RX_QUEUE_SIZE					(32u)
+
+/* Data bytes kept per queued frame, 64 if a controller runs CAN FD */
+#define CANIF_RX_QUEUE_DATA_SIZE			(8u)
+
+/* Queued frames processed by one CanIf_MainFunctionRx() call */
+#define CANIF_RX_MAIN_FUNCTION_BUDGET		(8u)
+
+/* 
+   Free running up counter read at entry and exit of CanIf_RxIndication() (DWT_CYCCNT), the
+   integration code shall enable it (DEMCR.TRCENA and DWT_CTRL.CYCCNTENA) before CanIf_Init()
+*/
+#define CANIF_RX_ISR_TIMESTAMP_ADDRESS		(0xE0001004u)
+
+/* Period of the CanIf_MainFunctionBusOff() calls, unit of the recovery times */
+#define CANIF_BUSOFF_MAIN_FUNCTION_PERIOD_MS	(5u)
+
+/* Bytes of each of the two Rx data banks, the sum of the lengths of the L-PDUs read by CanIf_ReadRxPduData() */
+#define CANIF_RX_DATA_BUFFER_SIZE			(16u)
+
+/* Symbolic names of the Tx L-PDUs, CanIfTxSduId */
+#define CanIfConf_CanIfTxPduCfg_ENGINE_CMD	(0u)
+#define CanIfConf_CanIfTxPduCfg_BRAKE_CMD	(1u)
+#define CanIfConf_CanIfTxPduCfg_NODE_STATUS	(2u)
+#define CanIfConf_CanIfTxPduCfg_DIAG_RESP	(3u)
+
+/* Symbolic names of the Rx L-PDUs, CanIfRxSduId */
+#define CanIfConf_CanIfRxPduCfg_VEHICLE_CFG		(0u)
+#define CanIfConf_CanIfRxPduCfg_WHEEL_SPEED		(1u)
+#define CanIfConf_CanIfRxPduCfg_ENGINE_STATUS	(2u)
+#define CanIfConf_CanIfRxPduCfg_DIAG_REQ_PHYS	(3u)
+#define CanIfConf_CanIfRxPduCfg_DIAG_REQ_FUNC	(4u)
+#define CanIfConf_CanIfRxPduCfg_BODY_NODES		(5u)
+#define CanIfConf_CanIfRxPduCfg_CRUISE_CTRL_ANY	(6u)
+
+/* Symbolic names of the controllers */
+#define CanIfConf_CanIfCtrlCfg_CAN0	(0u)
+
+#endif /* CANIF_CFG_H */
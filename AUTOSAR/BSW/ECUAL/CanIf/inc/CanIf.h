@@ -71,34 +71,94 @@
 
 #if (CANIF_DEV_ERROR_DETECT == STD_ON)
 
+/* CanIf_Init Services ID */
+#define CANIF_INIT_SID										(0x01u)
+
+/* CanIf_Transmit Services ID */
+#define CANIF_TRANSMIT_SID									(0x49u)
+
+/* CanIf_TxConfirmation Services ID */
+#define CANIF_TXCONFIRMATION_SID							(0x13u)
+
+/* CanIf_RxIndication Services ID */
+#define CANIF_RXINDICATION_SID								(0x14u)
+
 #if (CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
  /* CanIf_ReadTxNotifStatus Services ID */
  #define CANIF_READTXNOTIFSTATUS_SID						(0x07u)
+ 
+ /* CanIf_ReadTxNotifStatusGroup Services ID (vendor specific) */
+ #define CANIF_READTXNOTIFSTATUSGROUP_SID					(0x81u)
 #endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
 
 #if (CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON)
  /* CanIf_ReadRxNotifStatus Services ID */
  #define CANIF_READRXNOTIFSTATUS_SID						(0x08u)
+ 
+ /* CanIf_ReadRxNotifStatusGroup Services ID (vendor specific) */
+ #define CANIF_READRXNOTIFSTATUSGROUP_SID					(0x82u)
 #endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
 
+#if (CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+ /* CanIf_ReadRxPduData Services ID */
+ #define CANIF_READRXPDUDATA_SID							(0x06u)
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
 #if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
  /* CanIf_SetDynamicTxId Services ID */
  #define CANIF_SETDYNAMICTXID_SID							(0x0Cu)
+ 
+ /* CanIf_SetDynamicTxIdList Services ID (vendor specific) */
+ #define CANIF_SETDYNAMICTXIDLIST_SID						(0x83u)
 #endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
 
+/* CanIf_SetControllerMode Services ID */
+#define CANIF_SETCONTROLLERMODE_SID							(0x03u)
+
+/* CanIf_GetControllerMode Services ID */
+#define CANIF_GETCONTROLLERMODE_SID							(0x04u)
+
+/* CanIf_ControllerBusOff Services ID */
+#define CANIF_CONTROLLERBUSOFF_SID							(0x16u)
+
 /* CanIf_ControllerModeIndication Services ID */
 #define CANIF_CONTROLLERMODEINDICATION_SID					(0x17u)
 
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+ /* CanIf_GetBusOffStatistics Services ID (vendor specific), CanIf_MainFunctionBusOff has no DET checks */
+ #define CANIF_GETBUSOFFSTATISTICS_SID						(0x84u)
+#endif /* CANIF_BUSOFF_RECOVERY */
+
+#if ((CANIF_RX_DEFERRED_PROCESSING == STD_ON) || (CANIF_RX_ISR_MEASUREMENT == STD_ON))
+ /* CanIf_GetRxStatistics Services ID (vendor specific), CanIf_MainFunctionRx has no DET checks */
+ #define CANIF_GETRXSTATISTICS_SID							(0x80u)
+#endif /* CANIF_RX_DEFERRED_PROCESSING || CANIF_RX_ISR_MEASUREMENT */
+
 
 /******* Devlopment Errors Macros definition *****/
 
 /* API service called with invalid parameter */
 /* if the “CanId” parameter to be Invalid within the current configuration */
 #define CANIF_E_PARAM_CANID 						(10u)
+
+/* API service called with an invalid data length */
+#define CANIF_E_PARAM_DLC 							(11u)
+
+/* API service called with an invalid hardware object handle */
+#define CANIF_E_PARAM_HOH 							(12u)
+ 
+/* API service called with an invalid L-PDU handle */
+#define CANIF_E_PARAM_LPDU 							(13u)
  
+/* API service called with an invalid controller ID */
+#define CANIF_E_PARAM_CONTROLLERID 					(15u)
+
 /* API service called with invalid pointer */
 #define CANIF_E_PARAM_POINTER 						(20u)
 
+/* API service called with an invalid controller mode */
+#define CANIF_E_PARAM_CTRLMODE 						(21u)
+
 /* API service used without module initialization */
 #define CANIF_E_UNINIT 								(30u)
 
@@ -108,12 +168,169 @@
 /* Receive PDU ID invalid */ 
 #define CANIF_E_INVALID_RXPDUID 					(60u)
 
+/* Received L-PDU shorter than the configured DLC */
+#define CANIF_E_INVALID_DATA_LENGTH 				(61u)
+
+/* Transmit L-SDU longer than the DLC of its L-PDU and truncation is not enabled */
+#define CANIF_E_DATA_LENGTH_MISMATCH 				(62u)
+
 #endif /* CANIF_DEV_ERROR_DETECT */
 
 /* CanIf init status */
 #define CANIF_UNINITIALIZED							(0u)
 #define CANIF_INITIALIZED							(1u)
 
+/* Words of 32 notification status bits read by CanIf_ReadTxNotifStatusGroup / CanIf_ReadRxNotifStatusGroup */
+#define CANIF_TX_NOTIF_GROUPS						((TX_CAN_L_PDU_NUM + 31u) / 32u)
+#define CANIF_RX_NOTIF_GROUPS						((RX_CAN_L_PDU_NUM + 31u) / 32u)
+
+/* CanIf post build configuration, generated in CanIf_Cfg.c */
+extern const CanIf_ConfigType CanIf_Config;
+
+/**********************************************************************************
+**	Service name: CanIf_Init                                 					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_Init		    		 		 **
+**				  (																 **
+**					const CanIf_ConfigType* ConfigPtr                            **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -initializes the CanIf with the configuration ConfigPtr, 	 	 **
+**				  the notification status of all L-PDUs is reset.                **
+**                                                        						 **
+**	Service ID:   0x01                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): ConfigPtr - Pointer to the CanIf configuration.       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_Init
+(
+	const CanIf_ConfigType* ConfigPtr
+);
+
+/**********************************************************************************
+**	Service name: CanIf_Transmit                              					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_Transmit	 		 **
+**				  (																 **
+**					PduIdType TxPduId,                                           **
+**				    const PduInfoType* PduInfoPtr                                **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -requests the transmission of a Tx L-PDU, the L-PDU is 	 	 **
+**				  passed to Can_Write() on its hardware transmit handle.         **
+**                                                        						 **
+**	Service ID:   0x49                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): TxPduId    - L-SDU handle to be transmitted.       		 **
+**				     PduInfoPtr - Length and data of the L-SDU.            		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    E_OK     - Transmit request accepted by the CAN driver	 **
+**					 E_NOT_OK - Transmit request not accepted				     **
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_Transmit
+(
+	PduIdType TxPduId,
+	const PduInfoType* PduInfoPtr
+);
+
+/**********************************************************************************
+**	Service name: CanIf_SetControllerMode                      					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_SetControllerMode	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**				    Can_ControllerStateType ControllerMode                       **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -requests the mode ControllerMode of the CAN controller from	 **
+**				  the CAN driver, the mode is taken over when the driver calls	 **
+**				  CanIf_ControllerModeIndication().								 **
+**				 -STOPPED or SLEEP ends a running bus-off recovery, STARTED		 **
+**				  during a bus-off restarts the controller at once.				 **
+**                                                        						 **
+**	Service ID:   0x03                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Asynchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant (Not for the same controller)                  		 **
+**                                                        						 **
+**	Parameters (in): ControllerId   - CAN controller.                   		 **
+**				     ControllerMode - CAN_CS_STARTED, CAN_CS_STOPPED or		 	 **
+**				                      CAN_CS_SLEEP.                   		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    E_OK     - Mode request accepted by the CAN driver		 	 **
+**					 E_NOT_OK - Mode request not accepted				     	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_SetControllerMode
+(
+	uint8 ControllerId,
+	Can_ControllerStateType ControllerMode
+);
+
+/**********************************************************************************
+**	Service name: CanIf_GetControllerMode                      					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_GetControllerMode	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**				    Can_ControllerStateType* ControllerModePtr                   **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reads the mode of the CAN controller last indicated by the	 **
+**				  CAN driver or set by a bus-off, CAN_CS_STOPPED after			 **
+**				  CanIf_Init().													 **
+**                                                        						 **
+**	Service ID:   0x04                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller.                   		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   ControllerModePtr - Mode of the controller.			 **
+**                                                                               **
+**	Return value:    E_OK     - Mode read									 	 **
+**					 E_NOT_OK - Mode not read						     	 	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_GetControllerMode
+(
+	uint8 ControllerId,
+	Can_ControllerStateType* ControllerModePtr
+);
+
 #if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
 /**********************************************************************************
 **	Service name: CanIf_SetDynamicTxId                         					 **
@@ -127,6 +344,8 @@
 **  Description : This API 													     **
 **				 -reconfigures the corresponding CAN identifier					 **
 **				  of the requested CAN L-PDU.                                    **
+**				 -Only L-PDUs of type CANIF_TXPDU_DYNAMIC can be reconfigured,	 **
+**				  the new CAN ID is kept in RAM until the next CanIf_Init().	 **
 **                                                        						 **
 **	Service ID:   0x0C                            						    	 **
 **                                                        						 **
@@ -150,6 +369,46 @@ FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId
 	Can_IdType CanId
 );
 
+/**********************************************************************************
+**	Service name: CanIf_SetDynamicTxIdList                     					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxIdList		 	 **
+**				  (																 **
+**					const PduIdType* CanIfTxSduIds,                              **
+**				    const Can_IdType* CanIds,                                    **
+**				    uint16 Count                                                 **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reconfigures the CAN identifiers of Count dynamic CAN L-PDUs,	 **
+**				  CanIfTxSduIds[i] gets CanIds[i].							 	 **
+**				 -All entries are checked first and changed in one critical		 **
+**				  section, a transmission sees either all old or all new IDs.	 **
+**                                                        						 **
+**	Service ID:   0x83 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduIds - L-SDU handles to be reconfigured.     		 **
+**				     CanIds        - New CAN IDs of the L-SDUs.          		 **
+**				     Count         - Number of entries of both lists.      		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxIdList
+(
+	const PduIdType* CanIfTxSduIds,
+	const Can_IdType* CanIds,
+	uint16 Count
+);
+
 #endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
 
 #if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
@@ -164,6 +423,8 @@ FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId
 **  Description : This API 													     **
 **				 -Reads the confirmation status of a specific static or 		 **
 **				 dynamic CAN Tx L-PDU, requested by the CanIfTxSduId.            **
+**				 -The status bit is read and cleared in one exclusive access,	 **
+**				 a confirmation in between is never lost.						 **
 **                                                        						 **
 **	Service ID:   0x07                            						    	 **
 **                                                        						 **
@@ -187,6 +448,291 @@ FUNC( CanIf_NotifStatusType, CANIF_CODE) CanIf_ReadTxNotifStatus
 	PduIdType CanIfTxSduId
 );
 
+/**********************************************************************************
+**	Service name: CanIf_ReadTxNotifStatusGroup                   				 **
+**	                                                      						 **
+**	Syntax:	      FUNC( uint32, CANIF_CODE ) CanIf_ReadTxNotifStatusGroup	 	 **
+**				  (																 **
+**					uint16 Group	                                             **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reads and clears the confirmation status of the 32 Tx L-PDUs	 **
+**				  Group * 32 .. Group * 32 + 31 in one exclusive access, bit n	 **
+**				  of the result is the status of Tx L-PDU Group * 32 + n.		 **
+**				 -L-PDUs without CanIfTxPduReadNotifyStatus always read 0.		 **
+**                                                        						 **
+**	Service ID:   0x81 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): Group - Status word, below CANIF_TX_NOTIF_GROUPS.			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	Confirmation status bits of the group			       	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( uint32, CANIF_CODE ) CanIf_ReadTxNotifStatusGroup
+(
+	uint16 Group
+);
+
 #endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
 
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_ReadRxPduData                     					 	 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_ReadRxPduData	 	 **
+**				  (																 **
+**					PduIdType CanIfRxSduId,                                      **
+**					PduInfoType* CanIfRxInfoPtr                                  **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -copies the latest received L-SDU of the Rx L-PDU CanIfRxSduId	 **
+**				  to CanIfRxInfoPtr->SduDataPtr and sets its length, without	 **
+**				  locking the interrupts and without mixing two frames.			 **
+**                                                        						 **
+**	Service ID:   0x06                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfRxSduId - Receive L-SDU handle.			       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   CanIfRxInfoPtr - Buffer of at least CanIfRxPduDlc bytes **
+**									 	 and length of the copied L-SDU.		 **
+**                                                                               **
+**	Return value:    E_OK 	  - The latest L-SDU was copied.					 **
+**					 E_NOT_OK - No frame of the L-PDU was received yet.			 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_ReadRxPduData
+(
+	PduIdType CanIfRxSduId,
+	PduInfoType* CanIfRxInfoPtr
+);
+
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if(CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_ReadRxNotifStatus                     					 **
+**	                                                      						 **
+**	Syntax:	   FUNC( CanIf_NotifStatusType, CANIF_CODE ) CanIf_ReadRxNotifStatus **
+**			   (																 **
+** 				  PduIdType CanIfRxSduId                                         **
+**			   )                                                                 **
+**																				 **
+**  Description : This API 													     **
+**				 -Reads and resets the indication status of the Rx L-PDU		 **
+**				 CanIfRxSduId in one exclusive access, an indication in		 	 **
+**				 between is never lost.											 **
+**                                                        						 **
+**	Service ID:   0x08                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfRxSduId - Receive L-SDU handle.			       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    RetVal- the indication status Of Rx L-PDU 					 **
+**					 CANIF_NO_NOTIFICATION				 					     **
+**                   CANIF_TX_RX_NOTIFICATION                				     **
+**                                                       						 **
+***********************************************************************************/
+FUNC( CanIf_NotifStatusType, CANIF_CODE) CanIf_ReadRxNotifStatus
+(
+	PduIdType CanIfRxSduId
+);
+
+/**********************************************************************************
+**	Service name: CanIf_ReadRxNotifStatusGroup                   				 **
+**	                                                      						 **
+**	Syntax:	      FUNC( uint32, CANIF_CODE ) CanIf_ReadRxNotifStatusGroup	 	 **
+**				  (																 **
+**					uint16 Group	                                             **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reads and clears the indication status of the 32 Rx L-PDUs	 **
+**				  Group * 32 .. Group * 32 + 31 in one exclusive access, bit n	 **
+**				  of the result is the status of Rx L-PDU Group * 32 + n.		 **
+**				 -L-PDUs without CanIfRxPduReadNotifyStatus always read 0.		 **
+**                                                        						 **
+**	Service ID:   0x82 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): Group - Status word, below CANIF_RX_NOTIF_GROUPS.			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	Indication status bits of the group			       		 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( uint32, CANIF_CODE ) CanIf_ReadRxNotifStatusGroup
+(
+	uint16 Group
+);
+
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_MainFunctionRx                     					 	 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_MainFunctionRx( void )		 	 **
+**																				 **
+**  Description : This API 													     **
+**				 -processes up to CANIF_RX_MAIN_FUNCTION_BUDGET frames queued by **
+**				  CanIf_RxIndication(), oldest first: the CAN ID is resolved to	 **
+**				  its Rx L-PDU and the upper layer is notified in task context.	 **
+**				 -Shall be called cyclically from one task only.				 **
+**                                                        						 **
+**	Service ID:   NA (vendor specific, no DET checks)                  	    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): NA											       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_MainFunctionRx( void );
+
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if ((CANIF_RX_DEFERRED_PROCESSING == STD_ON) || (CANIF_RX_ISR_MEASUREMENT == STD_ON))
+/**********************************************************************************
+**	Service name: CanIf_GetRxStatistics                     					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_GetRxStatistics			 	 **
+**				  (																 **
+**					CanIf_RxStatisticsType* StatisticsPtr                        **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -copies the Rx queue overflow count and high watermark and the	 **
+**				  last and longest CanIf_RxIndication() duration, all counted	 **
+**				  since CanIf_Init(). The fields are read one by one while the	 **
+**				  receive interrupt may update them.							 **
+**                                                        						 **
+**	Service ID:   0x80 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): NA											       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   StatisticsPtr - Receive path statistics.				 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_GetRxStatistics
+(
+	CanIf_RxStatisticsType* StatisticsPtr
+);
+
+#endif /* CANIF_RX_DEFERRED_PROCESSING || CANIF_RX_ISR_MEASUREMENT */
+
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_MainFunctionBusOff                     					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_MainFunctionBusOff( void )	 **
+**																				 **
+**  Description : This API 													     **
+**				 -restarts the controllers in bus-off: the first				 **
+**				  CanIfCtrlFastRecoveryAttempts restarts follow each other		 **
+**				  after CanIfCtrlFastRecoveryTicks calls, the later ones after	 **
+**				  CanIfCtrlSlowRecoveryTicks calls.								 **
+**				 -Shall be called every CANIF_BUSOFF_MAIN_FUNCTION_PERIOD_MS	 **
+**				  from one task only.											 **
+**                                                        						 **
+**	Service ID:   NA (vendor specific, no DET checks)                  	    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): NA											       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_MainFunctionBusOff( void );
+
+/**********************************************************************************
+**	Service name: CanIf_GetBusOffStatistics                    					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_GetBusOffStatistics		 	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**					CanIf_BusOffStatisticsType* StatisticsPtr                    **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -copies the bus-off count, restart attempts, flushed Tx		 **
+**				  L-PDUs and the last and longest recovery time of the			 **
+**				  controller, all counted since CanIf_Init().					 **
+**				 -A recovery ends with the first Tx confirmation after the		 **
+**				  restart, its time has the resolution of one					 **
+**				  CanIf_MainFunctionBusOff() period.							 **
+**                                                        						 **
+**	Service ID:   0x84 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller.                   		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   StatisticsPtr - Bus-off statistics of the controller.	 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_GetBusOffStatistics
+(
+	uint8 ControllerId,
+	CanIf_BusOffStatisticsType* StatisticsPtr
+);
+
+#endif /* CANIF_BUSOFF_RECOVERY */
+
 #endif /* CANIF_H */
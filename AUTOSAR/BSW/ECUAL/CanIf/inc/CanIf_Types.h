@@ -22,4 +22,258 @@
 **                                                       						 **
 **	MAY BE CHANGED BY USER : No                          						 **
 **                                                       					     **
-***********************************************************************************/
\ No newline at end of file
+***********************************************************************************/
+
+#ifndef CANIF_TYPES_H
+#define CANIF_TYPES_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+#include "Can_GeneralTypes.h"
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/*	Moudle Version	1.0.0 */
+#define CANIF_TYPES_SW_MAJOR_VERSION			(0x01u)
+#define CANIF_TYPES_SW_MINOR_VERSION			(0x00u)
+#define CANIF_TYPES_SW_PATCH_VERSION			(0x00u)
+
+/* Autosar version 4.3.1 */
+#define CANIF_TYPES_AR_RELEASE_MAJOR_VERSION	(0x04u)
+#define CANIF_TYPES_AR_RELEASE_MINOR_VERSION	(0x03u)
+#define CANIF_TYPES_AR_RELEASE_PATCH_VERSION	(0x01u)
+
+/* Tx L-PDU types (CanIfTxPduCfgType.CanIfTxPduType) */
+#define CANIF_TXPDU_STATIC						(0x00u)
+#define CANIF_TXPDU_DYNAMIC						(0x01u)
+
+/* Dynamic CAN ID index of a Tx L-PDU of type CANIF_TXPDU_STATIC */
+#define CANIF_INVALID_DYNAMIC_ID				(0xFFFFu)
+
+/* Handling of the buffered Tx L-PDUs of a controller on a bus-off (CanIfCtrlCfgType.CanIfCtrlBusOffTxBuffers) */
+#define CANIF_BUSOFF_FLUSH_TX_BUFFERS			(0x00u)
+#define CANIF_BUSOFF_RETAIN_TX_BUFFERS			(0x01u)
+
+/* Entry of the HOH to HRH table for a hardware object which is not a CanIf receive handle */
+#define CANIF_INVALID_HRH						(0xFFFFu)
+
+/*****************************************************************/
+/*				        Types Definition       		     	     */
+/*****************************************************************/
+
+/* [SWS_CANIF_00137] Return value of CAN L-PDU notification status */
+typedef enum
+{
+	/* No transmit or receive event occurred for the requested L-PDU */
+	CANIF_NO_NOTIFICATION	 = 0x00,
+	/* The requested Rx/Tx CAN L-PDU was successfully transmitted or received */
+	CANIF_TX_RX_NOTIFICATION = 0x01
+}CanIf_NotifStatusType;
+
+/* Type defenition of the Tx confirmation of the upper layer of a Tx L-PDU */
+typedef void (*CanIf_UserTxConfirmationType)(PduIdType TxPduId, Std_ReturnType result);
+
+/* Type defenition of the Rx indication of the upper layer of an Rx L-PDU */
+typedef void (*CanIf_UserRxIndicationType)(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
+
+/* Type defenition of the bus-off notification of the upper layer of a controller */
+typedef void (*CanIf_UserCtrlBusOffType)(uint8 ControllerId);
+
+/* Type defenition of the mode indication of the upper layer of a controller */
+typedef void (*CanIf_UserCtrlModeIndicationType)(uint8 ControllerId, Can_ControllerStateType ControllerMode);
+
+/* Type defenition of one Tx L-PDU, CanIfTxPduCfg */
+typedef struct 
+{
+	/* CAN ID of the L-PDU, the initial one of a dynamic L-PDU, bit 31 set for an extended CAN ID */
+	Can_IdType						CanIfTxPduCanId;
+	
+	/* PDU ID of the L-PDU in the upper layer, passed to the Tx confirmation */
+	PduIdType						CanIfTxPduUlId;
+	
+	/* Index of the L-PDU's hardware transmit handle in the HTH table */
+	uint16							CanIfTxPduHthIdRef;
+	
+	/* CAN driver hardware object and controller of the HTH, resolved by the generator for CanIf_Transmit() */
+	Can_HwHandleType				CanIfTxPduHoh;
+	uint8							CanIfTxPduCtrlId;
+	
+	/* Data length of the L-PDU in bytes, shorter L-SDUs are padded with CANIF_TX_PADDING_VALUE */
+	uint8							CanIfTxPduDlc;
+	
+	/* Longer L-SDUs are truncated to CanIfTxPduDlc instead of being rejected */
+	boolean							CanIfTxPduTruncation;
+	
+	/* CANIF_TXPDU_STATIC, or CANIF_TXPDU_DYNAMIC if the CAN ID can be changed by CanIf_SetDynamicTxId() */
+	uint8							CanIfTxPduType;
+	
+	/* The confirmation status of the L-PDU can be read by CanIf_ReadTxNotifStatus() */
+	boolean							CanIfTxPduReadNotifyStatus;
+	
+	/* Entry of the current CAN ID in the RAM table of the dynamic L-PDUs, CANIF_INVALID_DYNAMIC_ID if static */
+	uint16							CanIfTxPduDynamicIdRef;
+	
+	/* Tx confirmation of the upper layer, NULL_PTR for none */
+	CanIf_UserTxConfirmationType	CanIfTxPduUserTxConfirmationUL;
+}CanIfTxPduCfgType;
+
+/* Type defenition of one Rx L-PDU, CanIfRxPduCfg */
+typedef struct 
+{
+	/* CAN ID of the L-PDU, the lowest CAN ID for a range or mask, bit 31 set for an extended CAN ID */
+	Can_IdType						CanIfRxPduCanId;
+	
+	/* PDU ID of the L-PDU in the upper layer, passed to the Rx indication */
+	PduIdType						CanIfRxPduUlId;
+	
+	/* Index of the L-PDU's hardware receive handle in the HRH table */
+	uint16							CanIfRxPduHrhIdRef;
+	
+	/* Data length of the L-PDU in bytes, shorter frames are not accepted */
+	uint8							CanIfRxPduDlc;
+	
+	/* The indication status of the L-PDU can be read by CanIf_ReadRxNotifStatus() */
+	boolean							CanIfRxPduReadNotifyStatus;
+	
+	/* The data of the L-PDU can be read by CanIf_ReadRxPduData() */
+	boolean							CanIfRxPduReadData;
+	
+	/* First byte of the L-PDU in each Rx data bank, CanIfRxPduReadData only */
+	uint16							CanIfRxPduDataOffset;
+	
+	/* Rx indication of the upper layer, NULL_PTR for none */
+	CanIf_UserRxIndicationType		CanIfRxPduUserRxIndicationUL;
+}CanIfRxPduCfgType;
+
+/* 
+	Type defenition of one entry of the Rx CAN ID table, the entries of an HRH are 
+	disjoint CAN ID ranges sorted by CanIdLower, a single CAN ID has CanIdLower == CanIdUpper
+*/
+typedef struct 
+{
+	/* CAN ID range of the Rx L-PDU, bit 31 set for extended CAN IDs */
+	Can_IdType						CanIdLower;
+	Can_IdType						CanIdUpper;
+	
+	/* Rx L-PDU received with the CAN ID */
+	PduIdType						RxPduId;
+}CanIfRxIdEntryType;
+
+/* Type defenition of one hardware transmit handle, CanIfHthCfg */
+typedef struct 
+{
+	/* CAN driver hardware object of the HTH */
+	Can_HwHandleType				CanIfHthIdSymRef;
+	
+	/* CAN controller of the HTH */
+	uint8							CanIfHthCanCtrlIdRef;
+	
+	/* First entry of the HTH in the Tx buffer and number of entries, 0 if the HTH is not buffered */
+	uint16							CanIfHthBufferOffset;
+	uint8							CanIfHthBufferSize;
+}CanIfHthCfgType;
+
+/* Type defenition of one hardware receive handle, CanIfHrhCfg */
+typedef struct 
+{
+	/* CAN driver hardware object of the HRH */
+	Can_HwHandleType				CanIfHrhIdSymRef;
+	
+	/* CAN controller of the HRH */
+	uint8							CanIfHrhCanCtrlIdRef;
+	
+	/* Index of the first Rx CAN ID table entry of the HRH */
+	uint16							CanIfHrhRxIdFirst;
+	
+	/* Number of Rx CAN ID table entries of the HRH */
+	uint16							CanIfHrhRxIdCount;
+}CanIfHrhCfgType;
+
+/* Type defenition of one CAN controller, CanIfCtrlCfg, indexed by the controller ID */
+typedef struct 
+{
+	/* CANIF_BUSOFF_FLUSH_TX_BUFFERS or CANIF_BUSOFF_RETAIN_TX_BUFFERS, the retained L-PDUs are sent after the restart */
+	uint8							CanIfCtrlBusOffTxBuffers;
+	
+	/* Restarts after a bus-off spaced by CanIfCtrlFastRecoveryTicks, the later ones by CanIfCtrlSlowRecoveryTicks */
+	uint8							CanIfCtrlFastRecoveryAttempts;
+	
+	/* Delays of the restarts in CanIf_MainFunctionBusOff() periods, CANIF_BUSOFF_RECOVERY only */
+	uint16							CanIfCtrlFastRecoveryTicks;
+	uint16							CanIfCtrlSlowRecoveryTicks;
+	
+	/* Bus-off notification and mode indication of the upper layer, NULL_PTR for none */
+	CanIf_UserCtrlBusOffType			CanIfCtrlUserBusOffUL;
+	CanIf_UserCtrlModeIndicationType	CanIfCtrlUserModeIndicationUL;
+}CanIfCtrlCfgType;
+
+/* Type defenition of the CanIf initialization configuration, CanIfInitCfg */
+typedef struct 
+{
+	/* Tx L-PDUs in Tx PDU ID order */
+	const CanIfTxPduCfgType*		CanIfTxPduCfgObj;
+	
+	/* Rx L-PDUs in Rx PDU ID order */
+	const CanIfRxPduCfgType*		CanIfRxPduCfgObj;
+	
+	/* Rx CAN ID table, disjoint CAN ID ranges sorted by CAN ID inside every HRH */
+	const CanIfRxIdEntryType*		CanIfRxIdObj;
+	
+	/* Hardware transmit handles */
+	const CanIfHthCfgType*			CanIfHthCfgObj;
+	
+	/* Hardware receive handles */
+	const CanIfHrhCfgType*			CanIfHrhCfgObj;
+	
+	/* HRH index of every CAN driver hardware object, CANIF_INVALID_HRH if it is no receive handle */
+	const uint16*					CanIfHohToHrh;
+	
+	/* CAN controllers in controller ID order */
+	const CanIfCtrlCfgType*			CanIfCtrlCfgObj;
+}CanIfInitCfgType;
+
+/* Type defenition of the receive path statistics read by CanIf_GetRxStatistics() */
+typedef struct 
+{
+	/* Frames lost because the Rx queue was full, CANIF_RX_DEFERRED_PROCESSING only */
+	uint32							QueueOverflows;
+	
+	/* Highest number of frames waiting in the Rx queue, CANIF_RX_DEFERRED_PROCESSING only */
+	uint16							QueueHighWatermark;
+	
+	/* Duration of the last and the longest CanIf_RxIndication() in timer ticks, CANIF_RX_ISR_MEASUREMENT only */
+	uint32							IsrTimeLast;
+	uint32							IsrTimeMax;
+}CanIf_RxStatisticsType;
+
+/* Type defenition of the bus-off statistics of a controller read by CanIf_GetBusOffStatistics() */
+typedef struct 
+{
+	/* Bus-off events, a bus-off before the recovery of the previous one is not counted again */
+	uint32							BusOffCount;
+	
+	/* Restart requests of CanIf_MainFunctionBusOff() and CanIf_SetControllerMode() during a bus-off */
+	uint32							RestartAttempts;
+	
+	/* Buffered Tx L-PDUs dropped on a bus-off (CANIF_BUSOFF_FLUSH_TX_BUFFERS) */
+	uint32							FlushedTxPdus;
+	
+	/* Time from the bus-off to the first Tx confirmation afterwards in ms, last and longest recovery */
+	uint32							RecoveryTimeLast;
+	uint32							RecoveryTimeMax;
+}CanIf_BusOffStatisticsType;
+
+/* [SWS_CANIF_00144] Type defenition of the CanIf post build configuration */
+typedef struct 
+{
+	/* Initialization configuration */
+	const CanIfInitCfgType*			CanIfInitCfgObj;
+}CanIf_ConfigType;
+
+#endif /* CANIF_TYPES_H */
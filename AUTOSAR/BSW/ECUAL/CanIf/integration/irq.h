@@ -0,0 +1,47 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	irq.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : CanIf critical section mapping.								 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : Yes                           						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef IRQ_H
+#define IRQ_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+#include "interrupt.h"
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/* 
+   Global interrupt lock of the CanIf critical sections (PRIMASK), 
+   the sections are short and never nested
+*/
+#define irq_Disable()		((void)IntMasterDisable())
+#define irq_Enable()		((void)IntMasterEnable())
+
+#endif /* IRQ_H */
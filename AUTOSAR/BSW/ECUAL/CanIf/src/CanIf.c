@@ -29,8 +29,14 @@
 /***********************************************************************************/
 
 #include "CanIf.h"
+#include "CanIf_Cbk.h"
+#include "Can.h"
 #include "irq.h"
 
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+#include "Common_Macros.h"
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+
 #if (CANIF_DEV_ERROR_DETECT == STD_ON)
 #include "Det.h"
 #endif /* CANIF_DEV_ERROR_DETECT */
@@ -80,21 +86,100 @@
 
 #endif /* CANIF_DEV_ERROR_DETECT */
 
+/* Result of the Rx CAN ID lookup for a frame which belongs to no Rx L-PDU */
+#define CANIF_RX_NO_PDU				(0xFFFFu)
+
+/* Longest L-SDU a CAN FD frame can carry */
+#define CANIF_RX_MAX_LENGTH			(64u)
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+
+/* Tx buffer position of an L-PDU which is not buffered */
+#define CANIF_TX_NOT_BUFFERED		(0xFFu)
+
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+
+#if ((CANIF_RX_QUEUE_SIZE & (CANIF_RX_QUEUE_SIZE - 1u)) != 0u) || (CANIF_RX_QUEUE_SIZE > 0x8000u)
+#error "CANIF_RX_QUEUE_SIZE shall be a power of two not above 0x8000."
+#endif /* CANIF_RX_QUEUE_SIZE */
+
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
 /*******************************************************************************/
 /*                      Local Types Definition		 	  	                   */
 /*******************************************************************************/
 
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
 /* Struct to Hold various Flags and data for Tx PDUs */
 typedef struct 
 {
-	/* Variable to hold the confirmation status for Tx L-PDUs */
-	/* Shall be set by CanIf_TxConfirmation() Api */
-#if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
-	uint8 TxConfirmationStatus;
-#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
+	/* Padded L-SDU of a buffered L-PDU, a newer request overwrites it */
+	uint8 TxBufferSdu[CANIF_TX_MAX_DLC];
+	
+	/* Position of the L-PDU in the Tx buffer of its HTH, CANIF_TX_NOT_BUFFERED if not buffered */
+	uint8 TxBufferPos;
 	
 }TxLPduType;
 
+/* 
+	Entry of a Tx buffer, the entries of an HTH form a binary min heap on Priority
+	so the L-PDU which wins the bus arbitration is always at the first entry.
+*/
+typedef struct 
+{
+	/* Arbitration priority of the CAN ID, lower value wins */
+	uint32 Priority;
+	
+	/* Buffered L-PDU */
+	PduIdType PduId;
+	
+}TxBufferEntryType;
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+/* Frame queued by CanIf_RxIndication() for CanIf_MainFunctionRx() */
+typedef struct 
+{
+	/* CAN ID and hardware object of the frame as passed by the CAN driver */
+	Can_IdType CanId;
+	Can_HwHandleType Hoh;
+	
+	/* Length of the L-SDU, at most CANIF_RX_QUEUE_DATA_SIZE */
+	uint8 Length;
+	
+	/* Data of the L-SDU */
+	uint8 Data[CANIF_RX_QUEUE_DATA_SIZE];
+	
+}RxQueueEntryType;
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+/* Mode and bus-off state of a CAN controller */
+typedef struct 
+{
+	/* Mode last indicated by the CAN driver, CAN_CS_STOPPED after CanIf_Init() and on a bus-off */
+	Can_ControllerStateType Mode;
+	
+	/* TRUE from a bus-off to the first Tx confirmation of the controller afterwards */
+	boolean BusOff;
+	
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+	/* Restarts since the bus-off, saturated at 0xFF, selects the fast or the slow delay */
+	uint8 RestartCount;
+	
+	/* CanIf_MainFunctionBusOff() calls to the next restart, counted down while the controller is not started */
+	uint16 RestartTimer;
+	
+	/* BusOffTick at the bus-off */
+	uint32 BusOffStart;
+	
+	/* Statistics read by CanIf_GetBusOffStatistics() */
+	CanIf_BusOffStatisticsType Statistics;
+#endif /* CANIF_BUSOFF_RECOVERY */
+	
+}CtrlStateType;
+
 
 
 /*******************************************************************************/
@@ -107,9 +192,67 @@ static uint8 CanInitState = CANIF_UNINITIALIZED;
 /* Pointer to Save CanIf configuration parameters to be used in various Functions */
 static const CanIf_ConfigType* CanIf_ConfigPtr;
 
+#if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
+/* Confirmation status of the Tx L-PDUs, bit (Id % 32) of word (Id / 32), set by CanIf_TxConfirmation() */
+static volatile uint32 TxNotifStatus[CANIF_TX_NOTIF_GROUPS];
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
+
+#if(CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON)
+/* Indication status of the Rx L-PDUs, bit (Id % 32) of word (Id / 32), set by CanIf_RxIndication() */
+static volatile uint32 RxNotifStatus[CANIF_RX_NOTIF_GROUPS];
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+/* Two banks of received L-SDUs, an Rx L-PDU owns CanIfRxPduDlc bytes from CanIfRxPduDataOffset in each */
+static uint8 RxDataBank[2][CANIF_RX_DATA_BUFFER_SIZE];
+
+/* Frames stored per Rx L-PDU, written by the receive path only, the latest is in bank (Sequence & 1), 0 before the first */
+static volatile uint16 RxDataSequence[RX_CAN_L_PDU_NUM];
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+/* Current CAN IDs of the dynamic Tx L-PDUs, indexed by CanIfTxPduDynamicIdRef, the configuration stays in flash */
+static Can_IdType TxDynamicCanId[CANIF_NUM_OF_DYNAMIC_TX_PDUS];
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
 /* TxLPduType object for each Tx L-PUD */
 static TxLPduType TxLPdu[TX_CAN_L_PDU_NUM];
 
+/* Tx buffers of all HTHs, each HTH owns CanIfHthBufferSize entries from CanIfHthBufferOffset */
+static TxBufferEntryType TxBuffer[CANIF_TX_BUFFER_SIZE];
+
+/* Number of buffered L-PDUs of each HTH */
+static uint8 TxBufferCount[CANIF_NUM_OF_HTHS];
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+/* Received frames, single producer (CanIf_RxIndication) and single consumer (CanIf_MainFunctionRx) */
+static RxQueueEntryType RxQueue[CANIF_RX_QUEUE_SIZE];
+
+/* Free running indexes of the queue, the head is written by the ISR and the tail by the consumer only */
+static volatile uint16 RxQueueHead = 0u;
+static volatile uint16 RxQueueTail = 0u;
+
+/* Frames lost because the queue was full, and the highest fill level seen by the ISR */
+static volatile uint32 RxQueueOverflow = 0u;
+static volatile uint16 RxQueueHighWatermark = 0u;
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+/* Duration of the last and the longest CanIf_RxIndication() in CANIF_RX_ISR_TIMESTAMP_ADDRESS ticks */
+static volatile uint32 RxIsrTimeLast = 0u;
+static volatile uint32 RxIsrTimeMax = 0u;
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+
+/* State of each controller, written by the CAN driver callbacks and the controller mode services */
+static volatile CtrlStateType CtrlState[CANIF_NUM_OF_CONTROLLERS];
+
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+/* CanIf_MainFunctionBusOff() calls since CanIf_Init(), time base of the recovery times */
+static volatile uint32 BusOffTick = 0u;
+#endif /* CANIF_BUSOFF_RECOVERY */
+
 
 /*******************************************************************************/
 /*                      Local Function ProtoType  			                   */
@@ -123,102 +266,167 @@ LOCAL_INLINE uint8 CanIfCheckTxId( PduIdType CanIfTxSduId);
 /* Inline Function to Check the validation of The Pdu CanId */
 LOCAL_INLINE uint8 CanIfCheckCanId(Can_IdType CanId);
 
-/* Inline Function to Get a Pointer to corresponding TxPduId configuration Structure */
-LOCAL_INLINE CanIfTxPduCfgType* CanIfGetTxPduCfg(PduIdType CanIfTxSduId);
+/* Inline function to check the controller ID */
+LOCAL_INLINE uint8 CanIfCheckCtrlId(uint8 ControllerId);
+
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+
+/* Inline function to check that a Tx PDU ID is valid and of type CANIF_TXPDU_DYNAMIC */
+LOCAL_INLINE uint8 CanIfCheckDynamicTxId(PduIdType CanIfTxSduId);
+
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if ((CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON) || (CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON))
+
+/* Inline function to check the Rx PDU ID */
+LOCAL_INLINE uint8 CanIfCheckRxId(PduIdType CanIfRxSduId);
+
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API || CANIF_PUBLIC_READRXPDU_DATA_API */
 
 #endif /* CANIF_DEV_ERROR_DETECT */
 
-/*
-	[SWS_CANIF_00335] This API can be enabled or disabled at pre-compile time 
-	configuration globally by the parameter	CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API
-*/	
-#if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
+#if ((CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON) || (CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON))
+
+/* Inline Function to set bits of a notification status word, interrupt safe */
+LOCAL_INLINE void CanIfNotifSet(volatile uint32* Word, uint32 Mask);
+
+/* Inline Function to read and clear bits of a notification status word, interrupt safe */
+LOCAL_INLINE uint32 CanIfNotifFetchClear(volatile uint32* Word, uint32 Mask);
+
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API || CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+/* Inline Function to get the current CAN ID of a Tx L-PDU */
+LOCAL_INLINE Can_IdType CanIfTxCanId(const CanIfTxPduCfgType* TxPduCfg);
+
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+
+/* Inline Function to change the CAN ID of a dynamic Tx L-PDU and of its buffered entry */
+LOCAL_INLINE void CanIfTxIdUpdate(PduIdType CanIfTxSduId, Can_IdType CanId);
+
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+/* Inline Function to resolve the HRH and CAN ID of a received frame to its Rx L-PDU */
+LOCAL_INLINE PduIdType CanIfRxLookup(uint16 HrhIndex, Can_IdType CanId);
+
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+
+/* Inline Function to store a received L-SDU in the free bank of its Rx L-PDU */
+LOCAL_INLINE void CanIfRxDataStore(PduIdType RxPduId, const CanIfRxPduCfgType* RxPduCfg, const uint8* SduDataPtr);
+
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+/* Inline Function to check a received frame against its Rx L-PDU and notify the upper layer */
+LOCAL_INLINE void CanIfRxProcess(Can_HwHandleType Hoh, Can_IdType CanId, const PduInfoType* PduInfoPtr);
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+
+/* Inline Function to push one received frame into the Rx queue */
+LOCAL_INLINE void CanIfRxQueuePush(const Can_HwType* Mailbox, const PduInfoType* PduInfoPtr);
+
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+
+/* Inline Function to get the arbitration priority of a CAN ID */
+LOCAL_INLINE uint32 CanIfTxPriority(Can_IdType CanId);
+
+/* Function to buffer an L-PDU which found no free hardware object */
+static Std_ReturnType CanIfTxBufferInsert(PduIdType TxPduId, const Can_PduType* CanPdu);
+
+/* Function to pass the highest priority buffered L-PDU of an HTH to the CAN driver */
+static void CanIfTxBufferSend(uint16 HthIndex);
+
+/* Function to restore the heap order after the priority of an entry changed */
+static void CanIfTxBufferSift(uint16 HthIndex, uint8 Pos);
+
+/* Function to drop the buffered L-PDUs of all HTHs of a controller */
+static uint32 CanIfTxBufferFlush(uint8 ControllerId);
+
+/* Function to send the first buffered L-PDU of every HTH of a controller */
+static void CanIfTxBufferResume(uint8 ControllerId);
+
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+/* Inline Function to end the bus-off of a controller on its first Tx confirmation */
+LOCAL_INLINE void CanIfBusOffEnd(uint8 ControllerId);
+
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+
+/* Inline Function to load the delay to the next restart of a controller in bus-off */
+LOCAL_INLINE void CanIfBusOffRestartDelay(uint8 ControllerId);
+
+#endif /* CANIF_BUSOFF_RECOVERY */
+
 /**********************************************************************************
-**	Service name: CanIf_ReadTxNotifStatus                     					 **
+**	Service name: CanIf_Init                                 					 **
 **	                                                      						 **
-**	Syntax:	   FUNC( CanIf_NotifStatusType, CANIF_CODE ) CanIf_ReadTxNotifStatus **		    		 
-**			   (																 **
-** 				  PduIdType CanIfTxSduId,                                        **
-**			   )                                                                 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_Init		    		 		 **
+**				  (																 **
+**					const CanIf_ConfigType* ConfigPtr                            **
+**				  )                                                              **
 **																				 **
 **  Description : This API 													     **
-**				 -Reads the confirmation status of a specific static or 		 **
-**				 dynamic CAN Tx L-PDU, requested by the CanIfTxSduId.            **
+**				 -initializes the CanIf with the configuration ConfigPtr, 	 	 **
+**				  the notification status of all L-PDUs is reset.                **
 **                                                        						 **
-**	Service ID:   0x07                            						    	 **
+**	Service ID:   0x01                            						    	 **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
 **  Reentrancy:   Non Reentrant                                            		 **
 **                                                        						 **
-**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
+**	Parameters (in): ConfigPtr - Pointer to the CanIf configuration.       		 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
-**                                                   						 	 **                                           		
+**                                                   						 	 **                                  
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    RetVal- the confirmation status Of Tx L-PDU 				 **
-**					 CANIF_NO_NOTIFICATION				 					     **
-**                   CANIF_TX_RX_NOTIFICATION                				     **											 
-**                                                       						 **                                  				
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
 ***********************************************************************************/
-FUNC( CanIf_NotifStatusType, CANIF_CODE) CanIf_ReadTxNotifStatus(PduIdType CanIfTxSduId)
+FUNC( void, CANIF_CODE ) CanIf_Init
+(
+	const CanIf_ConfigType* ConfigPtr
+)
 {
-	/* Variable to hold the Api return value */
-	CanIf_NotifStatusType RetVal  = CANIF_NO_NOTIFICATION;
-		
+#if ((CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON) || (CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON))
+	/* Loop index over the notification status words */
+	uint16 Group;
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API || CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+	/* Loop index over the Rx L-PDUs */
+	PduIdType RxPduIndex;
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if ((CANIF_PUBLIC_TX_BUFFERING == STD_ON) || (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON))
+	/* Loop index over the Tx L-PDUs */
+	PduIdType TxPduIndex;
+#endif /* CANIF_PUBLIC_TX_BUFFERING || CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+	/* Loop index over the HTHs */
+	uint16 HthIndex;
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+	/* Loop index over the controllers */
+	uint8 ControllerId;
+	
 #if (CANIF_DEV_ERROR_DETECT == STD_ON)
 
-/* Variable to Save the API's Error State */
+	/* Variable to Save the API's Error State */
 	Std_ReturnType ErrorState = E_OK;
 
-	if( CanInitState == CANIF_UNINITIALIZED )
+	if( NULL_PTR == ConfigPtr )
 	{
-	/*	
-		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
-		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
-		unless the CanIf has been initialized with a preceding call of CanIf_Init().
-	*/	
 		Det_ReportError(CANIF_MODULE_ID  ,
 						CANIF_INSTANCE_ID,
-						CANIF_READTXNOTIFSTATUS_SID,
-						CANIF_E_UNINIT);
+						CANIF_INIT_SID,
+						CANIF_E_PARAM_POINTER);
 						
 		/* Set the API Errorstate to E_NOT_OK */
 		ErrorState = E_NOT_OK;				
 	}
-	else if( CanIfCheckTxId(CanIfTxSduId) != CANIF_OK)
-	{
-	/*	
-		[SWS_CANIF_00331] If parameter CanIfTxSduId of The Api is out of range
-		CanIf shall report development error code CANIF_E_INVALID_TXPDUID to
-		the Det_ReportError service of the DET when The Api is called
-	*/	
-		Det_ReportError(CANIF_MODULE_ID  ,
-						CANIF_INSTANCE_ID,
-						CANIF_READTXNOTIFSTATUS_SID,
-						CANIF_E_INVALID_TXPDUID);
-						
-		/* Set the API Errorstate to E_NOT_OK */
-		ErrorState = E_NOT_OK;		
-	}
-	else if((CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[CanIfTxSduId].CanIfTxPduReadNotifyStatus) != TRUE)
-	{
-		
-	/*	
-		[SWS_CANIF_00331] If parameter CanIfTxSduId of The Api has no status 
-		information was configured for this CAN Tx L-SDU, CanIf shall report
-		development error code CANIF_E_INVALID_TXPDUID to the Det_ReportError
-		service of the DET when The Api is called
-	*/	
-		Det_ReportError(CANIF_MODULE_ID  ,
-						CANIF_INSTANCE_ID,
-						CANIF_READTXNOTIFSTATUS_SID,
-						CANIF_E_INVALID_TXPDUID);
-						
-		/* Set the API Errorstate to E_NOT_OK */
-		ErrorState = E_NOT_OK;	
-	}
 	/* (MISRA-C:2004 Rule 14.10 (required)) 
 	All if … else if constructs shall be terminated with an else clause. */
 	else
@@ -232,81 +440,153 @@ FUNC( CanIf_NotifStatusType, CANIF_CODE) CanIf_ReadTxNotifStatus(PduIdType CanIf
 	if(E_OK == ErrorState)	
 #endif /* CANIF_DEV_ERROR_DETECT */
 	{
-		/* Enter Critical section */
-		irq_Disable();
+		CanIf_ConfigPtr = ConfigPtr;
 		
-		/* Check for Tx L-SDU Notification Status */
-		if(TxLPdu[CanIfTxSduId].TxConfirmationStatus != CANIF_NO_NOTIFICATION)
+#if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
+		for(Group = 0u; Group < CANIF_TX_NOTIF_GROUPS; Group++)
 		{
-			RetVal = CANIF_TX_RX_NOTIFICATION;
+			TxNotifStatus[Group] = 0u;
 		}
-		/*
-			[SWS_CANIF_00393] If configuration parameters CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API
-			and CANIF_TXPDU_READ_NOTIFYSTATUS for the transmitted L-SDU are set to TRUE, 
-			and if CanIf_ReadTxNotifStatus() is called, the CanIf shall reset the notification status
-			for the transmitted L-SDU.
-		*/
-		TxLPdu[CanIfTxSduId].TxConfirmationStatus = CANIF_NO_NOTIFICATION;
-		
-		/* Exit Critical section */
-		 irq_Enable(); 
-	}
-	
-	/* return the Tx L-SDU NotifyStatus Value */
-	return RetVal;
-}
-
 #endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
+		
+#if(CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON)
+		for(Group = 0u; Group < CANIF_RX_NOTIF_GROUPS; Group++)
+		{
+			RxNotifStatus[Group] = 0u;
+		}
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
 
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+		for(RxPduIndex = 0u; RxPduIndex < RX_CAN_L_PDU_NUM; RxPduIndex++)
+		{
+			RxDataSequence[RxPduIndex] = 0u;
+		}
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
 
-/*
-	[SWS_CANIF_00357] The function CanIf_SetDynamicTxId() shall be pre compile time configurable
-	On/Off by the configuration parameter CANIF_PUBLIC_SETDYNAMICTXID_API
-*/	
 #if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+		/* Dynamic L-PDUs start with their configured CAN ID again */
+		for(TxPduIndex = 0u; TxPduIndex < TX_CAN_L_PDU_NUM; TxPduIndex++)
+		{
+			if(ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduIndex].CanIfTxPduDynamicIdRef != CANIF_INVALID_DYNAMIC_ID)
+			{
+				TxDynamicCanId[ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduIndex].CanIfTxPduDynamicIdRef] =
+					ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduIndex].CanIfTxPduCanId;
+			}
+		}
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		for(TxPduIndex = 0u; TxPduIndex < TX_CAN_L_PDU_NUM; TxPduIndex++)
+		{
+			TxLPdu[TxPduIndex].TxBufferPos = CANIF_TX_NOT_BUFFERED;
+		}
+		
+		for(HthIndex = 0u; HthIndex < CANIF_NUM_OF_HTHS; HthIndex++)
+		{
+			TxBufferCount[HthIndex] = 0u;
+		}
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+		/* Frames queued before the reinitialization are dropped */
+		RxQueueHead = 0u;
+		RxQueueTail = 0u;
+		RxQueueOverflow = 0u;
+		RxQueueHighWatermark = 0u;
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+		RxIsrTimeLast = 0u;
+		RxIsrTimeMax = 0u;
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+
+		/* The controllers are stopped until CanIf_SetControllerMode() starts them */
+		for(ControllerId = 0u; ControllerId < CANIF_NUM_OF_CONTROLLERS; ControllerId++)
+		{
+			CtrlState[ControllerId].Mode = CAN_CS_STOPPED;
+			CtrlState[ControllerId].BusOff = FALSE;
+			
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+			CtrlState[ControllerId].RestartCount = 0u;
+			CtrlState[ControllerId].RestartTimer = 0u;
+			CtrlState[ControllerId].BusOffStart = 0u;
+			CtrlState[ControllerId].Statistics.BusOffCount = 0u;
+			CtrlState[ControllerId].Statistics.RestartAttempts = 0u;
+			CtrlState[ControllerId].Statistics.FlushedTxPdus = 0u;
+			CtrlState[ControllerId].Statistics.RecoveryTimeLast = 0u;
+			CtrlState[ControllerId].Statistics.RecoveryTimeMax = 0u;
+#endif /* CANIF_BUSOFF_RECOVERY */
+		}
+
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+		BusOffTick = 0u;
+#endif /* CANIF_BUSOFF_RECOVERY */
+		
+		CanInitState = CANIF_INITIALIZED;
+	}
+}
+
 /**********************************************************************************
-**	Service name: CanIf_SetDynamicTxId                         					 **
+**	Service name: CanIf_Transmit                              					 **
 **	                                                      						 **
-**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId		    		 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_Transmit	 		 **
 **				  (																 **
-**					PduIdType CanIfTxSduId,                                      **
-**				    Can_IdType CanId                                             **
+**					PduIdType TxPduId,                                           **
+**				    const PduInfoType* PduInfoPtr                                **
 **				  )                                                              **
 **																				 **
 **  Description : This API 													     **
-**				 -reconfigures the corresponding CAN identifier					 **
-**				  of the requested CAN L-PDU.                                    **
+**				 -requests the transmission of a Tx L-PDU, the L-PDU is 	 	 **
+**				  passed to Can_Write() on its hardware transmit handle.         **
+**				 -The HTH, controller and DLC of the L-PDU are resolved by the   **
+**				  generator, the call is a single indexed configuration access.  **
 **                                                        						 **
-**	Service ID:   0x0C                            						    	 **
+**	Service ID:   0x49                            						    	 **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
-**  Reentrancy:   Non Reentrant                                            		 **
+**  Reentrancy:   Reentrant                                            		 	 **
 **                                                        						 **
-**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
-**				     CanId        - CAN ID of CAN L-SDU.                		 **
+**	Parameters (in): TxPduId    - L-SDU handle to be transmitted.       		 **
+**				     PduInfoPtr - Length and data of the L-SDU.            		 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
 **                                                   						 	 **                                  
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    	NA											        	 **									
+**	Return value:    E_OK     - Transmit request accepted by the CAN driver	 **
+**					 E_NOT_OK - Transmit request not accepted				     **
 **                                                       						 **                                  
 ***********************************************************************************/
-FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_Transmit
 (
-	PduIdType CanIfTxSduId,
-	Can_IdType CanId
+	PduIdType TxPduId,
+	const PduInfoType* PduInfoPtr
 )
 {
-	/* Pointer to point to the TxPduData */
-	CanIfTxPduCfgType* CanIfTxPduCfg;
+	/* Variable to hold the Api return value */
+	Std_ReturnType RetVal = E_NOT_OK;
 	
-#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Configuration of the requested Tx L-PDU */
+	const CanIfTxPduCfgType* TxPduCfg;
 	
-	/* Variable to Hold the API's Error State */
-	Std_ReturnType ErrorState = E_OK;
+	/* L-PDU handed to the CAN driver */
+	Can_PduType CanPdu;
+	
+	/* Padded copy of L-SDUs shorter than the configured DLC */
+	uint8 PaddedSdu[CANIF_TX_MAX_DLC];
 	
+	/* Loop index over the padded bytes */
+	uint8 ByteIndex;
+	
+	/* Result of the CAN driver */
+	Can_ReturnType CanRet;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
 	if( CanInitState == CANIF_UNINITIALIZED )
 	{
 	/*	
@@ -316,91 +596,2780 @@ FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId
 	*/	
 		Det_ReportError(CANIF_MODULE_ID  ,
 						CANIF_INSTANCE_ID,
-						CANIF_SETDYNAMICTXID_SID,
+						CANIF_TRANSMIT_SID,
 						CANIF_E_UNINIT);
 						
-	/*
-		[SWS_CANIF_00355] If CanIf was not initialized before calling
-		The Api, then the Api shall not execute a reconfiguration of Tx CanId.
-	*/					
 		/* Set the API Errorstate to E_NOT_OK */
 		ErrorState = E_NOT_OK;				
 	}
-	else if( CanIfCheckTxId(CanIfTxSduId) != CANIF_OK)
+	else if( CanIfCheckTxId(TxPduId) != CANIF_OK)
 	{
-		
 	/*	
-		[SWS_CANIF_00352] If parameter CanIfTxSduId of The Api has an invalid value,
-		CanIf shall report development	error code CANIF_E_INVALID_TXPDUID to 
-		the Det_ReportError service of the DET module, when Api is called.
-	*/		
+		[SWS_CANIF_00319] If parameter TxPduId of CanIf_Transmit() has an invalid value,
+		CanIf shall report development error code CANIF_E_INVALID_TXPDUID to the
+		Det_ReportError service of the DET, when CanIf_Transmit() is called.
+	*/	
 		Det_ReportError(CANIF_MODULE_ID  ,
 						CANIF_INSTANCE_ID,
-						CANIF_SETDYNAMICTXID_SID,
+						CANIF_TRANSMIT_SID,
 						CANIF_E_INVALID_TXPDUID);
 						
-						
 		/* Set the API Errorstate to E_NOT_OK */
 		ErrorState = E_NOT_OK;		
 	}
-	else if (CanIfCheckCanId(CanId) != CANIF_OK )
+	else if( (NULL_PTR == PduInfoPtr) || 
+			((NULL_PTR == PduInfoPtr->SduDataPtr) && (0u != PduInfoPtr->SduLength)) )
 	{
-		
 	/*	
-		[SWS_CANIF_00353] d If parameter CanId of API has an invalid value,
-		CanIf shall report development error code CANIF_E_PARAM_CANID to the
-		Det_ReportError service of the DET module, when The Api is called.
-	*/		
+		[SWS_CANIF_00320] If parameter PduInfoPtr of CanIf_Transmit() has an invalid value,
+		CanIf shall report development error code CANIF_E_PARAM_POINTER to the
+		Det_ReportError service of the DET, when CanIf_Transmit() is called.
+	*/	
 		Det_ReportError(CANIF_MODULE_ID  ,
 						CANIF_INSTANCE_ID,
-						CANIF_SETDYNAMICTXID_SID,
-						CANIF_E_PARAM_CANID);
+						CANIF_TRANSMIT_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( (PduInfoPtr->SduLength > CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduId].CanIfTxPduDlc) &&
+			 (CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduId].CanIfTxPduTruncation != TRUE) )
+	{
+	/*	
+		[SWS_CANIF_00894] If the L-SDU is longer than the configured DLC and truncation
+		is disabled for the L-PDU, CanIf shall report development error code
+		CANIF_E_DATA_LENGTH_MISMATCH and reject the transmit request.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_TRANSMIT_SID,
+						CANIF_E_DATA_LENGTH_MISMATCH);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		TxPduCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduId]);
+		
+		/* Longer L-SDUs are only sent when the L-PDU allows truncation */
+		if( (PduInfoPtr->SduLength <= TxPduCfg->CanIfTxPduDlc) || (TxPduCfg->CanIfTxPduTruncation == TRUE) )
+		{
+			CanPdu.swPduHandle = TxPduId;
+			CanPdu.length      = TxPduCfg->CanIfTxPduDlc;
+			
+			/* The CAN ID is read once, CanIf_SetDynamicTxId() may change it at any time */
+			CanPdu.id          = CanIfTxCanId(TxPduCfg);
+			
+			if(PduInfoPtr->SduLength >= TxPduCfg->CanIfTxPduDlc)
+			{
+				/* Full length or truncated L-SDU, the driver copies the first DLC bytes */
+				CanPdu.sdu = PduInfoPtr->SduDataPtr;
+			}
+			else
+			{
+				/* Short L-SDU, the unused bytes are filled with the padding value */
+				for(ByteIndex = 0u; ByteIndex < (uint8)PduInfoPtr->SduLength; ByteIndex++)
+				{
+					PaddedSdu[ByteIndex] = PduInfoPtr->SduDataPtr[ByteIndex];
+				}
+				
+				for(; ByteIndex < TxPduCfg->CanIfTxPduDlc; ByteIndex++)
+				{
+					PaddedSdu[ByteIndex] = CANIF_TX_PADDING_VALUE;
+				}
+				
+				CanPdu.sdu = PaddedSdu;
+			}
+			
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+			/* 
+				Enter Critical section, a Tx confirmation between a busy Can_Write() and
+				the buffering would leave the L-PDU in the buffer without a free object.
+			*/
+			irq_Disable();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+			if(CAN_CS_STARTED == CtrlState[TxPduCfg->CanIfTxPduCtrlId].Mode)
+			{
+				CanRet = Can_Write(TxPduCfg->CanIfTxPduHoh, &CanPdu);
+			}
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+			else if( (TRUE == CtrlState[TxPduCfg->CanIfTxPduCtrlId].BusOff) &&
+					 (CanIf_ConfigPtr->CanIfInitCfgObj->CanIfCtrlCfgObj[TxPduCfg->CanIfTxPduCtrlId].CanIfCtrlBusOffTxBuffers ==
+					  CANIF_BUSOFF_RETAIN_TX_BUFFERS) )
+			{
+				/* Buffered during the bus-off, sent once the recovery has restarted the controller */
+				CanRet = CAN_BUSY;
+			}
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+			else
+			{
+				/* Nothing reaches the CAN driver while the controller is not started */
+				CanRet = CAN_NOT_OK;
+			}
+			
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+			/*
+				[SWS_CANIF_00381] If Can_Write() returns CAN_BUSY the L-PDU is buffered,
+				it is sent from CanIf_TxConfirmation() in CAN ID priority order.
+			*/
+			if((CAN_BUSY == CanRet) && (E_OK == CanIfTxBufferInsert(TxPduId, &CanPdu)))
+			{
+				CanRet = CAN_OK;
+			}
+			
+			/* Exit Critical section */
+			irq_Enable();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+			if(CAN_OK == CanRet)
+			{
+				RetVal = E_OK;
+			}
+		}
+	}
+	
+	return (RetVal);
+}
+
+/*
+	[SWS_CANIF_00335] This API can be enabled or disabled at pre-compile time 
+	configuration globally by the parameter	CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API
+*/	
+#if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_ReadTxNotifStatus                     					 **
+**	                                                      						 **
+**	Syntax:	   FUNC( CanIf_NotifStatusType, CANIF_CODE ) CanIf_ReadTxNotifStatus **		    		 
+**			   (																 **
+** 				  PduIdType CanIfTxSduId,                                        **
+**			   )                                                                 **
+**																				 **
+**  Description : This API 													     **
+**				 -Reads the confirmation status of a specific static or 		 **
+**				 dynamic CAN Tx L-PDU, requested by the CanIfTxSduId.            **
+**				 -The status bit is read and cleared in one exclusive access,	 **
+**				 a confirmation in between is never lost.						 **
+**                                                        						 **
+**	Service ID:   0x07                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           		
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    RetVal- the confirmation status Of Tx L-PDU 				 **
+**					 CANIF_NO_NOTIFICATION				 					     **
+**                   CANIF_TX_RX_NOTIFICATION                				     **											 
+**                                                       						 **                                  				
+***********************************************************************************/
+FUNC( CanIf_NotifStatusType, CANIF_CODE) CanIf_ReadTxNotifStatus(PduIdType CanIfTxSduId)
+{
+	/* Variable to hold the Api return value */
+	CanIf_NotifStatusType RetVal  = CANIF_NO_NOTIFICATION;
+		
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READTXNOTIFSTATUS_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckTxId(CanIfTxSduId) != CANIF_OK)
+	{
+	/*	
+		[SWS_CANIF_00331] If parameter CanIfTxSduId of The Api is out of range
+		CanIf shall report development error code CANIF_E_INVALID_TXPDUID to
+		the Det_ReportError service of the DET when The Api is called
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READTXNOTIFSTATUS_SID,
+						CANIF_E_INVALID_TXPDUID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if((CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[CanIfTxSduId].CanIfTxPduReadNotifyStatus) != TRUE)
+	{
+		
+	/*	
+		[SWS_CANIF_00331] If parameter CanIfTxSduId of The Api has no status 
+		information was configured for this CAN Tx L-SDU, CanIf shall report
+		development error code CANIF_E_INVALID_TXPDUID to the Det_ReportError
+		service of the DET when The Api is called
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READTXNOTIFSTATUS_SID,
+						CANIF_E_INVALID_TXPDUID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;	
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		/*
+			[SWS_CANIF_00393] If configuration parameters CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API
+			and CANIF_TXPDU_READ_NOTIFYSTATUS for the transmitted L-SDU are set to TRUE, 
+			and if CanIf_ReadTxNotifStatus() is called, the CanIf shall reset the notification status
+			for the transmitted L-SDU.
+		*/
+		if(CanIfNotifFetchClear(&TxNotifStatus[CanIfTxSduId >> 5u], ((uint32)1u << (CanIfTxSduId & 31u))) != 0u)
+		{
+			RetVal = CANIF_TX_RX_NOTIFICATION;
+		}
+	}
+	
+	/* return the Tx L-SDU NotifyStatus Value */
+	return RetVal;
+}
+
+/**********************************************************************************
+**	Service name: CanIf_ReadTxNotifStatusGroup                   				 **
+**	                                                      						 **
+**	Syntax:	      FUNC( uint32, CANIF_CODE ) CanIf_ReadTxNotifStatusGroup	 	 **
+**				  (																 **
+**					uint16 Group	                                             **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reads and clears the confirmation status of the 32 Tx L-PDUs	 **
+**				  Group * 32 .. Group * 32 + 31 in one exclusive access, bit n	 **
+**				  of the result is the status of Tx L-PDU Group * 32 + n.		 **
+**				 -L-PDUs without CanIfTxPduReadNotifyStatus always read 0.		 **
+**                                                        						 **
+**	Service ID:   0x81 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): Group - Status word, below CANIF_TX_NOTIF_GROUPS.			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	Confirmation status bits of the group			       	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( uint32, CANIF_CODE ) CanIf_ReadTxNotifStatusGroup
+(
+	uint16 Group
+)
+{
+	/* Variable to hold the Api return value */
+	uint32 RetVal = 0u;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READTXNOTIFSTATUSGROUP_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( Group >= CANIF_TX_NOTIF_GROUPS )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READTXNOTIFSTATUSGROUP_SID,
+						CANIF_E_INVALID_TXPDUID);
 						
 		/* Set the API Errorstate to E_NOT_OK */
 		ErrorState = E_NOT_OK;		
 	}
-	/* (MISRA-C:2004 Rule 14.10 (required)) 
-	All if … else if constructs shall be terminated with an else clause. */
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		RetVal = CanIfNotifFetchClear(&TxNotifStatus[Group], 0xFFFFFFFFu);
+	}
+	
+	return (RetVal);
+}
+
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
+
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_ReadRxPduData                     					 	 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_ReadRxPduData	 	 **
+**				  (																 **
+**					PduIdType CanIfRxSduId,                                      **
+**					PduInfoType* CanIfRxInfoPtr                                  **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -copies the latest received L-SDU of the Rx L-PDU CanIfRxSduId	 **
+**				  to CanIfRxInfoPtr->SduDataPtr and sets its length.			 **
+**				 -The receive path writes the free one of two banks and then	 **
+**				  publishes it by incrementing the sequence of the L-PDU, the	 **
+**				  copy is repeated only if two newer frames of the same L-PDU	 **
+**				  were stored while it was taken, so it never mixes two frames	 **
+**				  and no interrupt lock is needed.								 **
+**                                                        						 **
+**	Service ID:   0x06                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfRxSduId - Receive L-SDU handle.			       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   CanIfRxInfoPtr - Buffer of at least CanIfRxPduDlc bytes **
+**									 	 and length of the copied L-SDU.		 **
+**                                                                               **
+**	Return value:    E_OK 	  - The latest L-SDU was copied.					 **
+**					 E_NOT_OK - No frame of the L-PDU was received yet.			 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_ReadRxPduData
+(
+	PduIdType CanIfRxSduId,
+	PduInfoType* CanIfRxInfoPtr
+)
+{
+	/* Variable to hold the Api return value */
+	Std_ReturnType RetVal = E_NOT_OK;
+	
+	/* Configuration of the Rx L-PDU */
+	const CanIfRxPduCfgType* RxPduCfg;
+	
+	/* Sequence of the L-PDU before and after the copy */
+	uint16 Before;
+	uint16 After;
+	
+	const uint8* Data;
+	uint8 Index;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXPDUDATA_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( (CanIfCheckRxId(CanIfRxSduId) != CANIF_OK) ||
+			 (CanIf_ConfigPtr->CanIfInitCfgObj->CanIfRxPduCfgObj[CanIfRxSduId].CanIfRxPduReadData != TRUE) )
+	{
+	/*	
+		The L-PDU is out of range or its data is not configured to be read
+		by CanIf_ReadRxPduData(), CanIf reports CANIF_E_INVALID_RXPDUID.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXPDUDATA_SID,
+						CANIF_E_INVALID_RXPDUID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( (NULL_PTR == CanIfRxInfoPtr) || (NULL_PTR == CanIfRxInfoPtr->SduDataPtr) )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXPDUDATA_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		RxPduCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfRxPduCfgObj[CanIfRxSduId]);
+		
+		After = RxDataSequence[CanIfRxSduId];
+		
+		/* Sequence 0, no frame of the L-PDU was received yet */
+		if(After != 0u)
+		{
+			do
+			{
+				Before = After;
+				
+				/* The bank published by Before is complete */
+				COMPILER_BARRIER();
+				
+				Data = &RxDataBank[Before & 1u][RxPduCfg->CanIfRxPduDataOffset];
+				
+				for(Index = 0u; Index < RxPduCfg->CanIfRxPduDlc; Index++)
+				{
+					CanIfRxInfoPtr->SduDataPtr[Index] = Data[Index];
+				}
+				
+				/* The sequence is read again only after the copy */
+				COMPILER_BARRIER();
+				
+				After = RxDataSequence[CanIfRxSduId];
+			}
+			/* One newer frame went to the other bank, a second one overwrote the bank being copied */
+			while((uint16)(After - Before) >= 2u);
+			
+			CanIfRxInfoPtr->SduLength = RxPduCfg->CanIfRxPduDlc;
+			
+			RetVal = E_OK;
+		}
+	}
+	
+	return (RetVal);
+}
+
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if(CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_ReadRxNotifStatus                     					 **
+**	                                                      						 **
+**	Syntax:	   FUNC( CanIf_NotifStatusType, CANIF_CODE ) CanIf_ReadRxNotifStatus **
+**			   (																 **
+** 				  PduIdType CanIfRxSduId                                         **
+**			   )                                                                 **
+**																				 **
+**  Description : This API 													     **
+**				 -Reads and resets the indication status of the Rx L-PDU		 **
+**				 CanIfRxSduId in one exclusive access, an indication in		 	 **
+**				 between is never lost.											 **
+**                                                        						 **
+**	Service ID:   0x08                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfRxSduId - Receive L-SDU handle.			       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    RetVal- the indication status Of Rx L-PDU 					 **
+**					 CANIF_NO_NOTIFICATION				 					     **
+**                   CANIF_TX_RX_NOTIFICATION                				     **
+**                                                       						 **
+***********************************************************************************/
+FUNC( CanIf_NotifStatusType, CANIF_CODE) CanIf_ReadRxNotifStatus(PduIdType CanIfRxSduId)
+{
+	/* Variable to hold the Api return value */
+	CanIf_NotifStatusType RetVal  = CANIF_NO_NOTIFICATION;
+		
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXNOTIFSTATUS_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( (CanIfCheckRxId(CanIfRxSduId) != CANIF_OK) ||
+			 (CanIf_ConfigPtr->CanIfInitCfgObj->CanIfRxPduCfgObj[CanIfRxSduId].CanIfRxPduReadNotifyStatus != TRUE) )
+	{
+	/*	
+		The L-PDU is out of range or no status information is configured
+		for it, CanIf reports CANIF_E_INVALID_RXPDUID.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXNOTIFSTATUS_SID,
+						CANIF_E_INVALID_RXPDUID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		if(CanIfNotifFetchClear(&RxNotifStatus[CanIfRxSduId >> 5u], ((uint32)1u << (CanIfRxSduId & 31u))) != 0u)
+		{
+			RetVal = CANIF_TX_RX_NOTIFICATION;
+		}
+	}
+	
+	/* return the Rx L-SDU NotifyStatus Value */
+	return RetVal;
+}
+
+/**********************************************************************************
+**	Service name: CanIf_ReadRxNotifStatusGroup                   				 **
+**	                                                      						 **
+**	Syntax:	      FUNC( uint32, CANIF_CODE ) CanIf_ReadRxNotifStatusGroup	 	 **
+**				  (																 **
+**					uint16 Group	                                             **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reads and clears the indication status of the 32 Rx L-PDUs	 **
+**				  Group * 32 .. Group * 32 + 31 in one exclusive access, bit n	 **
+**				  of the result is the status of Rx L-PDU Group * 32 + n.		 **
+**				 -L-PDUs without CanIfRxPduReadNotifyStatus always read 0.		 **
+**                                                        						 **
+**	Service ID:   0x82 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): Group - Status word, below CANIF_RX_NOTIF_GROUPS.			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	Indication status bits of the group			       		 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( uint32, CANIF_CODE ) CanIf_ReadRxNotifStatusGroup
+(
+	uint16 Group
+)
+{
+	/* Variable to hold the Api return value */
+	uint32 RetVal = 0u;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXNOTIFSTATUSGROUP_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( Group >= CANIF_RX_NOTIF_GROUPS )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_READRXNOTIFSTATUSGROUP_SID,
+						CANIF_E_INVALID_RXPDUID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		RetVal = CanIfNotifFetchClear(&RxNotifStatus[Group], 0xFFFFFFFFu);
+	}
+	
+	return (RetVal);
+}
+
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+/**********************************************************************************
+**	Service name: CanIf_TxConfirmation                        					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_TxConfirmation	    		 **
+**				  (																 **
+**					PduIdType CanTxPduId                                         **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver after the L-PDU CanTxPduId has 	 **
+**				  been transmitted, the freed hardware object is refilled from   **
+**				  the Tx buffer of its HTH.                                      **
+**                                                        						 **
+**	Service ID:   0x13                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): CanTxPduId - L-PDU handle of the transmitted L-PDU.  		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_TxConfirmation
+(
+	PduIdType CanTxPduId
+)
+{
+	/* Configuration of the transmitted Tx L-PDU */
+	const CanIfTxPduCfgType* TxPduCfg;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_TXCONFIRMATION_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckTxId(CanTxPduId) != CANIF_OK)
+	{
+	/*	
+		[SWS_CANIF_00410] If parameter CanTxPduId of CanIf_TxConfirmation() has an invalid value,
+		CanIf shall report development error code CANIF_E_PARAM_LPDU to the
+		Det_ReportError service of the DET.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_TXCONFIRMATION_SID,
+						CANIF_E_PARAM_LPDU);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		TxPduCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[CanTxPduId]);
+		
+#if(CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON)
+		/*
+			[SWS_CANIF_00391] If CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API is enabled,
+			CanIf shall set the notification status of the transmitted L-PDU.
+		*/
+		if(TxPduCfg->CanIfTxPduReadNotifyStatus == TRUE)
+		{
+			CanIfNotifSet(&TxNotifStatus[CanTxPduId >> 5u], ((uint32)1u << (CanTxPduId & 31u)));
+		}
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API */
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		/* Enter Critical section */
+		irq_Disable();
+		
+		/* [SWS_CANIF_00386] The freed hardware object takes the highest priority buffered L-PDU */
+		CanIfTxBufferSend(TxPduCfg->CanIfTxPduHthIdRef);
+		
+		/* 
+		   The first frame sent after a bus-off ends its recovery, in the same section as
+		   CanIf_ControllerBusOff() and CanIf_MainFunctionBusOff() update the recovery state
+		*/
+		CanIfBusOffEnd(TxPduCfg->CanIfTxPduCtrlId);
+		
+		/* Exit Critical section */
+		irq_Enable();
+#else
+		/* 
+		   The first frame sent after a bus-off ends its recovery, the lock is only
+		   taken then, not on every confirmation of a running controller
+		*/
+		if(TRUE == CtrlState[TxPduCfg->CanIfTxPduCtrlId].BusOff)
+		{
+			/* Enter Critical section */
+			irq_Disable();
+			
+			CanIfBusOffEnd(TxPduCfg->CanIfTxPduCtrlId);
+			
+			/* Exit Critical section */
+			irq_Enable();
+		}
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+		
+		/* [SWS_CANIF_00383] Notify the upper layer of the transmitted L-PDU */
+		if(NULL_PTR != TxPduCfg->CanIfTxPduUserTxConfirmationUL)
+		{
+			TxPduCfg->CanIfTxPduUserTxConfirmationUL(TxPduCfg->CanIfTxPduUlId, E_OK);
+		}
+	}
+}
+
+/**********************************************************************************
+**	Service name: CanIf_RxIndication                          					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_RxIndication	    		 	 **
+**				  (																 **
+**					const Can_HwType* Mailbox,                                   **
+**					const PduInfoType* PduInfoPtr                                **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver after a frame was received, the 	 **
+**				  HRH and CAN ID of the frame are resolved to the Rx L-PDU and   **
+**				  the upper layer is notified.                                   **
+**				 -The HOH is mapped to its HRH by a table and the CAN ID is	 	 **
+**				  searched in the sorted CAN ID ranges of the HRH, the lookup	 **
+**				  takes at most log2(CANIF_MAX_RX_IDS_PER_HRH + 1) steps.		 **
+**				 -With CANIF_RX_DEFERRED_PROCESSING the frame is only copied to	 **
+**				  the Rx queue and resolved later by CanIf_MainFunctionRx(),	 **
+**				  the receive interrupts of all controllers shall then run at	 **
+**				  the same priority so they never preempt each other.			 **
+**                                                        						 **
+**	Service ID:   0x14                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): Mailbox    - CAN ID, HOH and controller of the frame. 		 **
+**				     PduInfoPtr - Length and data of the received L-SDU. 		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_RxIndication
+(
+	const Can_HwType* Mailbox,
+	const PduInfoType* PduInfoPtr
+)
+{
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+	/* Timer value at entry, the duration is taken at exit */
+	uint32 StartTime = GET_PORT(CANIF_RX_ISR_TIMESTAMP_ADDRESS);
+	uint32 Duration;
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_RXINDICATION_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( (NULL_PTR == Mailbox) || (NULL_PTR == PduInfoPtr) ||
+			((NULL_PTR == PduInfoPtr->SduDataPtr) && (0u != PduInfoPtr->SduLength)) )
+	{
+	/*	
+		[SWS_CANIF_00419] If parameter Mailbox or PduInfoPtr of CanIf_RxIndication() has
+		an invalid value, CanIf shall report development error code CANIF_E_PARAM_POINTER.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_RXINDICATION_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( (Mailbox->Hoh >= CANIF_NUM_OF_HOHS) ||
+			 (CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHohToHrh[Mailbox->Hoh] == CANIF_INVALID_HRH) )
+	{
+	/*	
+		[SWS_CANIF_00416] If parameter Mailbox->Hoh of CanIf_RxIndication() has an invalid value,
+		CanIf shall report development error code CANIF_E_PARAM_HOH.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_RXINDICATION_SID,
+						CANIF_E_PARAM_HOH);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( CanIfCheckCanId((Can_IdType)(Mailbox->CanId & ~CAN_ID_TYPE_FD)) != CANIF_OK )
+	{
+	/*	
+		[SWS_CANIF_00417] If parameter Mailbox->CanId of CanIf_RxIndication() has an invalid value,
+		CanIf shall report development error code CANIF_E_PARAM_CANID.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_RXINDICATION_SID,
+						CANIF_E_PARAM_CANID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( PduInfoPtr->SduLength > CANIF_RX_MAX_LENGTH )
+	{
+	/*	
+		[SWS_CANIF_00418] If parameter PduInfoPtr->SduLength of CanIf_RxIndication() has an
+		invalid value, CanIf shall report development error code CANIF_E_PARAM_DLC.
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_RXINDICATION_SID,
+						CANIF_E_PARAM_DLC);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+		CanIfRxQueuePush(Mailbox, PduInfoPtr);
+#else
+		CanIfRxProcess(Mailbox->Hoh, Mailbox->CanId, PduInfoPtr);
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	}
+	
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+	Duration = (uint32)(GET_PORT(CANIF_RX_ISR_TIMESTAMP_ADDRESS) - StartTime);
+	
+	RxIsrTimeLast = Duration;
+	
+	if(Duration > RxIsrTimeMax)
+	{
+		RxIsrTimeMax = Duration;
+	}
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+}
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_MainFunctionRx                     					 	 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_MainFunctionRx( void )		 	 **
+**																				 **
+**  Description : This API 													     **
+**				 -processes up to CANIF_RX_MAIN_FUNCTION_BUDGET frames queued by **
+**				  CanIf_RxIndication(), oldest first: the CAN ID is resolved to	 **
+**				  its Rx L-PDU and the upper layer is notified in task context.	 **
+**				 -Shall be called cyclically from one task only.				 **
+**                                                        						 **
+**	Service ID:   NA (vendor specific, no DET checks)                  	    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): NA											       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_MainFunctionRx( void )
+{
+	/* L-SDU of the queued frame passed to the upper layer */
+	PduInfoType PduInfo;
+	
+	RxQueueEntryType* Entry;
+	uint16 Tail;
+	uint16 Count;
+	
+	if(CanInitState == CANIF_INITIALIZED)
+	{
+		/* Only this API writes the tail, the head is read once so a whole batch is taken */
+		Tail  = RxQueueTail;
+		Count = (uint16)(RxQueueHead - Tail);
+		
+		/* The frames up to the head are complete, the ISR publishes the head after the frame */
+		COMPILER_BARRIER();
+		
+		if(Count > CANIF_RX_MAIN_FUNCTION_BUDGET)
+		{
+			Count = CANIF_RX_MAIN_FUNCTION_BUDGET;
+		}
+		
+		while(Count > 0u)
+		{
+			/* The frame is processed in place, its slot is handed back afterwards */
+			Entry = &RxQueue[Tail & (CANIF_RX_QUEUE_SIZE - 1u)];
+			
+			PduInfo.SduDataPtr = Entry->Data;
+			PduInfo.SduLength  = Entry->Length;
+			
+			CanIfRxProcess(Entry->Hoh, Entry->CanId, &PduInfo);
+			
+			COMPILER_BARRIER();
+			
+			Tail++;
+			RxQueueTail = Tail;
+			Count--;
+		}
+	}
+}
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if ((CANIF_RX_DEFERRED_PROCESSING == STD_ON) || (CANIF_RX_ISR_MEASUREMENT == STD_ON))
+/**********************************************************************************
+**	Service name: CanIf_GetRxStatistics                     					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_GetRxStatistics			 	 **
+**				  (																 **
+**					CanIf_RxStatisticsType* StatisticsPtr                        **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -copies the Rx queue overflow count and high watermark and the	 **
+**				  last and longest CanIf_RxIndication() duration, all counted	 **
+**				  since CanIf_Init(). The fields are read one by one while the	 **
+**				  receive interrupt may update them.							 **
+**                                                        						 **
+**	Service ID:   0x80 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): NA											       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   StatisticsPtr - Receive path statistics.				 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_GetRxStatistics
+(
+	CanIf_RxStatisticsType* StatisticsPtr
+)
+{
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETRXSTATISTICS_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( NULL_PTR == StatisticsPtr )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETRXSTATISTICS_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+		StatisticsPtr->QueueOverflows	  = RxQueueOverflow;
+		StatisticsPtr->QueueHighWatermark = RxQueueHighWatermark;
+#else
+		StatisticsPtr->QueueOverflows	  = 0u;
+		StatisticsPtr->QueueHighWatermark = 0u;
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+		StatisticsPtr->IsrTimeLast = RxIsrTimeLast;
+		StatisticsPtr->IsrTimeMax  = RxIsrTimeMax;
+#else
+		StatisticsPtr->IsrTimeLast = 0u;
+		StatisticsPtr->IsrTimeMax  = 0u;
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+	}
+}
+#endif /* CANIF_RX_DEFERRED_PROCESSING || CANIF_RX_ISR_MEASUREMENT */
+
+/**********************************************************************************
+**	Service name: CanIf_SetControllerMode                      					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_SetControllerMode	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**				    Can_ControllerStateType ControllerMode                       **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -requests the mode ControllerMode of the CAN controller from	 **
+**				  the CAN driver, the mode is taken over when the driver calls	 **
+**				  CanIf_ControllerModeIndication().								 **
+**				 -STOPPED or SLEEP ends a running bus-off recovery, STARTED		 **
+**				  during a bus-off restarts the controller at once.				 **
+**                                                        						 **
+**	Service ID:   0x03                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Asynchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant (Not for the same controller)                  		 **
+**                                                        						 **
+**	Parameters (in): ControllerId   - CAN controller.                   		 **
+**				     ControllerMode - CAN_CS_STARTED, CAN_CS_STOPPED or		 	 **
+**				                      CAN_CS_SLEEP.                   		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    E_OK     - Mode request accepted by the CAN driver		 	 **
+**					 E_NOT_OK - Mode request not accepted				     	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_SetControllerMode
+(
+	uint8 ControllerId,
+	Can_ControllerStateType ControllerMode
+)
+{
+	/* Variable to hold the Api return value */
+	Std_ReturnType RetVal = E_NOT_OK;
+	
+	/* Transition requested from the CAN driver */
+	Can_StateTransitionType Transition;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETCONTROLLERMODE_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckCtrlId(ControllerId) != CANIF_OK )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETCONTROLLERMODE_SID,
+						CANIF_E_PARAM_CONTROLLERID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( (ControllerMode != CAN_CS_STARTED) && (ControllerMode != CAN_CS_STOPPED) &&
+			 (ControllerMode != CAN_CS_SLEEP) )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETCONTROLLERMODE_SID,
+						CANIF_E_PARAM_CTRLMODE);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		if(CAN_CS_STARTED == ControllerMode)
+		{
+			Transition = CAN_T_START;
+			
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+			/* Enter Critical section */
+			irq_Disable();
+			
+			/* A restart requested during a bus-off counts as an attempt of the recovery */
+			if(TRUE == CtrlState[ControllerId].BusOff)
+			{
+				CtrlState[ControllerId].Statistics.RestartAttempts++;
+				
+				if(CtrlState[ControllerId].RestartCount < 0xFFu)
+				{
+					CtrlState[ControllerId].RestartCount++;
+				}
+				
+				CanIfBusOffRestartDelay(ControllerId);
+			}
+			
+			/* Exit Critical section */
+			irq_Enable();
+#endif /* CANIF_BUSOFF_RECOVERY */
+		}
+		else
+		{
+			if(CAN_CS_SLEEP == ControllerMode)
+			{
+				Transition = CAN_T_SLEEP;
+			}
+			else if(CAN_CS_SLEEP == CtrlState[ControllerId].Mode)
+			{
+				Transition = CAN_T_WAKEUP;
+			}
+			else
+			{
+				Transition = CAN_T_STOP;
+			}
+			
+			/* Enter Critical section */
+			irq_Disable();
+			
+			/* The upper layer takes the controller over, the Tx buffers are flushed on the mode indication */
+			CtrlState[ControllerId].BusOff = FALSE;
+			
+			/* Exit Critical section */
+			irq_Enable();
+		}
+		
+		if(CAN_OK == Can_SetControllerMode(ControllerId, Transition))
+		{
+			RetVal = E_OK;
+		}
+	}
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: CanIf_GetControllerMode                      					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( Std_ReturnType, CANIF_CODE ) CanIf_GetControllerMode	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**				    Can_ControllerStateType* ControllerModePtr                   **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reads the mode of the CAN controller last indicated by the	 **
+**				  CAN driver or set by a bus-off, CAN_CS_STOPPED after			 **
+**				  CanIf_Init().													 **
+**                                                        						 **
+**	Service ID:   0x04                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller.                   		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   ControllerModePtr - Mode of the controller.			 **
+**                                                                               **
+**	Return value:    E_OK     - Mode read									 	 **
+**					 E_NOT_OK - Mode not read						     	 	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( Std_ReturnType, CANIF_CODE ) CanIf_GetControllerMode
+(
+	uint8 ControllerId,
+	Can_ControllerStateType* ControllerModePtr
+)
+{
+	/* Variable to hold the Api return value */
+	Std_ReturnType RetVal = E_NOT_OK;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETCONTROLLERMODE_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckCtrlId(ControllerId) != CANIF_OK )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETCONTROLLERMODE_SID,
+						CANIF_E_PARAM_CONTROLLERID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( NULL_PTR == ControllerModePtr )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETCONTROLLERMODE_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		*ControllerModePtr = CtrlState[ControllerId].Mode;
+		
+		RetVal = E_OK;
+	}
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: CanIf_ControllerBusOff                      					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_ControllerBusOff	    		 **
+**				  (																 **
+**					uint8 ControllerId                                           **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver when the controller went bus-off,	 **
+**				  the controller is stopped, its Tx buffers are flushed or		 **
+**				  retained per CanIfCtrlBusOffTxBuffers and the recovery		 **
+**				  schedule of CanIf_MainFunctionBusOff() starts.				 **
+**				 -A bus-off before the first Tx confirmation after the restart	 **
+**				  continues the running recovery.								 **
+**                                                        						 **
+**	Service ID:   0x16                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller in bus-off.		  		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_ControllerBusOff
+(
+	uint8 ControllerId
+)
+{
+	/* Configuration of the controller */
+	const CanIfCtrlCfgType* CtrlCfg;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_CONTROLLERBUSOFF_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckCtrlId(ControllerId) != CANIF_OK )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_CONTROLLERBUSOFF_SID,
+						CANIF_E_PARAM_CONTROLLERID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		CtrlCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfCtrlCfgObj[ControllerId]);
+		
+		/* Enter Critical section, CanIf_Transmit() sees the stopped controller and the flushed buffers together */
+		irq_Disable();
+		
+		/* The controller left the bus, it is stopped until the restart */
+		CtrlState[ControllerId].Mode = CAN_CS_STOPPED;
+		
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+		if(FALSE == CtrlState[ControllerId].BusOff)
+		{
+			CtrlState[ControllerId].Statistics.BusOffCount++;
+			CtrlState[ControllerId].BusOffStart = BusOffTick;
+			CtrlState[ControllerId].RestartCount = 0u;
+		}
+		
+		CanIfBusOffRestartDelay(ControllerId);
+#endif /* CANIF_BUSOFF_RECOVERY */
+		
+		CtrlState[ControllerId].BusOff = TRUE;
+		
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		if(CtrlCfg->CanIfCtrlBusOffTxBuffers == CANIF_BUSOFF_FLUSH_TX_BUFFERS)
+		{
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+			CtrlState[ControllerId].Statistics.FlushedTxPdus += CanIfTxBufferFlush(ControllerId);
+#else
+			(void)CanIfTxBufferFlush(ControllerId);
+#endif /* CANIF_BUSOFF_RECOVERY */
+		}
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+		
+		/* Exit Critical section */
+		irq_Enable();
+		
+		if(NULL_PTR != CtrlCfg->CanIfCtrlUserBusOffUL)
+		{
+			CtrlCfg->CanIfCtrlUserBusOffUL(ControllerId);
+		}
+	}
+}
+
+/**********************************************************************************
+**	Service name: CanIf_ControllerModeIndication              					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_ControllerModeIndication	 	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**					Can_ControllerStateType ControllerMode                       **
+**				  )                                                              **
+**																				 **
+**  Description : This callback 											     **
+**				 -is called by the CAN driver when the controller reached the	 **
+**				  mode requested by Can_SetControllerMode(). STARTED sends the	 **
+**				  retained Tx L-PDUs, a requested STOPPED or SLEEP flushes the	 **
+**				  Tx buffers of the controller.									 **
+**                                                        						 **
+**	Service ID:   0x17                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId   - CAN controller.		  		 			 **
+**				     ControllerMode - Mode the controller reached.		 		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_ControllerModeIndication
+(
+	uint8 ControllerId,
+	Can_ControllerStateType ControllerMode
+)
+{
+	/* Configuration of the controller */
+	const CanIfCtrlCfgType* CtrlCfg;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_CONTROLLERMODEINDICATION_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckCtrlId(ControllerId) != CANIF_OK )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_CONTROLLERMODEINDICATION_SID,
+						CANIF_E_PARAM_CONTROLLERID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( (ControllerMode != CAN_CS_STARTED) && (ControllerMode != CAN_CS_STOPPED) &&
+			 (ControllerMode != CAN_CS_SLEEP) )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_CONTROLLERMODEINDICATION_SID,
+						CANIF_E_PARAM_CTRLMODE);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		CtrlCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfCtrlCfgObj[ControllerId]);
+		
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		/* Enter Critical section */
+		irq_Disable();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+		
+		CtrlState[ControllerId].Mode = ControllerMode;
+		
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		if(CAN_CS_STARTED == ControllerMode)
+		{
+			/* L-PDUs retained over a bus-off go out first, in CAN ID order */
+			CanIfTxBufferResume(ControllerId);
+		}
+		else if(FALSE == CtrlState[ControllerId].BusOff)
+		{
+			/* A stop requested by the upper layer drops the pending L-PDUs */
+			(void)CanIfTxBufferFlush(ControllerId);
+		}
+		/* (MISRA-C:2004 Rule 14.10 (required)) 
+		All if … else if constructs shall be terminated with an else clause. */
+		else
+		{
+			
+		}
+		
+		/* Exit Critical section */
+		irq_Enable();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+		
+		if(NULL_PTR != CtrlCfg->CanIfCtrlUserModeIndicationUL)
+		{
+			CtrlCfg->CanIfCtrlUserModeIndicationUL(ControllerId, ControllerMode);
+		}
+	}
+}
+
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_MainFunctionBusOff                     					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_MainFunctionBusOff( void )	 **
+**																				 **
+**  Description : This API 													     **
+**				 -restarts the controllers in bus-off: the first				 **
+**				  CanIfCtrlFastRecoveryAttempts restarts follow each other		 **
+**				  after CanIfCtrlFastRecoveryTicks calls, the later ones after	 **
+**				  CanIfCtrlSlowRecoveryTicks calls.								 **
+**				 -Can_SetControllerMode() is called outside the critical		 **
+**				  section, the driver may indicate the new mode from inside it.	 **
+**                                                        						 **
+**	Service ID:   NA (vendor specific, no DET checks)                  	    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): NA											       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_MainFunctionBusOff( void )
+{
+	/* Loop index over the controllers */
+	uint8 ControllerId;
+	
+	/* The restart delay of the controller elapsed in this call */
+	boolean Restart;
+	
+	if(CanInitState == CANIF_INITIALIZED)
+	{
+		BusOffTick++;
+		
+		for(ControllerId = 0u; ControllerId < CANIF_NUM_OF_CONTROLLERS; ControllerId++)
+		{
+			Restart = FALSE;
+			
+			/* Controllers on the bus cost one read */
+			if(TRUE == CtrlState[ControllerId].BusOff)
+			{
+				/* Enter Critical section */
+				irq_Disable();
+				
+				/* The delay runs while the controller is not started, a started one waits for its first confirmation */
+				if( (TRUE == CtrlState[ControllerId].BusOff) && (CAN_CS_STARTED != CtrlState[ControllerId].Mode) &&
+					(0u != CtrlState[ControllerId].RestartTimer) )
+				{
+					CtrlState[ControllerId].RestartTimer--;
+					
+					if(0u == CtrlState[ControllerId].RestartTimer)
+					{
+						Restart = TRUE;
+						
+						CtrlState[ControllerId].Statistics.RestartAttempts++;
+						
+						if(CtrlState[ControllerId].RestartCount < 0xFFu)
+						{
+							CtrlState[ControllerId].RestartCount++;
+						}
+						
+						/* Retried after the next delay if the controller does not start */
+						CanIfBusOffRestartDelay(ControllerId);
+					}
+				}
+				
+				/* Exit Critical section */
+				irq_Enable();
+			}
+			
+			if(TRUE == Restart)
+			{
+				(void)Can_SetControllerMode(ControllerId, CAN_T_START);
+			}
+		}
+	}
+}
+
+/**********************************************************************************
+**	Service name: CanIf_GetBusOffStatistics                    					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_GetBusOffStatistics		 	 **
+**				  (																 **
+**					uint8 ControllerId,                                          **
+**					CanIf_BusOffStatisticsType* StatisticsPtr                    **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -copies the bus-off count, restart attempts, flushed Tx		 **
+**				  L-PDUs and the last and longest recovery time of the			 **
+**				  controller, all counted since CanIf_Init().					 **
+**				 -The fields are copied in one critical section.				 **
+**                                                        						 **
+**	Service ID:   0x84 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                            		 	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller.                   		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   StatisticsPtr - Bus-off statistics of the controller.	 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_GetBusOffStatistics
+(
+	uint8 ControllerId,
+	CanIf_BusOffStatisticsType* StatisticsPtr
+)
+{
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETBUSOFFSTATISTICS_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckCtrlId(ControllerId) != CANIF_OK )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETBUSOFFSTATISTICS_SID,
+						CANIF_E_PARAM_CONTROLLERID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if( NULL_PTR == StatisticsPtr )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_GETBUSOFFSTATISTICS_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		/* Enter Critical section */
+		irq_Disable();
+		
+		StatisticsPtr->BusOffCount		= CtrlState[ControllerId].Statistics.BusOffCount;
+		StatisticsPtr->RestartAttempts	= CtrlState[ControllerId].Statistics.RestartAttempts;
+		StatisticsPtr->FlushedTxPdus	= CtrlState[ControllerId].Statistics.FlushedTxPdus;
+		StatisticsPtr->RecoveryTimeLast = CtrlState[ControllerId].Statistics.RecoveryTimeLast;
+		StatisticsPtr->RecoveryTimeMax	= CtrlState[ControllerId].Statistics.RecoveryTimeMax;
+		
+		/* Exit Critical section */
+		irq_Enable();
+	}
+}
+#endif /* CANIF_BUSOFF_RECOVERY */
+
+/*
+	[SWS_CANIF_00357] The function CanIf_SetDynamicTxId() shall be pre compile time configurable
+	On/Off by the configuration parameter CANIF_PUBLIC_SETDYNAMICTXID_API
+*/	
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIf_SetDynamicTxId                         					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId		    		 **
+**				  (																 **
+**					PduIdType CanIfTxSduId,                                      **
+**				    Can_IdType CanId                                             **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reconfigures the corresponding CAN identifier					 **
+**				  of the requested CAN L-PDU.                                    **
+**				 -Only L-PDUs of type CANIF_TXPDU_DYNAMIC can be reconfigured,	 **
+**				  the new CAN ID is kept in RAM until the next CanIf_Init().	 **
+**                                                        						 **
+**	Service ID:   0x0C                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
+**				     CanId        - CAN ID of CAN L-SDU.                		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                  
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **									
+**                                                       						 **                                  
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId
+(
+	PduIdType CanIfTxSduId,
+	Can_IdType CanId
+)
+{
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	
+	/* Variable to Hold the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+	
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETDYNAMICTXID_SID,
+						CANIF_E_UNINIT);
+						
+	/*
+		[SWS_CANIF_00355] If CanIf was not initialized before calling
+		The Api, then the Api shall not execute a reconfiguration of Tx CanId.
+	*/					
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( CanIfCheckDynamicTxId(CanIfTxSduId) != CANIF_OK)
+	{
+		
+	/*	
+		[SWS_CANIF_00352] If parameter CanIfTxSduId of The Api has an invalid value,
+		CanIf shall report development	error code CANIF_E_INVALID_TXPDUID to 
+		the Det_ReportError service of the DET module, when Api is called.
+		The CAN ID of an L-PDU of type CANIF_TXPDU_STATIC can't be changed.
+	*/		
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETDYNAMICTXID_SID,
+						CANIF_E_INVALID_TXPDUID);
+						
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	else if (CanIfCheckCanId(CanId) != CANIF_OK )
+	{
+		
+	/*	
+		[SWS_CANIF_00353] d If parameter CanId of API has an invalid value,
+		CanIf shall report development error code CANIF_E_PARAM_CANID to the
+		Det_ReportError service of the DET module, when The Api is called.
+	*/		
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETDYNAMICTXID_SID,
+						CANIF_E_PARAM_CANID);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		/* Enter Critical section, a buffered entry of the L-PDU is moved to its new priority */
+		irq_Disable();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+		
+		/* Without Tx buffering this is a single word store, CanIf_Transmit() reads the CAN ID once */
+		CanIfTxIdUpdate(CanIfTxSduId, CanId);
+		
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		/* Exit Critical section */
+		irq_Enable();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+	}
+}
+
+/**********************************************************************************
+**	Service name: CanIf_SetDynamicTxIdList                     					 **
+**	                                                      						 **
+**	Syntax:	      FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxIdList		 	 **
+**				  (																 **
+**					const PduIdType* CanIfTxSduIds,                              **
+**				    const Can_IdType* CanIds,                                    **
+**				    uint16 Count                                                 **
+**				  )                                                              **
+**																				 **
+**  Description : This API 													     **
+**				 -reconfigures the CAN identifiers of Count dynamic CAN L-PDUs,	 **
+**				  CanIfTxSduIds[i] gets CanIds[i].							 	 **
+**				 -All entries are checked first and changed in one critical		 **
+**				  section, a transmission sees either all old or all new IDs.	 **
+**                                                        						 **
+**	Service ID:   0x83 (vendor specific)                  	    	 			 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                            		 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduIds - L-SDU handles to be reconfigured.     		 **
+**				     CanIds        - New CAN IDs of the L-SDUs.          		 **
+**				     Count         - Number of entries of both lists.      		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    	NA											        	 **
+**                                                       						 **
+***********************************************************************************/
+FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxIdList
+(
+	const PduIdType* CanIfTxSduIds,
+	const Can_IdType* CanIds,
+	uint16 Count
+)
+{
+	/* Loop index over the list entries */
+	uint16 Index;
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	
+	/* Variable to Hold the API's Error State */
+	Std_ReturnType ErrorState = E_OK;
+	
+	if( CanInitState == CANIF_UNINITIALIZED )
+	{
+	/*	
+		[SWS_CANIF_00901] all CanIf API services other than CanIf_Init() and
+		CanIf_GetVersionInfo() shall report to the DET (using CANIF_E_UNINIT)
+		unless the CanIf has been initialized with a preceding call of CanIf_Init().
+	*/	
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETDYNAMICTXIDLIST_SID,
+						CANIF_E_UNINIT);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;				
+	}
+	else if( (0u != Count) && ((NULL_PTR == CanIfTxSduIds) || (NULL_PTR == CanIds)) )
+	{
+		Det_ReportError(CANIF_MODULE_ID  ,
+						CANIF_INSTANCE_ID,
+						CANIF_SETDYNAMICTXIDLIST_SID,
+						CANIF_E_PARAM_POINTER);
+						
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;		
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+	
+	/* Every entry is checked before the first CAN ID is changed, a bad list changes nothing */
+	for(Index = 0u; (E_OK == ErrorState) && (Index < Count); Index++)
+	{
+		if( CanIfCheckDynamicTxId(CanIfTxSduIds[Index]) != CANIF_OK)
+		{
+			Det_ReportError(CANIF_MODULE_ID  ,
+							CANIF_INSTANCE_ID,
+							CANIF_SETDYNAMICTXIDLIST_SID,
+							CANIF_E_INVALID_TXPDUID);
+							
+			/* Set the API Errorstate to E_NOT_OK */
+			ErrorState = E_NOT_OK;		
+		}
+		else if (CanIfCheckCanId(CanIds[Index]) != CANIF_OK )
+		{
+			Det_ReportError(CANIF_MODULE_ID  ,
+							CANIF_INSTANCE_ID,
+							CANIF_SETDYNAMICTXIDLIST_SID,
+							CANIF_E_PARAM_CANID);
+							
+			/* Set the API Errorstate to E_NOT_OK */
+			ErrorState = E_NOT_OK;		
+		}
+		/* (MISRA-C:2004 Rule 14.10 (required)) 
+		All if … else if constructs shall be terminated with an else clause. */
+		else
+		{
+			
+		}
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Api Passes all checks */
+	if(E_OK == ErrorState)	
+#endif /* CANIF_DEV_ERROR_DETECT */
+	{
+		/* Enter Critical section, one for the whole list */
+		irq_Disable();
+		
+		for(Index = 0u; Index < Count; Index++)
+		{
+			CanIfTxIdUpdate(CanIfTxSduIds[Index], CanIds[Index]);
+		}
+		
+		/* Exit Critical section */
+		irq_Enable();
+	}
+}
+
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+/**********************************************************************************
+**	Service name: CanIfCheckTxId                             		             **
+**	                                                      						 **
+**	Syntax:	      uint8 CanIfCheckTxId	  						 		         **
+**				  ( 															 **
+**					PduIdType CanIfTxSduId								     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks the TX PUD-ID if valid or Not.					   	 **
+**																				 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of CanIfTxSduId									 **
+**					 CANIF_OK    - CanIfTxSduId Valid							 **
+**                   CANIF_ERROR - CanIfTxSduId Not Valid          				 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 CanIfCheckTxId( PduIdType CanIfTxSduId)
+{
+	uint8 ErrorState  = (uint8)CANIF_OK;
+	
+	if(CanIfTxSduId >= TX_CAN_L_PDU_NUM)
+	{
+		ErrorState = (uint8)CANIF_ERROR;
+	}
+	
+	return (ErrorState);
+}
+
+#if ((CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON) || (CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON))
+/**********************************************************************************
+**	Service name: CanIfCheckRxId                             		             **
+**	                                                      						 **
+**	Syntax:	      uint8 CanIfCheckRxId	  						 		         **
+**				  ( 															 **
+**					PduIdType CanIfRxSduId								     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks the RX PDU-ID if valid or Not.					   	 **
+**                                                        						 **
+**	Parameters (in): CanIfRxSduId - Receive L-SDU handle.	       		 		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of CanIfRxSduId									 **
+**					 CANIF_OK    - CanIfRxSduId Valid							 **
+**                   CANIF_ERROR - CanIfRxSduId Not Valid          				 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 CanIfCheckRxId(PduIdType CanIfRxSduId)
+{
+	uint8 ErrorState  = (uint8)CANIF_OK;
+	
+	if(CanIfRxSduId >= RX_CAN_L_PDU_NUM)
+	{
+		ErrorState = (uint8)CANIF_ERROR;
+	}
+	
+	return (ErrorState);
+}
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API || CANIF_PUBLIC_READRXPDU_DATA_API */
+
+/**********************************************************************************
+**	Service name: CanIfCheckCanId                             		             **
+**	                                                      						 **
+**	Syntax:	      uint8 CanIfCheckCanId	  						 		         **
+**				  ( 															 **
+**					Can_IdType CanId									     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks the validation of The Pdu CanId.					   	 **
+**																				 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): CanId - CAN ID of CAN L-SDU.			               		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of CanId										 **
+**					 CANIF_OK    - CanId Valid									 **
+**                   CANIF_ERROR - CanId Not Valid          					 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 CanIfCheckCanId(Can_IdType CanId)
+{
+	uint8 ErrorState  = (uint8)CANIF_OK;
+	
+	if (((( (uint32)CanId & CANIF_CANID_TYPE_MASK) == 0) && (( (uint32)CanId & 0x3FFFF800UL) != 0)) || 
+	    ((( (uint32)CanId & CANIF_CANID_TYPE_MASK) != 0) && (( (uint32)CanId & 0x20000000UL) != 0)))
+	{
+		ErrorState = (uint8)CANIF_ERROR;
+	}
+	
+	return (ErrorState);
+}
+
+/**********************************************************************************
+**	Service name: CanIfCheckCtrlId                        		             	 **
+**	                                                      						 **
+**	Syntax:	      uint8 CanIfCheckCtrlId	  				 		         	 **
+**				  ( 															 **
+**					uint8 ControllerId									     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks that the controller is configured, the controller	 	 **
+**				   IDs are 0 .. CANIF_NUM_OF_CONTROLLERS - 1.					 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller to be checked.       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of ControllerId									 **
+**					 CANIF_OK    - ControllerId Valid							 **
+**                   CANIF_ERROR - ControllerId Not Valid 						 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 CanIfCheckCtrlId(uint8 ControllerId)
+{
+	uint8 ErrorState  = (uint8)CANIF_OK;
+	
+	if(ControllerId >= CANIF_NUM_OF_CONTROLLERS)
+	{
+		ErrorState = (uint8)CANIF_ERROR;
+	}
+	
+	return (ErrorState);
+}
+
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIfCheckDynamicTxId                        		             **
+**	                                                      						 **
+**	Syntax:	      uint8 CanIfCheckDynamicTxId	  				 		         **
+**				  ( 															 **
+**					PduIdType CanIfTxSduId								     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks that the TX PDU-ID is valid and the CAN ID of the	 	 **
+**				   L-PDU can be changed (CANIF_TXPDU_DYNAMIC).					 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduId - L-SDU handle to be reconfigured.       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of CanIfTxSduId									 **
+**					 CANIF_OK    - CanIfTxSduId Valid and dynamic				 **
+**                   CANIF_ERROR - CanIfTxSduId Not Valid or static 			 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 CanIfCheckDynamicTxId(PduIdType CanIfTxSduId)
+{
+	uint8 ErrorState  = (uint8)CANIF_OK;
+	
+	if( (CanIfTxSduId >= TX_CAN_L_PDU_NUM) ||
+		(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[CanIfTxSduId].CanIfTxPduDynamicIdRef == CANIF_INVALID_DYNAMIC_ID) )
+	{
+		ErrorState = (uint8)CANIF_ERROR;
+	}
+	
+	return (ErrorState);
+}
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#endif /* CANIF_DEV_ERROR_DETECT */
+
+/**********************************************************************************
+**	Service name: CanIfTxCanId                             		             	 **
+**	                                                      						 **
+**	Syntax:	      Can_IdType CanIfTxCanId	  		 		         			 **
+**				  ( 															 **
+**					const CanIfTxPduCfgType* TxPduCfg					     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Gets the CAN ID a Tx L-PDU is sent with, the configured one	 **
+**				   or the one set by CanIf_SetDynamicTxId() for a dynamic L-PDU. **
+**																				 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): TxPduCfg - Configuration of the Tx L-PDU.	       		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:  Current CAN ID of the L-PDU.   								 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE Can_IdType CanIfTxCanId(const CanIfTxPduCfgType* TxPduCfg)
+{
+	Can_IdType CanId = TxPduCfg->CanIfTxPduCanId;
+	
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+	if(TxPduCfg->CanIfTxPduDynamicIdRef != CANIF_INVALID_DYNAMIC_ID)
+	{
+		CanId = TxDynamicCanId[TxPduCfg->CanIfTxPduDynamicIdRef];
+	}
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+	
+	return (CanId);
+}
+
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIfTxIdUpdate                             		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfTxIdUpdate	  		 		         				 **
+**				  ( 															 **
+**					PduIdType CanIfTxSduId,								     	 **
+**					Can_IdType CanId									     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Stores the new CAN ID of a dynamic Tx L-PDU, static L-PDUs	 **
+**				   are left unchanged.											 **
+**				  -A buffered entry of the L-PDU is sent with the new CAN ID,	 **
+**				   it is moved to its new priority, called with the interrupts	 **
+**				   disabled when CANIF_PUBLIC_TX_BUFFERING is on.				 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                              	 **
+**                                                        						 **
+**	Parameters (in): CanIfTxSduId - L-SDU handle of the L-PDU.       		 	 **
+**					 CanId        - New CAN ID of the L-PDU.       		 		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:  NA   														 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE void CanIfTxIdUpdate(PduIdType CanIfTxSduId, Can_IdType CanId)
+{
+	const CanIfTxPduCfgType* TxPduCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[CanIfTxSduId]);
+	
+	if(TxPduCfg->CanIfTxPduDynamicIdRef != CANIF_INVALID_DYNAMIC_ID)
+	{
+		TxDynamicCanId[TxPduCfg->CanIfTxPduDynamicIdRef] = CanId;
+		
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+		if(TxLPdu[CanIfTxSduId].TxBufferPos != CANIF_TX_NOT_BUFFERED)
+		{
+			TxBuffer[CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHthCfgObj[TxPduCfg->CanIfTxPduHthIdRef].CanIfHthBufferOffset +
+					 TxLPdu[CanIfTxSduId].TxBufferPos].Priority = CanIfTxPriority(CanId);
+			
+			CanIfTxBufferSift(TxPduCfg->CanIfTxPduHthIdRef, TxLPdu[CanIfTxSduId].TxBufferPos);
+		}
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+	}
+}
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if ((CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON) || (CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON))
+/**********************************************************************************
+**	Service name: CanIfNotifSet                             		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfNotifSet	  						 		     	 **
+**				  ( 															 **
+**					volatile uint32* Word,									     **
+**					uint32 Mask									     			 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Sets the Mask bits of a notification status word with an	 	 **
+**				   exclusive read-modify-write (LDREX / STREX on the Cortex-M4,	 **
+**				   the atomic builtins on the host), bits of other L-PDUs set	 **
+**				   or cleared meanwhile from another context are kept.			 **
+**                                                        						 **
+**	Parameters (in): Word - Notification status word.						 	 **
+**					 Mask - Bits to set.							           	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA	 														 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE void CanIfNotifSet(volatile uint32* Word, uint32 Mask)
+{
+#if defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+	uint32 Value;
+	
+	do
+	{
+		Value = __ldrex(Word);
+	}
+	while(0u != __strex((Value | Mask), Word));
+#elif defined(__GNUC__) || defined(__clang__)
+	(void)__atomic_fetch_or(Word, Mask, __ATOMIC_RELAXED);
+#else
+	irq_Disable();
+	*Word |= Mask;
+	irq_Enable();
+#endif
+}
+
+/**********************************************************************************
+**	Service name: CanIfNotifFetchClear                             		         **
+**	                                                      						 **
+**	Syntax:	      uint32 CanIfNotifFetchClear	  						 		 **
+**				  ( 															 **
+**					volatile uint32* Word,									     **
+**					uint32 Mask									     			 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Clears the Mask bits of a notification status word and	 	 **
+**				   returns their previous state in one exclusive access, a	 	 **
+**				   bit set after the read is kept for the next call.			 **
+**                                                        						 **
+**	Parameters (in): Word - Notification status word.						 	 **
+**					 Mask - Bits to read and clear.							     **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    The Mask bits of Word before they were cleared				 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint32 CanIfNotifFetchClear(volatile uint32* Word, uint32 Mask)
+{
+	uint32 Value;
+	
+#if defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+	do
+	{
+		Value = __ldrex(Word);
+	}
+	while(0u != __strex((Value & ~Mask), Word));
+#elif defined(__GNUC__) || defined(__clang__)
+	Value = __atomic_fetch_and(Word, ~Mask, __ATOMIC_RELAXED);
+#else
+	irq_Disable();
+	Value = *Word;
+	*Word = Value & ~Mask;
+	irq_Enable();
+#endif
+	
+	return (Value & Mask);
+}
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API || CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+/**********************************************************************************
+**	Service name: CanIfRxLookup                             		             **
+**	                                                      						 **
+**	Syntax:	      PduIdType CanIfRxLookup	  						 		     **
+**				  ( 															 **
+**					uint16 HrhIndex,									     	 **
+**					Can_IdType CanId									     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Resolves the HRH and CAN ID of a received frame to its Rx	 **
+**				   L-PDU with a binary search over the sorted, disjoint CAN ID	 **
+**				   ranges of the HRH in the Rx CAN ID table.					 **
+**				  -The FD flag is ignored, the extended flag is part of the key	 **
+**				   so standard and extended CAN IDs never match each other.		 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): HrhIndex - Index of the HRH in the HRH table.        		 **
+**					 CanId    - CAN ID of the received frame.	           		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    Rx L-PDU of the frame, CANIF_RX_NO_PDU if there is none	 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE PduIdType CanIfRxLookup(uint16 HrhIndex, Can_IdType CanId)
+{
+	const CanIfHrhCfgType* HrhCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHrhCfgObj[HrhIndex]);
+	
+	const CanIfRxIdEntryType* RxIdTable = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfRxIdObj[HrhCfg->CanIfHrhRxIdFirst]);
+	
+	Can_IdType Key = (Can_IdType)(CanId & ~CAN_ID_TYPE_FD);
+	
+	PduIdType RetVal = CANIF_RX_NO_PDU;
+	
+	/* Search window [Low, High) for the first entry whose range starts above Key */
+	uint16 Low  = 0u;
+	uint16 High = HrhCfg->CanIfHrhRxIdCount;
+	uint16 Middle;
+	
+	while(Low < High)
+	{
+		Middle = (uint16)((Low + High) / 2u);
+		
+		if(RxIdTable[Middle].CanIdLower <= Key)
+		{
+			Low = Middle + 1u;
+		}
+		else
+		{
+			High = Middle;
+		}
+	}
+	
+	/* Only the entry before it can contain Key */
+	if((Low != 0u) && (Key <= RxIdTable[Low - 1u].CanIdUpper))
+	{
+		RetVal = RxIdTable[Low - 1u].RxPduId;
+	}
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: CanIfRxProcess                             		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfRxProcess	  						 		     	 **
+**				  ( 															 **
+**					Can_HwHandleType Hoh,									     **
+**					Can_IdType CanId,									     	 **
+**					const PduInfoType* PduInfoPtr								 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Resolves a received frame to its Rx L-PDU, checks the DLC,	 **
+**				   sets the indication status and notifies the upper layer.		 **
+**				   Frames of no configured Rx L-PDU are dropped.				 **
+**                                                        						 **
+**	Parameters (in): Hoh 		- Receiving hardware object, a valid HRH.		 **
+**					 CanId    	- CAN ID of the received frame.	           		 **
+**					 PduInfoPtr	- Length and data of the received L-SDU.	   	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA	 														 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE void CanIfRxProcess(Can_HwHandleType Hoh, Can_IdType CanId, const PduInfoType* PduInfoPtr)
+{
+	/* Rx L-PDU of the frame, CANIF_RX_NO_PDU if the frame is not configured */
+	PduIdType RxPduId = CanIfRxLookup(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHohToHrh[Hoh], CanId);
+	
+	/* Configuration of the received Rx L-PDU */
+	const CanIfRxPduCfgType* RxPduCfg;
+	
+	/* Frames of no configured Rx L-PDU are dropped by the software filter */
+	if(CANIF_RX_NO_PDU != RxPduId)
+	{
+		RxPduCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfRxPduCfgObj[RxPduId]);
+		
+		/* [SWS_CANIF_00026] Frames shorter than the configured DLC are not accepted */
+		if(PduInfoPtr->SduLength < RxPduCfg->CanIfRxPduDlc)
+		{
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+			/*
+				[SWS_CANIF_00168] If the DLC check fails, CanIf shall report development
+				error code CANIF_E_INVALID_DATA_LENGTH and not notify the upper layer.
+			*/
+			Det_ReportError(CANIF_MODULE_ID  ,
+							CANIF_INSTANCE_ID,
+							CANIF_RXINDICATION_SID,
+							CANIF_E_INVALID_DATA_LENGTH);
+#endif /* CANIF_DEV_ERROR_DETECT */
+		}
+		else
+		{
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+			/* The data is stored before the status is set, a reader seeing the status finds the data */
+			if(RxPduCfg->CanIfRxPduReadData == TRUE)
+			{
+				CanIfRxDataStore(RxPduId, RxPduCfg, PduInfoPtr->SduDataPtr);
+			}
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if(CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON)
+			/* Set the indication status read by CanIf_ReadRxNotifStatus() */
+			if(RxPduCfg->CanIfRxPduReadNotifyStatus == TRUE)
+			{
+				CanIfNotifSet(&RxNotifStatus[RxPduId >> 5u], ((uint32)1u << (RxPduId & 31u)));
+			}
+#endif /* CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+			
+			/* Notify the upper layer of the received L-PDU */
+			if(NULL_PTR != RxPduCfg->CanIfRxPduUserRxIndicationUL)
+			{
+				RxPduCfg->CanIfRxPduUserRxIndicationUL(RxPduCfg->CanIfRxPduUlId, PduInfoPtr);
+			}
+		}
+	}
+}
+
+#if(CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+/**********************************************************************************
+**	Service name: CanIfRxDataStore                             		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfRxDataStore	  						 		     	 **
+**				  ( 															 **
+**					PduIdType RxPduId,										     **
+**					const CanIfRxPduCfgType* RxPduCfg,							 **
+**					const uint8* SduDataPtr								 		 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Copies CanIfRxPduDlc bytes of a received L-SDU to the bank	 **
+**				   the readers are not using and publishes it by incrementing	 **
+**				   the sequence of the L-PDU. The sequence skips 0, which		 **
+**				   stands for no frame received.								 **
+**				   Called by the receive path of the L-PDU's HRH only.			 **
+**                                                        						 **
+**	Parameters (in): RxPduId 	- Received Rx L-PDU.		 					 **
+**					 RxPduCfg 	- Configuration of the Rx L-PDU.				 **
+**					 SduDataPtr	- Data of the received L-SDU.	   	 			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA	 														 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE void CanIfRxDataStore(PduIdType RxPduId, const CanIfRxPduCfgType* RxPduCfg, const uint8* SduDataPtr)
+{
+	uint16 Next = (uint16)(RxDataSequence[RxPduId] + 1u);
+	uint8* Data;
+	uint8 Index;
+	
+	if(Next == 0u)
+	{
+		Next = 2u;
+	}
+	
+	Data = &RxDataBank[Next & 1u][RxPduCfg->CanIfRxPduDataOffset];
+	
+	for(Index = 0u; Index < RxPduCfg->CanIfRxPduDlc; Index++)
+	{
+		Data[Index] = SduDataPtr[Index];
+	}
+	
+	/* The bank is complete before a reader can select it */
+	COMPILER_BARRIER();
+	
+	RxDataSequence[RxPduId] = Next;
+}
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+/**********************************************************************************
+**	Service name: CanIfRxQueuePush                             		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfRxQueuePush	  						 		     	 **
+**				  ( 															 **
+**					const Can_HwType* Mailbox,								     **
+**					const PduInfoType* PduInfoPtr								 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Copies a received frame into the Rx queue, a frame which	 	 **
+**				   finds the queue full is counted and dropped so the frames	 **
+**				   already queued keep their order.								 **
+**				   Called from the receive interrupt only.						 **
+**                                                        						 **
+**	Parameters (in): Mailbox 	- CAN ID, HOH and controller of the frame.		 **
+**					 PduInfoPtr	- Length and data of the received L-SDU.	   	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA	 														 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE void CanIfRxQueuePush(const Can_HwType* Mailbox, const PduInfoType* PduInfoPtr)
+{
+	RxQueueEntryType* Entry;
+	uint16 Head = RxQueueHead;
+	uint16 Fill = (uint16)(Head - RxQueueTail);
+	uint8 Length;
+	uint8 Index;
+	
+	if(Fill >= CANIF_RX_QUEUE_SIZE)
+	{
+		/* CanIf_MainFunctionRx is behind, the oldest frames are kept */
+		RxQueueOverflow++;
+	}
 	else
 	{
+		Entry = &RxQueue[Head & (CANIF_RX_QUEUE_SIZE - 1u)];
 		
-	}
-#endif /* CANIF_DEV_ERROR_DETECT */
-
-#if (CANIF_DEV_ERROR_DETECT == STD_ON)
-	/* Api Passes all checks */
-	if(E_OK == ErrorState)	
-#endif /* CANIF_DEV_ERROR_DETECT */
-	{		
-		/* Enter Critical section */
-		irq_Disable();
+		/* Longer L-SDUs can only come from a CAN FD controller, which sizes the queue to 64 bytes */
+		Length = (PduInfoPtr->SduLength > CANIF_RX_QUEUE_DATA_SIZE) ? (uint8)CANIF_RX_QUEUE_DATA_SIZE : (uint8)PduInfoPtr->SduLength;
+		
+		Entry->CanId  = Mailbox->CanId;
+		Entry->Hoh	  = Mailbox->Hoh;
+		Entry->Length = Length;
 		
-		/* Get the corresponding TxPduId Configuration Structure */ 
-		CanIfTxPduCfg = CanIfGetTxPduCfg(CanIfTxSduId);
+		for(Index = 0u; Index < Length; Index++)
+		{
+			Entry->Data[Index] = PduInfoPtr->SduDataPtr[Index];
+		}
 		
-		/* Change the current TxPdu CanId to the new one */
-		CanIfTxPduCfg->CanIfTxPduCanId = CanId ;
+		/* The frame is complete before the consumer can see it */
+		COMPILER_BARRIER();
 		
-		/* Exit Critical section */
-		 irq_Enable(); 
+		RxQueueHead = (uint16)(Head + 1u);
 		
+		if((uint16)(Fill + 1u) > RxQueueHighWatermark)
+		{
+			RxQueueHighWatermark = (uint16)(Fill + 1u);
+		}
 	}
 }
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
 
-#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
-
-#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
 /**********************************************************************************
-**	Service name: CanIfCheckTxId                             		             **
+**	Service name: CanIfTxPriority                             		             **
 **	                                                      						 **
-**	Syntax:	      uint8 CanIfCheckTxId	  						 		         **
+**	Syntax:	      uint32 CanIfTxPriority	  						 		     **
 **				  ( 															 **
-**					PduIdType CanIfTxSduId								     	 **
+**					Can_IdType CanId									     	 **
 ** 				  )																 **
 **																				 **
 **  Description : This LOCAL_INLINE API 									     **
-**				  -Checks the TX PUD-ID if valid or Not.					   	 **
-**																				 **
+**				  -Maps a CAN ID to its bus arbitration order, the base ID	   	 **
+**				   is compared first and a standard frame wins against an		 **
+**				   extended frame with the same base ID (recessive SRR/IDE).	 **
 **                                                        						 **
 **	Service ID:   NA                           						    	     **
 **                                                        						 **
@@ -408,106 +3377,451 @@ FUNC( void, CANIF_CODE ) CanIf_SetDynamicTxId
 **																				 **
 **  Reentrancy:   Reentrant                                              		 **
 **                                                        						 **
-**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
+**	Parameters (in): CanId - CAN ID of CAN L-SDU.			               		 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
 **                                                   						 	 **                                           					
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    ErrorState of CanIfTxSduId									 **
-**					 CANIF_OK    - CanIfTxSduId Valid							 **
-**                   CANIF_ERROR - CanIfTxSduId Not Valid          				 **
+**	Return value:    Priority of the CAN ID, lower value wins the arbitration	 **
 **																 				 **
 ***********************************************************************************/
-LOCAL_INLINE uint8 CanIfCheckTxId( PduIdType CanIfTxSduId)
+LOCAL_INLINE uint32 CanIfTxPriority(Can_IdType CanId)
 {
-	uint8 ErrorState  = (uint8)CANIF_OK;
+	uint32 Priority;
 	
-	if(CanIfTxSduId >= TX_CAN_L_PDU_NUM)
+	if(((uint32)CanId & CAN_ID_TYPE_EXTENDED) != 0u)
 	{
-		ErrorState = (uint8)CANIF_ERROR;
+		/* Base ID in bits 29..19, then the IDE bit, then the 18 bit ID extension */
+		Priority = ((((uint32)CanId & CAN_ID_EXTENDED_MASK) >> 18u) << 19u) | 
+				   (1UL << 18u) | ((uint32)CanId & 0x3FFFFUL);
+	}
+	else
+	{
+		Priority = ((uint32)CanId & CAN_ID_STANDARD_MASK) << 19u;
 	}
 	
-	return (ErrorState);
+	return (Priority);
 }
 
 /**********************************************************************************
-**	Service name: CanIfCheckCanId                             		             **
+**	Service name: CanIfTxBufferInsert                          		             **
 **	                                                      						 **
-**	Syntax:	      uint8 CanIfCheckCanId	  						 		         **
+**	Syntax:	      Std_ReturnType CanIfTxBufferInsert	  			 		     **
 **				  ( 															 **
-**					Can_IdType CanId									     	 **
+**					PduIdType TxPduId,									     	 **
+**					const Can_PduType* CanPdu							     	 **
 ** 				  )																 **
 **																				 **
-**  Description : This LOCAL_INLINE API 									     **
-**				  -Checks the validation of The Pdu CanId.					   	 **
-**																				 **
+**  Description : This static API 									     		 **
+**				  -Buffers an L-PDU in the Tx buffer of its HTH, an L-PDU	   	 **
+**				   which is already buffered only gets the newer data.			 **
+**				  -Runs in O(log n) of the buffer size, called with the		 	 **
+**				   interrupts disabled.											 **
 **                                                        						 **
 **	Service ID:   NA                           						    	     **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
-**  Reentrancy:   Reentrant                                              		 **
+**  Reentrancy:   Non Reentrant                                              	 **
 **                                                        						 **
-**	Parameters (in): CanId - CAN ID of CAN L-SDU.			               		 **
+**	Parameters (in): TxPduId - L-PDU handle of the L-PDU.		           		 **
+**					 CanPdu  - L-PDU rejected by Can_Write().		           	 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
 **                                                   						 	 **                                           					
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    ErrorState of CanId										 **
-**					 CANIF_OK    - CanId Valid									 **
-**                   CANIF_ERROR - CanId Not Valid          					 **
+**	Return value:    E_OK     - L-PDU buffered									 **
+**                   E_NOT_OK - Tx buffer of the HTH full or not configured	 **
 **																 				 **
 ***********************************************************************************/
-LOCAL_INLINE uint8 CanIfCheckCanId(Can_IdType CanId)
+static Std_ReturnType CanIfTxBufferInsert(PduIdType TxPduId, const Can_PduType* CanPdu)
 {
-	uint8 ErrorState  = (uint8)CANIF_OK;
+	Std_ReturnType RetVal = E_OK;
 	
-	if (((( (uint32)CanId & CANIF_CANID_TYPE_MASK) == 0) && (( (uint32)CanId & 0x3FFFF800UL) != 0)) || 
-	    ((( (uint32)CanId & CANIF_CANID_TYPE_MASK) != 0) && (( (uint32)CanId & 0x20000000UL) != 0)))
+	uint16 HthIndex = CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[TxPduId].CanIfTxPduHthIdRef;
+	
+	const CanIfHthCfgType* HthCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHthCfgObj[HthIndex]);
+	
+	uint8 Pos = TxLPdu[TxPduId].TxBufferPos;
+	
+	uint8 ByteIndex;
+	
+	if(CANIF_TX_NOT_BUFFERED == Pos)
 	{
-		ErrorState = (uint8)CANIF_ERROR;
+		if(TxBufferCount[HthIndex] < HthCfg->CanIfHthBufferSize)
+		{
+			/* New entry at the end of the heap, sifted up below */
+			Pos = TxBufferCount[HthIndex];
+			
+			TxBufferCount[HthIndex]++;
+			
+			TxBuffer[HthCfg->CanIfHthBufferOffset + Pos].PduId = TxPduId;
+		}
+		else
+		{
+			RetVal = E_NOT_OK;
+		}
 	}
 	
-	return (ErrorState);
+	if(E_OK == RetVal)
+	{
+		/* [SWS_CANIF_00068] A newer request of a buffered L-PDU overwrites the older data */
+		for(ByteIndex = 0u; ByteIndex < CanPdu->length; ByteIndex++)
+		{
+			TxLPdu[TxPduId].TxBufferSdu[ByteIndex] = CanPdu->sdu[ByteIndex];
+		}
+		
+		TxBuffer[HthCfg->CanIfHthBufferOffset + Pos].Priority = CanIfTxPriority(CanPdu->id);
+		
+		CanIfTxBufferSift(HthIndex, Pos);
+	}
+	
+	return (RetVal);
 }
 
-#endif /* CANIF_DEV_ERROR_DETECT */
+/**********************************************************************************
+**	Service name: CanIfTxBufferSend                          		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfTxBufferSend	  			 		     			 **
+**				  ( 															 **
+**					uint16 HthIndex									     	 	 **
+** 				  )																 **
+**																				 **
+**  Description : This static API 									     		 **
+**				  -Passes the highest priority buffered L-PDU of an HTH to	   	 **
+**				   Can_Write(), it leaves the buffer once the driver accepts it. **
+**				  -Called with the interrupts disabled.							 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                              	 **
+**                                                        						 **
+**	Parameters (in): HthIndex - Index of the HTH in the HTH table.        		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA															 **
+**																 				 **
+***********************************************************************************/
+static void CanIfTxBufferSend(uint16 HthIndex)
+{
+	const CanIfHthCfgType* HthCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHthCfgObj[HthIndex]);
+	
+	TxBufferEntryType* Heap = &TxBuffer[HthCfg->CanIfHthBufferOffset];
+	
+	const CanIfTxPduCfgType* TxPduCfg;
+	
+	Can_PduType CanPdu;
+	
+	if(TxBufferCount[HthIndex] != 0u)
+	{
+		TxPduCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[Heap[0].PduId]);
+		
+		CanPdu.swPduHandle = Heap[0].PduId;
+		CanPdu.length      = TxPduCfg->CanIfTxPduDlc;
+		CanPdu.id          = CanIfTxCanId(TxPduCfg);
+		CanPdu.sdu         = TxLPdu[Heap[0].PduId].TxBufferSdu;
+		
+		if(CAN_OK == Can_Write(HthCfg->CanIfHthIdSymRef, &CanPdu))
+		{
+			TxLPdu[Heap[0].PduId].TxBufferPos = CANIF_TX_NOT_BUFFERED;
+			
+			TxBufferCount[HthIndex]--;
+			
+			/* The last entry fills the hole at the top and sinks to its place */
+			if(TxBufferCount[HthIndex] != 0u)
+			{
+				Heap[0] = Heap[TxBufferCount[HthIndex]];
+				
+				CanIfTxBufferSift(HthIndex, 0u);
+			}
+		}
+	}
+}
 
 /**********************************************************************************
-**	Service name: CanIfGetTxPduCfg                             		             **
+**	Service name: CanIfTxBufferSift                          		             **
 **	                                                      						 **
-**	Syntax:	      CanIfTxPduCfgType* CanIfGetTxPduCfg	  		 		         **
+**	Syntax:	      void CanIfTxBufferSift	  			 		     			 **
 **				  ( 															 **
-**					PduIdType CanIfTxSduId								     	 **
+**					uint16 HthIndex,								     	 	 **
+**					uint8 Pos										     	 	 **
 ** 				  )																 **
 **																				 **
-**  Description : This LOCAL_INLINE API 									     **
-**				  -Gets a Pointer to corresponding TxPduId						 **
-**				   configuration Structure.										 **
+**  Description : This static API 									     		 **
+**				  -Moves the Tx buffer entry at Pos up or down the heap of   	 **
+**				   its HTH until the heap order holds again, and updates the	 **
+**				   buffer position of every moved L-PDU.						 **
+**				  -Called with the interrupts disabled.							 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
 **																				 **
+**  Reentrancy:   Non Reentrant                                              	 **
+**                                                        						 **
+**	Parameters (in): HthIndex - Index of the HTH in the HTH table.        		 **
+**					 Pos      - Heap position of the changed entry.       		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA															 **
+**																 				 **
+***********************************************************************************/
+static void CanIfTxBufferSift(uint16 HthIndex, uint8 Pos)
+{
+	TxBufferEntryType* Heap = &TxBuffer[CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHthCfgObj[HthIndex].CanIfHthBufferOffset];
+	
+	uint8 Count = TxBufferCount[HthIndex];
+	
+	TxBufferEntryType Entry = Heap[Pos];
+	
+	uint8 Next;
+	
+	/* Up while the parent loses the arbitration against the entry */
+	while(Pos > 0u)
+	{
+		Next = (uint8)((Pos - 1u) / 2u);
+		
+		if(Heap[Next].Priority <= Entry.Priority)
+		{
+			break;
+		}
+		
+		Heap[Pos] = Heap[Next];
+		TxLPdu[Heap[Pos].PduId].TxBufferPos = Pos;
+		
+		Pos = Next;
+	}
+	
+	/* Down while a child wins the arbitration against the entry */
+	while(((2u * (uint16)Pos) + 1u) < Count)
+	{
+		Next = (uint8)((2u * Pos) + 1u);
+		
+		if(((Next + 1u) < Count) && (Heap[Next + 1u].Priority < Heap[Next].Priority))
+		{
+			Next++;
+		}
+		
+		if(Heap[Next].Priority >= Entry.Priority)
+		{
+			break;
+		}
+		
+		Heap[Pos] = Heap[Next];
+		TxLPdu[Heap[Pos].PduId].TxBufferPos = Pos;
+		
+		Pos = Next;
+	}
+	
+	Heap[Pos] = Entry;
+	TxLPdu[Entry.PduId].TxBufferPos = Pos;
+}
+
+/**********************************************************************************
+**	Service name: CanIfTxBufferFlush                          		             **
+**	                                                      						 **
+**	Syntax:	      uint32 CanIfTxBufferFlush	  			 		     			 **
+**				  ( 															 **
+**					uint8 ControllerId								     	 	 **
+** 				  )																 **
+**																				 **
+**  Description : This static API 									     		 **
+**				  -Drops the buffered L-PDUs of all HTHs of the controller.		 **
+**				  -Called with the interrupts disabled.							 **
 **                                                        						 **
 **	Service ID:   NA                           						    	     **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
-**  Reentrancy:   Reentrant                                              		 **
+**  Reentrancy:   Non Reentrant                                              	 **
 **                                                        						 **
-**	Parameters (in): CanIfTxSduId - L-SDU handle to be transmitted.       		 **
+**	Parameters (in): ControllerId - CAN controller of the HTHs.        		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    Number of dropped L-PDUs									 **
+**																 				 **
+***********************************************************************************/
+static uint32 CanIfTxBufferFlush(uint8 ControllerId)
+{
+	const CanIfHthCfgType* HthCfg;
+	
+	uint32 Flushed = 0u;
+	
+	uint16 HthIndex;
+	
+	uint8 Pos;
+	
+	for(HthIndex = 0u; HthIndex < CANIF_NUM_OF_HTHS; HthIndex++)
+	{
+		HthCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHthCfgObj[HthIndex]);
+		
+		if(HthCfg->CanIfHthCanCtrlIdRef == ControllerId)
+		{
+			for(Pos = 0u; Pos < TxBufferCount[HthIndex]; Pos++)
+			{
+				TxLPdu[TxBuffer[HthCfg->CanIfHthBufferOffset + Pos].PduId].TxBufferPos = CANIF_TX_NOT_BUFFERED;
+			}
+			
+			Flushed += TxBufferCount[HthIndex];
+			
+			TxBufferCount[HthIndex] = 0u;
+		}
+	}
+	
+	return (Flushed);
+}
+
+/**********************************************************************************
+**	Service name: CanIfTxBufferResume                          		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfTxBufferResume	  			 		     			 **
+**				  ( 															 **
+**					uint8 ControllerId								     	 	 **
+** 				  )																 **
+**																				 **
+**  Description : This static API 									     		 **
+**				  -Passes the highest priority buffered L-PDU of every HTH of	 **
+**				   the started controller to Can_Write(), the others follow on	 **
+**				   the Tx confirmations.										 **
+**				  -Called with the interrupts disabled.							 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                              	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller of the HTHs.        		 	 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
 **                                                   						 	 **                                           					
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:  A pointer to corresponding Tx L-SDU configuration Strcture.   **
+**	Return value:    NA															 **
+**																 				 **
+***********************************************************************************/
+static void CanIfTxBufferResume(uint8 ControllerId)
+{
+	uint16 HthIndex;
+	
+	for(HthIndex = 0u; HthIndex < CANIF_NUM_OF_HTHS; HthIndex++)
+	{
+		if(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfHthCfgObj[HthIndex].CanIfHthCanCtrlIdRef == ControllerId)
+		{
+			CanIfTxBufferSend(HthIndex);
+		}
+	}
+}
+
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+/**********************************************************************************
+**	Service name: CanIfBusOffRestartDelay                      		             **
+**	                                                      						 **
+**	Syntax:	      void CanIfBusOffRestartDelay	  			 		     		 **
+**				  ( 															 **
+**					uint8 ControllerId								     	 	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Loads the delay to the next restart of the controller in		 **
+**				   bus-off, the fast delay for the first attempts and the slow	 **
+**				   one after them.												 **
+**				  -Called with the interrupts disabled.							 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
 **																				 **
+**  Reentrancy:   Non Reentrant                                              	 **
+**                                                        						 **
+**	Parameters (in): ControllerId - CAN controller in bus-off.        		 	 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    NA															 **
+**																 				 **
 ***********************************************************************************/
-LOCAL_INLINE CanIfTxPduCfgType* CanIfGetTxPduCfg(PduIdType CanIfTxSduId)
+LOCAL_INLINE void CanIfBusOffRestartDelay(uint8 ControllerId)
 {
-	CanIfTxPduCfgType* CanIfTxPduCfg;
+	const CanIfCtrlCfgType* CtrlCfg = &(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfCtrlCfgObj[ControllerId]);
 	
-	CanIfTxPduCfg = (CanIfTxPduCfgType* )&(CanIf_ConfigPtr->CanIfInitCfgObj->CanIfTxPduCfgObj[CanIfTxSduId]);
+	if(CtrlState[ControllerId].RestartCount < CtrlCfg->CanIfCtrlFastRecoveryAttempts)
+	{
+		CtrlState[ControllerId].RestartTimer = CtrlCfg->CanIfCtrlFastRecoveryTicks;
+	}
+	else
+	{
+		CtrlState[ControllerId].RestartTimer = CtrlCfg->CanIfCtrlSlowRecoveryTicks;
+	}
+}
+#endif /* CANIF_BUSOFF_RECOVERY */
+
+/**********************************************************************************
+**	Service name: CanIfBusOffEnd												 **
+**																				 **
+**	Syntax:	      void CanIfBusOffEnd											 **
+**				  (																 **
+**					uint8 ControllerId											 **
+**				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Ends the bus-off of the controller on its first Tx			 **
+**				   confirmation and records the recovery time.					 **
+**				  -Called with the interrupts disabled.							 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): ControllerId - CAN controller of the confirmed L-PDU.		 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value:    NA															 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE void CanIfBusOffEnd(uint8 ControllerId)
+{
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+	/* Time from the bus-off of the controller to this confirmation in ms */
+	uint32 RecoveryTime;
+#endif /* CANIF_BUSOFF_RECOVERY */
 	
-	return (CanIfTxPduCfg);
+	/* Checked again, the bus-off may have ended since the caller tested it without the lock */
+	if(TRUE == CtrlState[ControllerId].BusOff)
+	{
+		CtrlState[ControllerId].BusOff = FALSE;
+		
+#if (CANIF_BUSOFF_RECOVERY == STD_ON)
+		RecoveryTime = (BusOffTick - CtrlState[ControllerId].BusOffStart) * CANIF_BUSOFF_MAIN_FUNCTION_PERIOD_MS;
+		
+		CtrlState[ControllerId].Statistics.RecoveryTimeLast = RecoveryTime;
+		
+		if(RecoveryTime > CtrlState[ControllerId].Statistics.RecoveryTimeMax)
+		{
+			CtrlState[ControllerId].Statistics.RecoveryTimeMax = RecoveryTime;
+		}
+#endif /* CANIF_BUSOFF_RECOVERY */
+	}
 }
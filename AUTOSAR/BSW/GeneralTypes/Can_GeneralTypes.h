@@ -0,0 +1,143 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Can_GeneralTypes.h											 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : CAN stack General Types Header File.							 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_CANDriver, AUTOSAR Release 4.3.1				 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef CAN_GENERALTYPES_H 
+#define CAN_GENERALTYPES_H
+
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "ComStack_Types.h"
+
+
+/***********************************************************************************/
+/*                      	Private Macro Definitions 			                   */
+/***********************************************************************************/
+
+/*	Moudle Version	1.0.0 */
+#define CAN_GENERALTYPES_SW_MAJOR_VERSION			(0x01u)
+#define CAN_GENERALTYPES_SW_MINOR_VERSION			(0x00u)
+#define CAN_GENERALTYPES_SW_PATCH_VERSION			(0x00u)
+
+/* Autosar version 4.3.1 */
+#define CAN_GENERALTYPES_AR_RELEASE_MAJOR_VERSION	(0x04u)
+#define CAN_GENERALTYPES_AR_RELEASE_MINOR_VERSION	(0x03u)
+#define CAN_GENERALTYPES_AR_RELEASE_PATCH_VERSION	(0x01u)
+
+/* 
+	[SWS_Can_00416] The two most significant bits of Can_IdType specify the frame type,
+	bit 31 set for an extended (29-bit) CAN ID and bit 30 set for a CAN FD frame
+*/
+#define CAN_ID_TYPE_EXTENDED						(0x80000000UL)
+#define CAN_ID_TYPE_FD								(0x40000000UL)
+
+/* Identifier bits of a standard and an extended CAN ID */
+#define CAN_ID_STANDARD_MASK						(0x000007FFUL)
+#define CAN_ID_EXTENDED_MASK						(0x1FFFFFFFUL)
+
+
+/***********************************************************************************/
+/*                      		Types Definition 				                   */
+/***********************************************************************************/
+
+/* [SWS_Can_00416] Represents the Identifier of an L-PDU, the frame type is held in the two most significant bits */
+typedef uint32 Can_IdType;
+
+/* [SWS_Can_00429] Represents the hardware object handles of a CAN hardware unit */
+typedef uint16 Can_HwHandleType;
+
+/* [SWS_Can_00415] Structure of the L-PDU handed to Can_Write() */
+typedef struct 
+{
+	/* L-PDU handle, returned in CanIf_TxConfirmation() */
+	PduIdType	swPduHandle;
+	
+	/* Length of the L-PDU payload in bytes */
+	uint8		length;
+	
+	/* Identifier of the L-PDU */
+	Can_IdType	id;
+	
+	/* Pointer to the L-SDU (payload) */
+	uint8*		sdu;
+}Can_PduType;
+
+/* [SWS_CAN_00496] Hardware object handle, CAN ID and controller of a received or transmitted frame */
+typedef struct 
+{
+	/* Standard / extended CAN ID of the frame */
+	Can_IdType			CanId;
+	
+	/* Hardware object which received or transmitted the frame */
+	Can_HwHandleType	Hoh;
+	
+	/* Controller the hardware object belongs to */
+	uint8				ControllerId;
+}Can_HwType;
+
+/* [SWS_Can_91013] Return values of the CAN driver API */
+typedef enum
+{
+	/* Request accepted */
+	CAN_OK		= 0x00,
+	/* Request not accepted */
+	CAN_NOT_OK	= 0x01,
+	/* Request not accepted, the hardware object is busy (all transmit mailboxes are in use) */
+	CAN_BUSY	= 0x02
+}Can_ReturnType;
+
+/* State transitions requested from the CAN driver by Can_SetControllerMode() */
+typedef enum
+{
+	/* Start a stopped controller, also the restart after a bus-off */
+	CAN_T_START		= 0x00,
+	/* Stop a started controller, pending transmissions are cancelled */
+	CAN_T_STOP		= 0x01,
+	/* Put a stopped controller to sleep */
+	CAN_T_SLEEP		= 0x02,
+	/* Wake a sleeping controller up, it is stopped afterwards */
+	CAN_T_WAKEUP	= 0x03
+}Can_StateTransitionType;
+
+/* Modes of a CAN controller, reported by the CAN driver through CanIf_ControllerModeIndication() */
+typedef enum
+{
+	/* The controller is not initialized */
+	CAN_CS_UNINIT	= 0x00,
+	/* The controller takes part in the bus communication */
+	CAN_CS_STARTED	= 0x01,
+	/* The controller is stopped, also after a bus-off */
+	CAN_CS_STOPPED	= 0x02,
+	/* The controller is in its low power mode */
+	CAN_CS_SLEEP	= 0x03
+}Can_ControllerStateType;
+
+/***********************************************************************************/
+/*                      		Functions Prototype 			                   */
+/***********************************************************************************/
+
+#endif /* CAN_GENERALTYPES_H */
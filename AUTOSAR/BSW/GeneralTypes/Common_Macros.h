@@ -11,7 +11,49 @@
 #ifndef COMMON_MACROS
 #define COMMON_MACROS
 
-#include "STD_Types.h"
+#include "Std_Types.h"
+
+#ifdef SIM_REGISTER_ACCESS
+
+/* 
+   Host build: every register access goes through the simulated register bus,
+   which models the peripherals and counts the accesses of each register.
+*/
+#include "Sim.h"
+
+/* Set a certain bit in any register */
+#define SET_BIT(REG,BIT) (Sim_WriteRegister((uint32)(REG), (Sim_ReadRegister((uint32)(REG)) | (1u<<(BIT)))))
+
+/* Clear a certain bit in any register */
+#define CLEAR_BIT(REG,BIT) (Sim_WriteRegister((uint32)(REG), (Sim_ReadRegister((uint32)(REG)) & (~(1u<<(BIT))))))
+
+/* Get a certain bit in any register */
+#define GET_BIT(REG,BIT)      ((Sim_ReadRegister((uint32)(REG)) >> (BIT)) & 1u)
+
+/* Get any register */
+#define GET_PORT(REG)      		(Sim_ReadRegister((uint32)(REG)))
+
+/* Get any register */
+#define SET_PORT(REG,VAL)      		(Sim_WriteRegister((uint32)(REG), (uint32)(VAL)))
+
+/* Toggle a certain bit in any register */
+#define TOGGLE_BIT(REG,BIT) (Sim_WriteRegister((uint32)(REG), (Sim_ReadRegister((uint32)(REG)) ^ (1u<<(BIT)))))
+
+/* Rotate right the register value with specific number of rotates */
+#define ROR(REG,num) (Sim_WriteRegister((uint32)(REG), ((Sim_ReadRegister((uint32)(REG)) >> (num)) | \
+													  (Sim_ReadRegister((uint32)(REG)) << (8-(num))))))
+
+/* Rotate left the register value with specific number of rotates */
+#define ROL(REG,num) (Sim_WriteRegister((uint32)(REG), ((Sim_ReadRegister((uint32)(REG)) << (num)) | \
+													  (Sim_ReadRegister((uint32)(REG)) >> (8-(num))))))
+
+/* Check if a specific bit is set in any register and return true if yes */
+#define BIT_IS_SET(REG,BIT) ( Sim_ReadRegister((uint32)(REG)) & (1u<<(BIT)) )
+
+/* Check if a specific bit is cleared in any register and return true if yes */
+#define BIT_IS_CLEAR(REG,BIT) ( !(Sim_ReadRegister((uint32)(REG)) & (1u<<(BIT))) )
+
+#else
 
 /* Set a certain bit in any register */
 #define SET_BIT(REG,BIT) (*((volatile uint32_t *)REG)|=(1<<BIT))
@@ -43,4 +85,41 @@
 /* Check if a specific bit is cleared in any register and return true if yes */
 #define BIT_IS_CLEAR(REG,BIT) ( !(*((volatile uint32 *)REG) & (1<<BIT)) )
 
+#endif /* SIM_REGISTER_ACCESS */
+
+#ifdef REGISTER_TRACE
+
+/* 
+   Trace build: the register writes of the macros above also record the address, 
+   the value and the time of the write in the trace ring (TRACE/Trace.h)
+*/
+#include "Trace.h"
+
+#undef SET_BIT
+#undef CLEAR_BIT
+#undef SET_PORT
+#undef TOGGLE_BIT
+#undef ROR
+#undef ROL
+
+/* Set a certain bit in any register */
+#define SET_BIT(REG,BIT) (Trace_WriteRegister((uint32)(REG), (GET_PORT((REG)) | (1u<<(BIT)))))
+
+/* Clear a certain bit in any register */
+#define CLEAR_BIT(REG,BIT) (Trace_WriteRegister((uint32)(REG), (GET_PORT((REG)) & (~(1u<<(BIT))))))
+
+/* Set any register */
+#define SET_PORT(REG,VAL)      		(Trace_WriteRegister((uint32)(REG), (uint32)(VAL)))
+
+/* Toggle a certain bit in any register */
+#define TOGGLE_BIT(REG,BIT) (Trace_WriteRegister((uint32)(REG), (GET_PORT((REG)) ^ (1u<<(BIT)))))
+
+/* Rotate right the register value with specific number of rotates */
+#define ROR(REG,num) (Trace_WriteRegister((uint32)(REG), ((GET_PORT((REG)) >> (num)) | (GET_PORT((REG)) << (8-(num))))))
+
+/* Rotate left the register value with specific number of rotates */
+#define ROL(REG,num) (Trace_WriteRegister((uint32)(REG), ((GET_PORT((REG)) << (num)) | (GET_PORT((REG)) >> (8-(num))))))
+
+#endif /* REGISTER_TRACE */
+
 #endif
@@ -73,6 +73,29 @@
 #define LOCAL_INLINE	static inline
 #endif
 
+/* Evaluates to 1 if the compiler can prove the expression is a constant, else 0 */
+#ifndef IS_CONSTANT
+#if defined(__GNUC__) || defined(__clang__) || defined(__ARMCC_VERSION)
+#define IS_CONSTANT(x)	__builtin_constant_p(x)
+#else
+#define IS_CONSTANT(x)	(0)
+#endif
+#endif
+
+/* 
+   Keeps the compiler from moving memory accesses across it, enough to publish data 
+   from an interrupt to a task on the single core Cortex-M4 (no hardware barrier needed)
+*/
+#ifndef COMPILER_BARRIER
+#if defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+#define COMPILER_BARRIER()	__schedule_barrier()
+#elif defined(__GNUC__) || defined(__clang__)
+#define COMPILER_BARRIER()	__asm__ volatile ("" : : : "memory")
+#else
+#define COMPILER_BARRIER()
+#endif
+#endif
+
 
 #define FUNC(rettype, memclass)						rettype
 
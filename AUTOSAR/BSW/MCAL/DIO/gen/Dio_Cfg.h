@@ -1,34 +1,34 @@
 /**********************************************************************************
 ***********************************************************************************
 **														  						 **		
-**	FILENAME	:	Dio_Cfg.h                              					     **
+**	FILENAME	:	Dio_Cfg.h													 **
 **	                                                      						 **
-**	VERSION		: 	1.0.0                                 						 **
+**	VERSION		: 	1.0.0														 **
 **                                                        						 **
-**	DATE		:	2021-3-22                             						 **
+**	DATE		:	2021-3-22													 **
 **                                                        						 **
-**	PLATFORM	:	TIVA C      		                  						 **
+**	PLATFORM	:	TIVA C														 **
 **																				 **
 **  VARIANT  	: 	NA                                                           **
 **                                                        						 **
-**	AUTHOR		:  	MohamedSayed                          						 **
+**	AUTHOR		:  	MohamedSayed												 **
 **                                                        						 **
 **	VENDOR		: 	NA				                     						 **
 **                                                        						 **
 **	                                                      						 **
-**	DESCRIPTION : Digital I/O Driver coniguration file       					 **
+**	DESCRIPTION : Digital I/O Driver coniguration file							 **
 **                                                                               **
-**	SPECIFICATION(S) : AUTOSAR_SWS_DIODriver, AUTOSAR Release 4.3.1              **
+**	SPECIFICATION(S) : AUTOSAR_SWS_DIODriver, AUTOSAR Release 4.3.1				 **
 **                                                       						 **
-**	MAY BE CHANGED BY USER : Yes                          						 **
+**	MAY BE CHANGED BY USER : No													 **
 **                                                       					     **
 ***********************************************************************************/
 #ifndef DIO_CFG_H
 #define DIO_CFG_H
 
-#include "gpio.h"
+/* Generated by tools/CfgGen/CfgGen.py from Ecu.json, changes are lost on the next generation */
 
-//Dio_LevelType Dio_Config1;
+#include "gpio.h"
 
 /* Dio configutration file Vendor */
 #define DIO_CFG_VENDOR_ID	(0x40u)
@@ -52,22 +52,162 @@
 /* Adds / removes the service Dio_ GetVersionInfo() from the code */
 #define DioVersionInfoApi					STD_ON
 
-/* this configuration shall be done with a configration tool */
-
-#define NUM_OF_USED_PINS		3
-#define NUM_OF_USED_PORTS		3
+/* Adds / removes the service Dio_WriteChannelList() from the code */
+#define DioWriteChannelListApi				STD_ON
+
+/* 
+   Write services take the output pins from a RAM shadow of the direction registers
+   instead of reading GPIO_O_DIR on every call, adds the service Dio_RefreshPortDirection()
+*/
+#define DioDirectionShadow					STD_ON
+
+/* Adds / removes the compile time resolved Dio_ReadChannelStatic() / Dio_WriteChannelStatic() */
+#define DioStaticChannelApi					STD_ON
+
+/* 
+   Accesses the ports of DIO_CFG_AHB_PORT_MASK through the AHB aperture instead of APB,
+   adds the service Dio_EnableAhbAperture() which shall be called before any other access
+   to these ports (the APB aperture of a port moved to AHB does not respond)
+*/
+#define DioAhbAperture						STD_OFF
+
+/* 
+   Adds / removes the timer triggered uDMA pattern engine Dio_StartPattern() / Dio_StopPattern(),
+   the uDMA controller shall be enabled and its control table set by the integration code
+*/
+#define DioPatternApi						STD_ON
+
+/* 
+   Adds / removes the periodic input snapshot Dio_MainFunction() with per-channel debouncing,
+   and the snapshot reads Dio_ReadChannelSnapshot() / Dio_ReadPortSnapshot() / Dio_ReadPortChanged()
+*/
+#define DioInputSnapshotApi					STD_ON
+
+/* 
+   Adds / removes the GPIO interrupt edge capture Dio_StartEdgeCapture() / Dio_ReadEdgeEvents(),
+   Dio_EdgeIsr() shall be registered on the interrupt of every port of the edge configuration
+*/
+#define DioEdgeCaptureApi					STD_ON
+
+/* 
+   Adds / removes the multi-port virtual channel groups Dio_ReadVirtualGroup() / Dio_WriteVirtualGroup(),
+   the ports of a group are accessed back to back inside the exclusive area
+*/
+#define DioVirtualGroupApi					STD_ON
+
+/* 
+   Adds / removes the port expander backend, the port IDs above DIO_MAX_PORT_ID are the ports
+   of the expanders of the configuration. Writes are kept in a RAM shadow and committed by
+   Dio_MainFunction() with one bus transaction per changed expander. A read service which needs
+   input pins requests a read of their expander by the next Dio_MainFunction() and returns the
+   levels of the last read, expanders whose inputs are not read cost no transaction
+*/
+#define DioExpanderApi						STD_ON
+
+/* Configured channels, channel groups and ports */
+#define NUM_OF_USED_PINS		4
+#define NUM_OF_USED_PORTS		2
+#if (DioExpanderApi == STD_ON)
+#define NUM_OF_USED_GROUPS	3
+#else
 #define NUM_OF_USED_GROUPS	2
-
-
-#define LED1		DIO_CHANNEL_B_4
-#define LED2		DIO_CHANNEL_B_5
-#define LED3		DIO_CHANNEL_B_6
-
-#define LED1_PORT	DIO_PORT_B
-#define LED2_PORT	DIO_PORT_B
-#define LED3_PORT	DIO_PORT_B
+#endif /* DioExpanderApi */
+
+
+#define LED1	DIO_CHANNEL_B_4
+#define LED2	DIO_CHANNEL_B_5
+#define LED3	DIO_CHANNEL_B_6
+#define BUTTON1	DIO_CHANNEL_B_7
+
+#define LED1_PORT		DIO_PORT_B
+#define LED2_PORT		DIO_PORT_B
+#define LED3_PORT		DIO_PORT_B
+#define BUTTON1_PORT	DIO_PORT_B
+
+/* Output pins of each port after the board pin setup, initial value of the direction shadow */
+#define DIO_CFG_PORT_A_OUTPUT_MASK	(0x00u)
+#define DIO_CFG_PORT_B_OUTPUT_MASK	(0x7Fu)
+#define DIO_CFG_PORT_C_OUTPUT_MASK	(0x00u)
+#define DIO_CFG_PORT_D_OUTPUT_MASK	(0x00u)
+#define DIO_CFG_PORT_E_OUTPUT_MASK	(0x0Fu)
+#define DIO_CFG_PORT_F_OUTPUT_MASK	(0x0Fu)
+
+/* Configured channels of each port, used to validate constant channel IDs at compile time */
+#define DIO_CFG_PORT_A_CHANNEL_MASK	(0x00u)
+#define DIO_CFG_PORT_B_CHANNEL_MASK	(0xF0u)
+#define DIO_CFG_PORT_C_CHANNEL_MASK	(0x00u)
+#define DIO_CFG_PORT_D_CHANNEL_MASK	(0x00u)
+#define DIO_CFG_PORT_E_CHANNEL_MASK	(0x00u)
+#define DIO_CFG_PORT_F_CHANNEL_MASK	(0x00u)
+
+/*
+   Ports used by the channels, channel groups or virtual groups, bit n set for port ID n.
+   A port may be used by a group only and have no channel (DIO_CFG_PORT_x_CHANNEL_MASK 0x00),
+   it is still a valid port of Dio_ReadPort / Dio_WritePort.
+*/
+#define DIO_CFG_USED_PORT_MASK		(0x12u)
+
+/* Ports accessed through the AHB aperture if DioAhbAperture is STD_ON, bit n set for port ID n */
+#define DIO_CFG_AHB_PORT_MASK		(0x02u)
+
+/* Timer, timer interrupt and uDMA channel requested by the timer, used by the pattern engine */
+#define DIO_CFG_PATTERN_TIMER_BASE		TIMER0_BASE
+#define DIO_CFG_PATTERN_TIMER_INT		INT_TIMER0A
+#define DIO_CFG_PATTERN_UDMA_CHANNEL	UDMA_CH18_TIMER0A
+
+/* Input channels debounced by Dio_MainFunction, and the ports they are sampled from */
+#define DIO_CFG_NUM_OF_INPUT_CHANNELS	1
+#define DIO_CFG_NUM_OF_INPUT_PORTS		1
+
+/* Consecutive Dio_MainFunction cycles a new level of BUTTON1 shall be sampled before it is taken */
+#define DIO_CFG_BUTTON1_DEBOUNCE		(3u)
+
+/* Channels captured by the edge interrupt, and the ports they are on */
+#define DIO_CFG_NUM_OF_EDGE_CHANNELS	1
+#define DIO_CFG_NUM_OF_EDGE_PORTS		1
+
+/* Edge events buffered between the edge interrupt and the consumer, shall be a power of two */
+#define DIO_CFG_EDGE_RING_SIZE			(32u)
+
+/* 
+   Free running up counter read for the event timestamps (DWT_CYCCNT), the integration code 
+   shall enable it (DEMCR.TRCENA and DWT_CTRL.CYCCNTENA) before the edge capture is started
+*/
+#define DIO_CFG_EDGE_TIMESTAMP_ADDRESS	(0xE0001004u)
+
+/* Virtual channel groups, and their parts (at most one part per port in a group) */
+#define DIO_CFG_NUM_OF_VIRTUAL_GROUPS		1
+#define DIO_CFG_NUM_OF_VIRTUAL_GROUP_PARTS	2
+
+/* 8-bit bus, bits 0..3 on PB0..PB3 and bits 4..7 on PE0..PE3 */
+#define BUS8_PORT_LOW	DIO_PORT_B
+#define BUS8_PORT_HIGH	DIO_PORT_E
+
+/* Port expanders, and their ports (port ID DIO_EXPANDER_FIRST_PORT_ID + index) */
+#define DIO_CFG_NUM_OF_EXPANDERS		1
+#define DIO_CFG_NUM_OF_EXPANDER_PORTS	2
+
+/* 7-bit bus address of expander 0 (MCP23017, A2..A0 tied low) */
+#define DIO_CFG_EXPANDER0_ADDRESS		(0x20u)
+
+/* Ports of expander 0, relays on GPA0..GPA3 and a DIP switch on GPB0..GPB7 */
+#define DIO_PORT_EXP0_A		(6u)
+#define DIO_PORT_EXP0_B		(7u)
+
+#define RELAY1		(0x60u)
+#define RELAY2		(0x61u)
+#define RELAY3		(0x62u)
+#define RELAY4		(0x63u)
+#define DIPSWITCH1	(0x70u)
+
+#define RELAYS_PORT		DIO_PORT_EXP0_A
+#define DIPSWITCH_PORT	DIO_PORT_EXP0_B
+
+/* Output pins and configured channels of the expander ports */
+#define DIO_CFG_PORT_EXP0_A_OUTPUT_MASK		(0x0Fu)
+#define DIO_CFG_PORT_EXP0_B_OUTPUT_MASK		(0x00u)
+#define DIO_CFG_PORT_EXP0_A_CHANNEL_MASK	(0x0Fu)
+#define DIO_CFG_PORT_EXP0_B_CHANNEL_MASK	(0x01u)
 
 
 #endif /*DIO_CFG_H*/
-
-
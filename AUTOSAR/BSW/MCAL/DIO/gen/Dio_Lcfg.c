@@ -1,50 +1,80 @@
 /**********************************************************************************
 ***********************************************************************************
 **														  						 **		
-**	FILENAME	:	Dio_Lcfg.h                              					 **
+**	FILENAME	:	Dio_Lcfg.c													 **
 **	                                                      						 **
-**	VERSION		: 	1.0.0                                 						 **
+**	VERSION		: 	1.0.0														 **
 **                                                        						 **
-**	DATE		:	2021-3-22                             						 **
+**	DATE		:	2021-3-22													 **
 **                                                        						 **
-**	PLATFORM	:	TIVA C      		                  						 **
+**	PLATFORM	:	TIVA C														 **
 **																				 **
 **  VARIANT  	: 	NA                                                           **
 **                                                        						 **
-**	AUTHOR		:  	MohamedSayed                          						 **
+**	AUTHOR		:  	MohamedSayed												 **
 **                                                        						 **
 **	VENDOR		: 	NA				                     						 **
 **                                                        						 **
 **	                                                      						 **
-**	DESCRIPTION : Digital I/O Driver link time configuration file       		 **
+**	DESCRIPTION : Digital I/O Driver link time configuration file				 **
 **                                                                               **
-**	SPECIFICATION(S) : AUTOSAR_SWS_DIODriver, AUTOSAR Release 4.3.1              **
+**	SPECIFICATION(S) : AUTOSAR_SWS_DIODriver, AUTOSAR Release 4.3.1				 **
 **                                                       						 **
-**	MAY BE CHANGED BY USER : No                          						 **
+**	MAY BE CHANGED BY USER : No													 **
 **                                                       					     **
 ***********************************************************************************/
 
+/* Generated by tools/CfgGen/CfgGen.py from Ecu.json, changes are lost on the next generation */
+
 /*****************************************************************/
 /*				    	Include Headers					         */
 /*****************************************************************/
 
 #include "Dio.h"
 #include "Dio_MemMap.h"
+#include "hw_memmap.h"
+#include "hw_ints.h"
+
+#if (DioExpanderApi == STD_ON)
+#include "Dio_Expander.h"
+#endif /* DioExpanderApi */
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/* Decode entry of a channel ID which is not part of the configuration */
+#define DIO_DECODE_UNUSED							{ 0x00000000UL, 0x00000000UL, 0x00u, 0x00u, DIO_PIN_INPUT, FALSE }
+
+/* Decode entry of a configured channel */
+#define DIO_DECODE_CHANNEL(BASE, PORT, PIN, DIR)	{ (BASE), DIO_MASKED_DATA_ADDRESS((BASE), (1u << (PIN))), \
+													  (uint8)(1u << (PIN)), (PORT), (DIR), TRUE }
+
+/*****************************************************************/
+/*				        Configuration Objects      		         */
+/*****************************************************************/
 
 const Dio_PortChannelConfig ChannelConfig[NUM_OF_USED_PINS] = 
 {
 	{
 		LED1,
 		LED1_PORT,
-		
+		DIO_PIN_OUTPUT
 	},
 	{
 		LED2,
 		LED2_PORT,
+		DIO_PIN_OUTPUT
 	},
 	{
 		LED3,
 		LED3_PORT,
+		DIO_PIN_OUTPUT
+	},
+	{
+		BUTTON1,
+		BUTTON1_PORT,
+		DIO_PIN_INPUT
 	}
 };
 
@@ -53,23 +83,263 @@ const Dio_ChannelGroupType ChannelGroup[NUM_OF_USED_GROUPS] =
 	{
 		0xCE,
 		1,
-		LED1_PORT
+		DIO_PORT_B,
+		DIO_MASKED_DATA_ADDRESS(DIO_PORTB_BASE, 0xCE)
 	},
 	{
 		0x8E,
 		1,
-		LED1_PORT
+		DIO_PORT_B,
+		DIO_MASKED_DATA_ADDRESS(DIO_PORTB_BASE, 0x8E)
+	}
+#if (DioExpanderApi == STD_ON)
+	,
+	/* All relays, expander groups have no data address */
+	{
+		0x0F,
+		0,
+		RELAYS_PORT,
+		0x00000000UL
 	}
+#endif /* DioExpanderApi */
 };
 
-Dio_ConfigType Dio_Config = 
+
+/* 
+   Channel decode table indexed by the channel ID, 
+   resolves a channel to its port and pin in constant time
+*/
+const Dio_ChannelDecodeType ChannelDecode[DIO_NUM_OF_CHANNEL_IDS] =
 {
-	ChannelConfig,
-	ChannelGroup
+	/* 0x00 */	DIO_DECODE_UNUSED,
+	/* 0x01 */	DIO_DECODE_UNUSED,
+	/* 0x02 */	DIO_DECODE_UNUSED,
+	/* 0x03 */	DIO_DECODE_UNUSED,
+	/* 0x04 */	DIO_DECODE_UNUSED,
+	/* 0x05 */	DIO_DECODE_UNUSED,
+	/* 0x06 */	DIO_DECODE_UNUSED,
+	/* 0x07 */	DIO_DECODE_UNUSED,
+	/* 0x08 */	DIO_DECODE_UNUSED,
+	/* 0x09 */	DIO_DECODE_UNUSED,
+	/* 0x0A */	DIO_DECODE_UNUSED,
+	/* 0x0B */	DIO_DECODE_UNUSED,
+	/* 0x0C */	DIO_DECODE_UNUSED,
+	/* 0x0D */	DIO_DECODE_UNUSED,
+	/* 0x0E */	DIO_DECODE_UNUSED,
+	/* 0x0F */	DIO_DECODE_UNUSED,
+	/* 0x10 */	DIO_DECODE_UNUSED,
+	/* 0x11 */	DIO_DECODE_UNUSED,
+	/* 0x12 */	DIO_DECODE_UNUSED,
+	/* 0x13 */	DIO_DECODE_UNUSED,
+	/* 0x14 */	DIO_DECODE_CHANNEL(DIO_PORTB_BASE, DIO_PORT_B, 4u, DIO_PIN_OUTPUT),
+	/* 0x15 */	DIO_DECODE_CHANNEL(DIO_PORTB_BASE, DIO_PORT_B, 5u, DIO_PIN_OUTPUT),
+	/* 0x16 */	DIO_DECODE_CHANNEL(DIO_PORTB_BASE, DIO_PORT_B, 6u, DIO_PIN_OUTPUT),
+	/* 0x17 */	DIO_DECODE_CHANNEL(DIO_PORTB_BASE, DIO_PORT_B, 7u, DIO_PIN_INPUT),
+	/* 0x18 */	DIO_DECODE_UNUSED,
+	/* 0x19 */	DIO_DECODE_UNUSED,
+	/* 0x1A */	DIO_DECODE_UNUSED,
+	/* 0x1B */	DIO_DECODE_UNUSED,
+	/* 0x1C */	DIO_DECODE_UNUSED,
+	/* 0x1D */	DIO_DECODE_UNUSED,
+	/* 0x1E */	DIO_DECODE_UNUSED,
+	/* 0x1F */	DIO_DECODE_UNUSED,
+	/* 0x20 */	DIO_DECODE_UNUSED,
+	/* 0x21 */	DIO_DECODE_UNUSED,
+	/* 0x22 */	DIO_DECODE_UNUSED,
+	/* 0x23 */	DIO_DECODE_UNUSED,
+	/* 0x24 */	DIO_DECODE_UNUSED,
+	/* 0x25 */	DIO_DECODE_UNUSED,
+	/* 0x26 */	DIO_DECODE_UNUSED,
+	/* 0x27 */	DIO_DECODE_UNUSED,
+	/* 0x28 */	DIO_DECODE_UNUSED,
+	/* 0x29 */	DIO_DECODE_UNUSED,
+	/* 0x2A */	DIO_DECODE_UNUSED,
+	/* 0x2B */	DIO_DECODE_UNUSED,
+	/* 0x2C */	DIO_DECODE_UNUSED,
+	/* 0x2D */	DIO_DECODE_UNUSED,
+	/* 0x2E */	DIO_DECODE_UNUSED,
+	/* 0x2F */	DIO_DECODE_UNUSED,
+	/* 0x30 */	DIO_DECODE_UNUSED,
+	/* 0x31 */	DIO_DECODE_UNUSED,
+	/* 0x32 */	DIO_DECODE_UNUSED,
+	/* 0x33 */	DIO_DECODE_UNUSED,
+	/* 0x34 */	DIO_DECODE_UNUSED,
+	/* 0x35 */	DIO_DECODE_UNUSED,
+	/* 0x36 */	DIO_DECODE_UNUSED,
+	/* 0x37 */	DIO_DECODE_UNUSED,
+	/* 0x38 */	DIO_DECODE_UNUSED,
+	/* 0x39 */	DIO_DECODE_UNUSED,
+	/* 0x3A */	DIO_DECODE_UNUSED,
+	/* 0x3B */	DIO_DECODE_UNUSED,
+	/* 0x3C */	DIO_DECODE_UNUSED,
+	/* 0x3D */	DIO_DECODE_UNUSED,
+	/* 0x3E */	DIO_DECODE_UNUSED,
+	/* 0x3F */	DIO_DECODE_UNUSED,
+	/* 0x40 */	DIO_DECODE_UNUSED,
+	/* 0x41 */	DIO_DECODE_UNUSED,
+	/* 0x42 */	DIO_DECODE_UNUSED,
+	/* 0x43 */	DIO_DECODE_UNUSED,
+	/* 0x44 */	DIO_DECODE_UNUSED,
+	/* 0x45 */	DIO_DECODE_UNUSED,
+	/* 0x46 */	DIO_DECODE_UNUSED,
+	/* 0x47 */	DIO_DECODE_UNUSED,
+	/* 0x48 */	DIO_DECODE_UNUSED,
+	/* 0x49 */	DIO_DECODE_UNUSED,
+	/* 0x4A */	DIO_DECODE_UNUSED,
+	/* 0x4B */	DIO_DECODE_UNUSED,
+	/* 0x4C */	DIO_DECODE_UNUSED,
+	/* 0x4D */	DIO_DECODE_UNUSED,
+	/* 0x4E */	DIO_DECODE_UNUSED,
+	/* 0x4F */	DIO_DECODE_UNUSED,
+	/* 0x50 */	DIO_DECODE_UNUSED,
+	/* 0x51 */	DIO_DECODE_UNUSED,
+	/* 0x52 */	DIO_DECODE_UNUSED,
+	/* 0x53 */	DIO_DECODE_UNUSED
+};
+
+/* Output pins of each port, kept in RAM so the Port driver can refresh it */
+uint8 PortOutputMask[DIO_MAX_PORT_ID + 1u] =
+{
+	DIO_CFG_PORT_A_OUTPUT_MASK,
+	DIO_CFG_PORT_B_OUTPUT_MASK,
+	DIO_CFG_PORT_C_OUTPUT_MASK,
+	DIO_CFG_PORT_D_OUTPUT_MASK,
+	DIO_CFG_PORT_E_OUTPUT_MASK,
+	DIO_CFG_PORT_F_OUTPUT_MASK
 };
 
+#if (DioInputSnapshotApi == STD_ON)
 
+/* Input channels debounced by Dio_MainFunction */
+const Dio_InputChannelConfigType InputChannel[DIO_CFG_NUM_OF_INPUT_CHANNELS] =
+{
+	{
+		BUTTON1,
+		DIO_CFG_BUTTON1_DEBOUNCE
+	}
+};
+
+/* Ports sampled by Dio_MainFunction, one masked read of the input pins per port */
+const Dio_InputPortType InputPort[DIO_CFG_NUM_OF_INPUT_PORTS] =
+{
+	{
+		DIO_PORT_B,
+		0x80,
+		DIO_MASKED_DATA_ADDRESS(DIO_PORTB_BASE, 0x80)
+	}
+};
 
+#endif /* DioInputSnapshotApi */
 
+#if (DioEdgeCaptureApi == STD_ON)
 
+/* Channels captured by the edge interrupt */
+const Dio_EdgeChannelConfigType EdgeChannel[DIO_CFG_NUM_OF_EDGE_CHANNELS] =
+{
+	{
+		BUTTON1,
+		DIO_EDGE_BOTH
+	}
+};
 
+/* Ports of the edge channels, their edge pins and their GPIO interrupt */
+const Dio_EdgePortType EdgePort[DIO_CFG_NUM_OF_EDGE_PORTS] =
+{
+	{
+		DIO_PORT_B,
+		0x80,
+		INT_GPIOB
+	}
+};
+
+#endif /* DioEdgeCaptureApi */
+
+#if (DioVirtualGroupApi == STD_ON)
+
+/* Parts of the virtual groups, the parts of a group follow each other */
+const Dio_VirtualGroupPartType VirtualGroupPart[DIO_CFG_NUM_OF_VIRTUAL_GROUP_PARTS] =
+{
+	/* BUS8 */
+	{
+		BUS8_PORT_LOW,
+		0x0F,
+		0,
+		0,
+		DIO_MASKED_DATA_ADDRESS(DIO_PORTB_BASE, 0x0F)
+	},
+	{
+		BUS8_PORT_HIGH,
+		0x0F,
+		0,
+		4,
+		DIO_MASKED_DATA_ADDRESS(DIO_PORTE_BASE, 0x0F)
+	}
+};
+
+const Dio_VirtualGroupType VirtualGroup[DIO_CFG_NUM_OF_VIRTUAL_GROUPS] =
+{
+	{
+		&VirtualGroupPart[0],
+		2
+	}
+};
+
+#endif /* DioVirtualGroupApi */
+
+#if (DioExpanderApi == STD_ON)
+
+/* Port expanders and the bus transactions of their transport */
+const Dio_ExpanderType Expander[DIO_CFG_NUM_OF_EXPANDERS] =
+{
+	{
+		Dio_ExpanderWrite,
+		Dio_ExpanderRead,
+		DIO_CFG_EXPANDER0_ADDRESS,
+		0,
+		2
+	}
+};
+
+/* Expander ports in port ID order, the ports of an expander follow each other */
+const Dio_ExpanderPortType ExpanderPort[DIO_CFG_NUM_OF_EXPANDER_PORTS] =
+{
+	{
+		0,
+		DIO_CFG_PORT_EXP0_A_OUTPUT_MASK,
+		DIO_CFG_PORT_EXP0_A_CHANNEL_MASK
+	},
+	{
+		0,
+		DIO_CFG_PORT_EXP0_B_OUTPUT_MASK,
+		DIO_CFG_PORT_EXP0_B_CHANNEL_MASK
+	}
+};
+
+#endif /* DioExpanderApi */
+
+Dio_ConfigType Dio_Config = 
+{
+	ChannelConfig,
+	ChannelGroup,
+	ChannelDecode,
+	PortOutputMask
+#if (DioInputSnapshotApi == STD_ON)
+	,
+	InputChannel,
+	InputPort
+#endif /* DioInputSnapshotApi */
+#if (DioEdgeCaptureApi == STD_ON)
+	,
+	EdgeChannel,
+	EdgePort
+#endif /* DioEdgeCaptureApi */
+#if (DioVirtualGroupApi == STD_ON)
+	,
+	VirtualGroup
+#endif /* DioVirtualGroupApi */
+#if (DioExpanderApi == STD_ON)
+	,
+	Expander,
+	ExpanderPort
+#endif /* DioExpanderApi */
+};
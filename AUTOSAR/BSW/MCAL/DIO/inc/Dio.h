@@ -30,8 +30,17 @@
 /*				    	Include Headers					         */
 /*****************************************************************/
 
-#include "Std_Types.h "
+#include "Std_Types.h"
 #include "Dio_Cfg.h"
+#include "hw_memmap.h"
+
+#if (DioStaticChannelApi == STD_ON)
+#include "Common_Macros.h"
+#endif /* DioStaticChannelApi */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
 
 /*****************************************************************/
 /*				        Macros Definition       		         */
@@ -128,6 +137,52 @@
  #define DIO_FLIPCHANNEL_SID			(0x11u)
 
 #endif /* DioFlipChannelApi */
+
+#if (DioWriteChannelListApi == STD_ON)
+/* Dio_WriteChannelList Services ID (vendor specific) */
+ #define DIO_WRITECHANNELLIST_SID		(0x20u)
+
+#endif /* DioWriteChannelListApi */
+
+#if (DioDirectionShadow == STD_ON)
+/* Dio_RefreshPortDirection Services ID (vendor specific) */
+ #define DIO_REFRESHPORTDIRECTION_SID	(0x21u)
+
+#endif /* DioDirectionShadow */
+
+#if (DioAhbAperture == STD_ON)
+/* Dio_EnableAhbAperture Services ID (vendor specific) */
+ #define DIO_ENABLEAHBAPERTURE_SID		(0x22u)
+
+#endif /* DioAhbAperture */
+
+#if (DioPatternApi == STD_ON)
+/* Dio_StartPattern / Dio_StopPattern Services ID (vendor specific) */
+ #define DIO_STARTPATTERN_SID			(0x23u)
+ #define DIO_STOPPATTERN_SID			(0x24u)
+
+#endif /* DioPatternApi */
+
+#if (DioInputSnapshotApi == STD_ON)
+/* Dio snapshot read Services ID (vendor specific), Dio_MainFunction (0x28) has no DET checks */
+ #define DIO_READCHANNELSNAPSHOT_SID	(0x25u)
+ #define DIO_READPORTSNAPSHOT_SID		(0x26u)
+ #define DIO_READPORTCHANGED_SID		(0x27u)
+
+#endif /* DioInputSnapshotApi */
+
+#if (DioEdgeCaptureApi == STD_ON)
+/* Dio_ReadEdgeEvents Services ID (vendor specific), the other edge capture services have no DET checks */
+ #define DIO_READEDGEEVENTS_SID			(0x2Bu)
+
+#endif /* DioEdgeCaptureApi */
+
+#if (DioVirtualGroupApi == STD_ON)
+/* Dio_ReadVirtualGroup / Dio_WriteVirtualGroup Services ID (vendor specific) */
+ #define DIO_READVIRTUALGROUP_SID		(0x2Du)
+ #define DIO_WRITEVIRTUALGROUP_SID		(0x2Eu)
+
+#endif /* DioVirtualGroupApi */
  
 /******* Devlopment Errors Macron definition *****/
 
@@ -143,6 +198,9 @@
 /* This Error is called whenever a Null pointer exists */
 #define DIO_E_PARAM_POINTER			   (0x20u)
 
+/* if the samples, their number or the period of a pattern are invalid (vendor specific) */
+#define DIO_E_PARAM_INVALID_PATTERN	   (0x21u)
+
 #endif /* DioDevErrorDetect */ 
 
 /*****************************************************************/
@@ -155,6 +213,65 @@
 /* The maximum port IDs for Tiva C controller */
 #define DIO_MAX_PORT_ID	    (5u)
 
+/* Number of entries in the channel decode table (one per possible channel ID) */
+#define DIO_NUM_OF_CHANNEL_IDS	(DIO_MAX_CHANNEL_ID + 1u)
+
+/* Port ID and pin mask of a channel ID, channel IDs are (Port << 4) | Pin */
+#define DIO_CHANNEL_PORT(ChannelId)			((uint8)((uint32)(ChannelId) >> 4u))
+#define DIO_CHANNEL_PIN_MASK(ChannelId)		((uint8)(1u << ((uint32)(ChannelId) & 0x0Fu)))
+
+#if (DioExpanderApi == STD_ON)
+/* Port ID of the first expander port, the expander ports follow the MCU ports */
+#define DIO_EXPANDER_FIRST_PORT_ID	(DIO_MAX_PORT_ID + 1u)
+#endif /* DioExpanderApi */
+
+/* Dio directions definitions */
+#define DIO_PIN_INPUT	(0u)
+#define DIO_PIN_OUTPUT	(1u)
+
+/* 
+   Masked GPIODATA address of a port, address bits [9:2] select the pins 
+   affected by an access so a single store changes only the masked pins 
+*/
+#define DIO_MASKED_DATA_ADDRESS(BASE, MASK)	((uint32)(BASE) + ((uint32)(MASK) << 2u))
+
+/* Base address the driver uses for each port, AHB or APB aperture */
+#if ((DioAhbAperture == STD_ON) && ((DIO_CFG_AHB_PORT_MASK & 0x01u) != 0u))
+#define DIO_PORTA_BASE	GPIO_PORTA_AHB_BASE
+#else
+#define DIO_PORTA_BASE	GPIO_PORTA_BASE
+#endif
+
+#if ((DioAhbAperture == STD_ON) && ((DIO_CFG_AHB_PORT_MASK & 0x02u) != 0u))
+#define DIO_PORTB_BASE	GPIO_PORTB_AHB_BASE
+#else
+#define DIO_PORTB_BASE	GPIO_PORTB_BASE
+#endif
+
+#if ((DioAhbAperture == STD_ON) && ((DIO_CFG_AHB_PORT_MASK & 0x04u) != 0u))
+#define DIO_PORTC_BASE	GPIO_PORTC_AHB_BASE
+#else
+#define DIO_PORTC_BASE	GPIO_PORTC_BASE
+#endif
+
+#if ((DioAhbAperture == STD_ON) && ((DIO_CFG_AHB_PORT_MASK & 0x08u) != 0u))
+#define DIO_PORTD_BASE	GPIO_PORTD_AHB_BASE
+#else
+#define DIO_PORTD_BASE	GPIO_PORTD_BASE
+#endif
+
+#if ((DioAhbAperture == STD_ON) && ((DIO_CFG_AHB_PORT_MASK & 0x10u) != 0u))
+#define DIO_PORTE_BASE	GPIO_PORTE_AHB_BASE
+#else
+#define DIO_PORTE_BASE	GPIO_PORTE_BASE
+#endif
+
+#if ((DioAhbAperture == STD_ON) && ((DIO_CFG_AHB_PORT_MASK & 0x20u) != 0u))
+#define DIO_PORTF_BASE	GPIO_PORTF_AHB_BASE
+#else
+#define DIO_PORTF_BASE	GPIO_PORTF_BASE
+#endif
+
 /*****************************************************************/
 /*				        Types Definition        		         */
 /*****************************************************************/
@@ -184,9 +301,211 @@ typedef struct
 	
 	/* Port on which the Channel group is defined */
 	Dio_PortType    port;	
+	
+	/* Precomputed masked data address of the channel group (DIO_MASKED_DATA_ADDRESS) */
+	uint32			DataAddress;
 }Dio_ChannelGroupType;
 
 
+#if (DioPatternApi == STD_ON)
+/* Maximum number of samples of a pattern (one uDMA basic transfer) */
+#define DIO_PATTERN_MAX_SAMPLES		(1024u)
+
+/* Sample of a pattern from a channel group level, aligned to the group's port bits */
+#define DIO_PATTERN_SAMPLE(LEVEL, OFFSET)	((Dio_PortLevelType)((LEVEL) << (OFFSET)))
+
+/* Type defenition of the notifications of the pattern engine */
+typedef void (*Dio_PatternNotificationType)(void);
+
+/* Type defenition of a pattern streamed to a channel group by the pattern engine */
+typedef struct 
+{
+	/* Channel group the samples are written to */
+	const Dio_ChannelGroupType*	Group;
+	
+	/* Samples in port bit positions (DIO_PATTERN_SAMPLE), kept in RAM for the uDMA */
+	const Dio_PortLevelType*	Samples;
+	
+	/* Number of samples, 1 to DIO_PATTERN_MAX_SAMPLES */
+	uint16						NumOfSamples;
+	
+	/* Time between two samples in timer (system clock) ticks */
+	uint32						Period;
+	
+	/* TRUE to restart from the first sample after the last one */
+	boolean						Repeat;
+	
+	/* Called when the pattern is started, stopped and after its last sample, may be NULL_PTR */
+	Dio_PatternNotificationType	StartNotification;
+	Dio_PatternNotificationType	StopNotification;
+	Dio_PatternNotificationType	CompleteNotification;
+}Dio_PatternType;
+
+#endif /* DioPatternApi */
+
+#if (DioInputSnapshotApi == STD_ON)
+
+/* Type defenition of one input channel debounced by Dio_MainFunction */
+typedef struct 
+{
+	/* ID of the DIO input channel */
+	Dio_ChannelType ChannelId;
+	
+	/* Consecutive Dio_MainFunction cycles a new level shall be sampled before it is taken (1 = no filter) */
+	uint8			DebounceCycles;
+}Dio_InputChannelConfigType;
+
+/* Type defenition of one port sampled by Dio_MainFunction */
+typedef struct 
+{
+	/* Port to be sampled */
+	Dio_PortType	PortId;
+	
+	/* Input pins of the port which are debounced */
+	uint8			InputMask;
+	
+	/* Precomputed masked data address of the input pins (DIO_MASKED_DATA_ADDRESS) */
+	uint32			DataAddress;
+}Dio_InputPortType;
+
+#endif /* DioInputSnapshotApi */
+
+#if (DioEdgeCaptureApi == STD_ON)
+
+/* Edges captured on an edge channel (Dio_EdgeChannelConfigType.Edge) */
+#define DIO_EDGE_RISING		(0x01u)
+#define DIO_EDGE_FALLING	(0x02u)
+#define DIO_EDGE_BOTH		(DIO_EDGE_RISING | DIO_EDGE_FALLING)
+
+/* Type defenition of one channel captured by the edge interrupt */
+typedef struct 
+{
+	/* ID of the DIO input channel */
+	Dio_ChannelType ChannelId;
+	
+	/* Captured edges, DIO_EDGE_RISING / DIO_EDGE_FALLING / DIO_EDGE_BOTH */
+	uint8			Edge;
+}Dio_EdgeChannelConfigType;
+
+/* Type defenition of one port with edge channels */
+typedef struct 
+{
+	/* Port of the edge channels */
+	Dio_PortType	PortId;
+	
+	/* Pins of the edge channels, the only ones served by Dio_EdgeIsr */
+	uint8			PinMask;
+	
+	/* GPIO interrupt of the port (INT_GPIOx) */
+	uint32			Interrupt;
+}Dio_EdgePortType;
+
+/* Type defenition of one captured edge, read by Dio_ReadEdgeEvents */
+typedef struct 
+{
+	/* Value of DIO_CFG_EDGE_TIMESTAMP_ADDRESS when the edge was served */
+	uint32			Timestamp;
+	
+	/* Channel on which the edge was captured */
+	Dio_ChannelType ChannelId;
+	
+	/* Level of the channel sampled in the interrupt, STD_HIGH after a rising edge */
+	Dio_LevelType	Level;
+}Dio_EdgeEventType;
+
+#endif /* DioEdgeCaptureApi */
+
+#if (DioVirtualGroupApi == STD_ON)
+
+/* Type defenition of the level of a virtual group, aligned to the LSB */
+typedef uint32 Dio_VirtualGroupLevelType;
+
+/* 
+   Type defenition of the pins of one port in a virtual group, the adjoining pins 
+   Mask (starting at pin PinOffset) hold the group bits starting at bit ValueShift
+*/
+typedef struct 
+{
+	/* Port of the part */
+	Dio_PortType	PortId;
+	
+	/* Pins of the port in the group */
+	uint8			Mask;
+	
+	/* Lowest pin of Mask */
+	uint8			PinOffset;
+	
+	/* Position of the part's lowest bit in the group level */
+	uint8			ValueShift;
+	
+	/* Precomputed masked data address of the part (DIO_MASKED_DATA_ADDRESS) */
+	uint32			DataAddress;
+}Dio_VirtualGroupPartType;
+
+/* Type defenition of a channel group spanning several ports */
+typedef struct 
+{
+	/* First part of the group, the other parts follow it */
+	const Dio_VirtualGroupPartType* Parts;
+	
+	/* Number of parts, at most one per port */
+	uint8							NumOfParts;
+}Dio_VirtualGroupType;
+
+#endif /* DioVirtualGroupApi */
+
+#if (DioExpanderApi == STD_ON)
+
+/* Type defenition of the bus transaction writing the output latches of the ports of an expander */
+typedef Std_ReturnType (*Dio_ExpanderWriteType)(uint8 DeviceAddress, const uint8* DataPtr, uint8 Length);
+
+/* Type defenition of the bus transaction reading the pin levels of the ports of an expander */
+typedef Std_ReturnType (*Dio_ExpanderReadType)(uint8 DeviceAddress, uint8* DataPtr, uint8 Length);
+
+/* Type defenition of a port expander */
+typedef struct 
+{
+	/* Writes all ports of the expander in one transaction */
+	Dio_ExpanderWriteType	Write;
+	
+	/* Reads all ports of the expander in one transaction */
+	Dio_ExpanderReadType	Read;
+	
+	/* Bus address of the expander */
+	uint8					DeviceAddress;
+	
+	/* Index of the first port of the expander in the expander port table */
+	uint8					FirstPort;
+	
+	/* Number of ports of the expander */
+	uint8					NumOfPorts;
+}Dio_ExpanderType;
+
+/* Type defenition of one expander port, the port ID is DIO_EXPANDER_FIRST_PORT_ID + its index */
+typedef struct 
+{
+	/* Index of the port's expander in the expander table */
+	uint8			Expander;
+	
+	/* Output pins of the port, the direction of the expander pins is static */
+	uint8			OutputMask;
+	
+	/* Configured channels of the port */
+	uint8			ChannelMask;
+}Dio_ExpanderPortType;
+
+#endif /* DioExpanderApi */
+
+/* Type defenition of one channel / level pair written by Dio_WriteChannelList */
+typedef struct 
+{
+	/* ID of the DIO channel to be written */
+	Dio_ChannelType ChannelId;
+	
+	/* Level to be written to the channel */
+	Dio_LevelType	Level;
+}Dio_ChannelLevelType;
+
 /* Type defenition to hold channel and port configuration */
 typedef struct 
 {
@@ -195,8 +514,36 @@ typedef struct
 	
 	/* Variable to hold the Port ID */
 	Dio_PortType	PortId;
+	
+	/* Variable to hold the channel direction (DIO_PIN_INPUT / DIO_PIN_OUTPUT) */
+	uint8			Direction;
 }Dio_PortChannelConfig;
 
+/* 
+   Type defenition to hold the precomputed decode data of a channel, 
+   the decode table is indexed directly by the channel ID 
+*/
+typedef struct 
+{
+	/* Base address of the port on which the channel is defined */
+	uint32			PortAddress;
+	
+	/* Precomputed masked data address of the channel (DIO_MASKED_DATA_ADDRESS) */
+	uint32			DataAddress;
+	
+	/* Mask of the channel's pin within its port */
+	uint8			PinMask;
+	
+	/* Port on which the channel is defined */
+	Dio_PortType	PortId;
+	
+	/* Configured channel direction (DIO_PIN_INPUT / DIO_PIN_OUTPUT) */
+	uint8			Direction;
+	
+	/* TRUE if the channel ID is part of the current configuration */
+	boolean			Valid;
+}Dio_ChannelDecodeType;
+
 /* Type defenition to hold all configuration parameters of the AUTOSAR DIO module */
 typedef struct 
 {
@@ -205,6 +552,41 @@ typedef struct
 		
 	/* Pointer to channel group configuration */	
 	const Dio_ChannelGroupType*        Dio_ChannelGroup;
+	
+	/* Pointer to channel decode table (DIO_NUM_OF_CHANNEL_IDS entries) */
+	const Dio_ChannelDecodeType*	   Dio_ChannelDecode;
+	
+	/* Pointer to the RAM shadow of the output pins of each port (DIO_MAX_PORT_ID + 1 entries) */
+	uint8*							   Dio_PortOutputMask;
+	
+#if (DioInputSnapshotApi == STD_ON)
+	/* Pointer to the debounced input channels (DIO_CFG_NUM_OF_INPUT_CHANNELS entries) */
+	const Dio_InputChannelConfigType*  Dio_InputChannel;
+	
+	/* Pointer to the sampled ports (DIO_CFG_NUM_OF_INPUT_PORTS entries) */
+	const Dio_InputPortType*		   Dio_InputPort;
+#endif /* DioInputSnapshotApi */
+	
+#if (DioEdgeCaptureApi == STD_ON)
+	/* Pointer to the edge channels (DIO_CFG_NUM_OF_EDGE_CHANNELS entries) */
+	const Dio_EdgeChannelConfigType*   Dio_EdgeChannel;
+	
+	/* Pointer to the edge ports (DIO_CFG_NUM_OF_EDGE_PORTS entries) */
+	const Dio_EdgePortType*			   Dio_EdgePort;
+#endif /* DioEdgeCaptureApi */
+	
+#if (DioVirtualGroupApi == STD_ON)
+	/* Pointer to the virtual groups (DIO_CFG_NUM_OF_VIRTUAL_GROUPS entries) */
+	const Dio_VirtualGroupType*		   Dio_VirtualGroup;
+#endif /* DioVirtualGroupApi */
+	
+#if (DioExpanderApi == STD_ON)
+	/* Pointer to the port expanders (DIO_CFG_NUM_OF_EXPANDERS entries) */
+	const Dio_ExpanderType*			   Dio_Expander;
+	
+	/* Pointer to the expander ports (DIO_CFG_NUM_OF_EXPANDER_PORTS entries) */
+	const Dio_ExpanderPortType*		   Dio_ExpanderPort;
+#endif /* DioExpanderApi */
 }Dio_ConfigType;
 
 
@@ -486,5 +868,633 @@ Dio_LevelType Dio_FlipChannel
 
 #endif /* DioFlipChannelApi */
 
+#if (DioWriteChannelListApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_WriteChannelList                             				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_WriteChannelList									 	 **
+**				  ( 															 **
+**					const Dio_ChannelLevelType * const ChannelListPtr,		     **
+**					const uint8 NumOfChannels 									 **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -sets the levels of a list of DIO channels					 **
+**				  -merges the channels of each port into one mask and value		 **
+**				   and sets each port with a single store						 **
+**				  -have no effect on the physical output level On Input Channels **
+**				  -only available if DioWriteChannelListApi is STD_ON			 **
+**                                                        						 **
+**	Service ID:   0x20                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): ChannelListPtr - Pointer to the channel / level pairs       **
+**					 NumOfChannels  - Number of entries in the list				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_WriteChannelList
+(
+	const Dio_ChannelLevelType* const ChannelListPtr,
+	const uint8 NumOfChannels
+);
+
+#endif /* DioWriteChannelListApi */
+
+#if (DioDirectionShadow == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_RefreshPortDirection                         				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_RefreshPortDirection							 	 	 **
+**				  ( 															 **
+**					const Dio_PortType PortId								     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -reloads the output pins shadow of a port from its			 **
+**				   direction register											 **
+**				  -shall be called by the Port driver (or the application)		 **
+**				   after the direction of any pin of the port is changed		 **
+**				  -only available if DioDirectionShadow is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x21                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId - ID of DIO Port                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_RefreshPortDirection( const Dio_PortType PortId );
+
+#endif /* DioDirectionShadow */
+
+#if (DioAhbAperture == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_EnableAhbAperture                         				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_EnableAhbAperture( void )						 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -moves the ports of DIO_CFG_AHB_PORT_MASK to the AHB			 **
+**				   aperture (GPIOHBCTL), the other ports stay on APB			 **
+**				  -shall be called once at start-up, before the pins of these	 **
+**				   ports are set up and before any other Dio service			 **
+**				  -only available if DioAhbAperture is STD_ON					 **
+**                                                        						 **
+**	Service ID:   0x22                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_EnableAhbAperture( void );
+
+#endif /* DioAhbAperture */
+
+#if (DioPatternApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_StartPattern                               				 **
+**	                                                      						 **
+**	Syntax:	      Std_ReturnType Dio_StartPattern							 	 **
+**				  ( 															 **
+**					const Dio_PatternType * const PatternPtr				     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -starts streaming the samples of a pattern to its channel		 **
+**				   group, one sample every Period timer ticks					 **
+**				  -the samples are moved by the uDMA on the timer request,		 **
+**				   the CPU only runs at the end of the table					 **
+**				  -input pins of the group are not written						 **
+**				  -only available if DioPatternApi is STD_ON					 **
+**                                                        						 **
+**	Service ID:   0x23                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Asynchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): PatternPtr - Pointer to the pattern, it shall stay valid	 **
+**								  until the pattern completes or is stopped		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: E_OK     - The pattern is started				 				 **
+**				  E_NOT_OK - A pattern is already running or a development		 **
+**							 error ocurred										 **
+**                                                       						 **
+***********************************************************************************/
+Std_ReturnType Dio_StartPattern( const Dio_PatternType* const PatternPtr );
+
+/**********************************************************************************
+**	Service name: Dio_StopPattern                               				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_StopPattern( void )								 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -stops the running pattern, the group keeps the level of		 **
+**				   the last sample written										 **
+**				  -calls the stop notification of the stopped pattern			 **
+**				  -only available if DioPatternApi is STD_ON					 **
+**                                                        						 **
+**	Service ID:   0x24                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_StopPattern( void );
+
+/**********************************************************************************
+**	Service name: Dio_PatternIsr                               					 **
+**	                                                      						 **
+**	Syntax:	      void Dio_PatternIsr( void )								 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -is the interrupt handler of DIO_CFG_PATTERN_TIMER_INT,		 **
+**				   it shall be placed in the vector table (or IntRegister)		 **
+**				  -runs once at the end of the table, re-arms a repeated		 **
+**				   pattern and calls the completion notification				 **
+**				  -only available if DioPatternApi is STD_ON					 **
+**                                                        						 **
+**	Service ID:   NA                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_PatternIsr( void );
+
+#endif /* DioPatternApi */
+
+#if ((DioInputSnapshotApi == STD_ON) || (DioExpanderApi == STD_ON))
+/**********************************************************************************
+**	Service name: Dio_MainFunction                         						 **
+**	                                                      						 **
+**	Syntax:	      void Dio_MainFunction( void )							 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -samples the input pins of every configured input port		 **
+**				   with one masked read per port								 **
+**				  -debounces each input channel with a counter, a new level is	 **
+**				   taken after DebounceCycles consecutive samples				 **
+**				  -updates the RAM snapshot and the mask of the channels		 **
+**				   changed in this cycle										 **
+**				  -shall be called periodically, the first call takes the		 **
+**				   sampled levels without debouncing							 **
+**				  -commits the writes of the cycle to the port expanders, one	 **
+**				   transaction per expander whose outputs changed, and drops	 **
+**				   the input levels read from the expanders in this cycle		 **
+**				  -only available if DioInputSnapshotApi or DioExpanderApi		 **
+**				   is STD_ON													 **
+**                                                        						 **
+**	Service ID:   0x28                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_MainFunction( void );
+
+#endif /* DioInputSnapshotApi, DioExpanderApi */
+
+#if (DioInputSnapshotApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_ReadChannelSnapshot                         				 **
+**	                                                      						 **
+**	Syntax:	      Dio_LevelType Dio_ReadChannelSnapshot						 	 **
+**				  ( 															 **
+**					const Dio_ChannelType ChannelId							     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the debounced level of an input channel from the		 **
+**				   snapshot of the last Dio_MainFunction cycle, no register		 **
+**				   is accessed													 **
+**				  -returns STD_LOW before the first Dio_MainFunction cycle		 **
+**				  -only available if DioInputSnapshotApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x25                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): ChannelId - ID of a debounced DIO input channel     		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_LevelType - STD_HIGH / STD_LOW						 	 **
+**                                                       						 **
+***********************************************************************************/
+Dio_LevelType Dio_ReadChannelSnapshot( const Dio_ChannelType ChannelId );
+
+/**********************************************************************************
+**	Service name: Dio_ReadPortSnapshot                         					 **
+**	                                                      						 **
+**	Syntax:	      Dio_PortLevelType Dio_ReadPortSnapshot					 	 **
+**				  ( 															 **
+**					const Dio_PortType PortId								     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the debounced levels of the input channels of a		 **
+**				   port from the snapshot, the other pins read as 0				 **
+**				  -only available if DioInputSnapshotApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x26                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId - ID of DIO Port                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_PortLevelType - Debounced levels of the port			 	 **
+**                                                       						 **
+***********************************************************************************/
+Dio_PortLevelType Dio_ReadPortSnapshot( const Dio_PortType PortId );
+
+/**********************************************************************************
+**	Service name: Dio_ReadPortChanged                         					 **
+**	                                                      						 **
+**	Syntax:	      Dio_PortLevelType Dio_ReadPortChanged						 	 **
+**				  ( 															 **
+**					const Dio_PortType PortId								     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the input channels of a port whose debounced level	 **
+**				   changed in the last Dio_MainFunction cycle					 **
+**				  -the mask is replaced every cycle, it is not cleared by		 **
+**				   reading so any number of consumers may read it				 **
+**				  -only available if DioInputSnapshotApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x27                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId - ID of DIO Port                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_PortLevelType - Mask of the changed channels			 	 **
+**                                                       						 **
+***********************************************************************************/
+Dio_PortLevelType Dio_ReadPortChanged( const Dio_PortType PortId );
+
+#endif /* DioInputSnapshotApi */
+
+#if (DioEdgeCaptureApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_StartEdgeCapture                         					 **
+**	                                                      						 **
+**	Syntax:	      void Dio_StartEdgeCapture( void )						 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -selects the configured edges of every edge channel in		 **
+**				   its port's interrupt registers and unmasks them				 **
+**				  -enables the GPIO interrupt of every edge port				 **
+**				  -the channels shall be configured as input and				 **
+**				   Dio_EdgeIsr registered on the edge port interrupts			 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x29                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_StartEdgeCapture( void );
+
+/**********************************************************************************
+**	Service name: Dio_StopEdgeCapture                         					 **
+**	                                                      						 **
+**	Syntax:	      void Dio_StopEdgeCapture( void )						 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -masks the edge channels and disables the GPIO interrupt		 **
+**				   of every edge port											 **
+**				  -events already in the ring can still be read					 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2A                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_StopEdgeCapture( void );
+
+/**********************************************************************************
+**	Service name: Dio_ReadEdgeEvents                         					 **
+**	                                                      						 **
+**	Syntax:	      uint16 Dio_ReadEdgeEvents									 	 **
+**				  ( 															 **
+**					Dio_EdgeEventType* const EventsPtr,						     **
+**					const uint16 MaxEvents										 **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -moves up to MaxEvents of the oldest captured edge events		 **
+**				   to EventsPtr, in the order they were captured				 **
+**				  -the ring has a single consumer, the API shall only be		 **
+**				   called from one task											 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2B                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): MaxEvents - Size of the EventsPtr array	     			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   EventsPtr - Events read from the ring 				 	 **
+**                                                                               **
+**	Return value: uint16 - Number of events read							 	 **
+**                                                       						 **
+***********************************************************************************/
+uint16 Dio_ReadEdgeEvents( Dio_EdgeEventType* const EventsPtr, const uint16 MaxEvents );
+
+/**********************************************************************************
+**	Service name: Dio_GetEdgeOverflowCount                         				 **
+**	                                                      						 **
+**	Syntax:	      uint32 Dio_GetEdgeOverflowCount( void )					 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the number of edge events lost because the ring		 **
+**				   was full, the newest events are the ones dropped				 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2C                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: uint32 - Number of lost events since start-up			 	 **
+**                                                       						 **
+***********************************************************************************/
+uint32 Dio_GetEdgeOverflowCount( void );
+
+/**********************************************************************************
+**	Service name: Dio_EdgeIsr                         							 **
+**	                                                      						 **
+**	Syntax:	      void Dio_EdgeIsr( void )								 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -interrupt handler of the edge ports, shall be registered		 **
+**				   on the GPIO interrupt of every port of the edge				 **
+**				   configuration												 **
+**				  -acknowledges the captured edges and pushes one event			 **
+**				   (channel, level, timestamp) per edge into the ring			 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   NA                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_EdgeIsr( void );
+
+#endif /* DioEdgeCaptureApi */
+
+#if (DioVirtualGroupApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_ReadVirtualGroup                         					 **
+**	                                                      						 **
+**	Syntax:	      Dio_VirtualGroupLevelType Dio_ReadVirtualGroup			 	 **
+**				  ( 															 **
+**					const Dio_VirtualGroupType* const GroupPtr				     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -reads the ports of a virtual group back to back inside		 **
+**				   the exclusive area and assembles the group value				 **
+**				  -only available if DioVirtualGroupApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2D                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): GroupPtr - Pointer to the virtual group		     		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_VirtualGroupLevelType - Level of the group				 **
+**                                                       						 **
+***********************************************************************************/
+Dio_VirtualGroupLevelType Dio_ReadVirtualGroup( const Dio_VirtualGroupType* const GroupPtr );
+
+/**********************************************************************************
+**	Service name: Dio_WriteVirtualGroup                         				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_WriteVirtualGroup								 	 **
+**				  ( 															 **
+**					const Dio_VirtualGroupType* const GroupPtr,				     **
+**					const Dio_VirtualGroupLevelType Level						 **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -splits Level into the values of the ports of a virtual		 **
+**				   group, then writes the ports back to back inside the			 **
+**				   exclusive area												 **
+**				  -input pins of the group are not changed						 **
+**				  -only available if DioVirtualGroupApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2E                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): GroupPtr - Pointer to the virtual group		     		 **
+**					 Level	  - Value to be written, aligned to the LSB			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_WriteVirtualGroup( const Dio_VirtualGroupType* const GroupPtr, const Dio_VirtualGroupLevelType Level );
+
+#endif /* DioVirtualGroupApi */
+
+#if (DioStaticChannelApi == STD_ON)
+/*****************************************************************/
+/*				    Compile Time Channel Access   		         */
+/*****************************************************************/
+
+/* Base address of a port ID */
+#define DIO_PORT_BASE(PortId)					\
+	(((PortId) == 0u) ? DIO_PORTA_BASE :		\
+	 ((PortId) == 1u) ? DIO_PORTB_BASE :		\
+	 ((PortId) == 2u) ? DIO_PORTC_BASE :		\
+	 ((PortId) == 3u) ? DIO_PORTD_BASE :		\
+	 ((PortId) == 4u) ? DIO_PORTE_BASE :		\
+						DIO_PORTF_BASE)
+
+/* Configured channels of a port ID */
+#define DIO_CFG_PORT_CHANNEL_MASK(PortId)				\
+	(((PortId) == 0u) ? DIO_CFG_PORT_A_CHANNEL_MASK :	\
+	 ((PortId) == 1u) ? DIO_CFG_PORT_B_CHANNEL_MASK :	\
+	 ((PortId) == 2u) ? DIO_CFG_PORT_C_CHANNEL_MASK :	\
+	 ((PortId) == 3u) ? DIO_CFG_PORT_D_CHANNEL_MASK :	\
+	 ((PortId) == 4u) ? DIO_CFG_PORT_E_CHANNEL_MASK :	\
+	 ((PortId) == 5u) ? DIO_CFG_PORT_F_CHANNEL_MASK : 0u)
+
+/* TRUE if the channel ID is a compile time constant of the current configuration */
+#define DIO_STATIC_CHANNEL_VALID(ChannelId)							\
+	(IS_CONSTANT(ChannelId) &&										\
+	 ((uint32)(ChannelId) <= DIO_MAX_CHANNEL_ID) &&					\
+	 (((uint32)(ChannelId) & 0x0Fu) < 8u) &&						\
+	 (0u != (DIO_CFG_PORT_CHANNEL_MASK(DIO_CHANNEL_PORT(ChannelId)) &	\
+			 DIO_CHANNEL_PIN_MASK(ChannelId))))
+
+/* Masked GPIODATA address of a constant channel ID */
+#define DIO_STATIC_DATA_ADDRESS(ChannelId)	\
+	DIO_MASKED_DATA_ADDRESS(DIO_PORT_BASE(DIO_CHANNEL_PORT(ChannelId)), DIO_CHANNEL_PIN_MASK(ChannelId))
+
+/*
+   Reads a channel with a single load if ChannelId is a configured constant,
+   else calls Dio_ReadChannel() which does the runtime checks.
+*/
+#define Dio_ReadChannelStatic(ChannelId)								\
+	(DIO_STATIC_CHANNEL_VALID(ChannelId) ?							\
+	 ((0u != GET_PORT(DIO_STATIC_DATA_ADDRESS(ChannelId))) ? STD_HIGH : STD_LOW) :	\
+	 Dio_ReadChannel(ChannelId))
+
+/*
+   Writes a channel with a single store if ChannelId is a configured constant,
+   else calls Dio_WriteChannel() which does the runtime checks.
+   GPIODATA writes only affect pins configured as outputs, so input
+   channels keep their level as required by SWS_Dio_00070.
+*/
+#define Dio_WriteChannelStatic(ChannelId, Level)						\
+	do																\
+	{																\
+		if(DIO_STATIC_CHANNEL_VALID(ChannelId))						\
+		{															\
+			SET_PORT(DIO_STATIC_DATA_ADDRESS(ChannelId), ((STD_LOW != (Level)) ? 0xFFu : 0x00u));	\
+		}															\
+		else														\
+		{															\
+			Dio_WriteChannel((ChannelId), (Level));					\
+		}															\
+	}while(0)
+
+#endif /* DioStaticChannelApi */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /*DIO_H*/
 
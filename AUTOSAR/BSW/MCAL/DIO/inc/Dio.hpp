@@ -0,0 +1,256 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Dio.hpp														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Typed C++ layer of the Digital I/O Driver						 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef DIO_HPP
+#define DIO_HPP
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Dio.h"
+#include "Common_Macros.h"
+
+#if (__cplusplus < 201703L)
+#error "Dio.hpp requires C++17."
+#endif /* __cplusplus */
+
+/*
+   Header only C++ layer over the DIO driver. A pin or a group is a type, its port
+   and pins are template arguments checked against the generated configuration
+   (Dio_Cfg.h) when the type is used, so a wrong channel does not compile instead of
+   being reported to the DET at run time. Every access resolves to one load or one
+   store on the masked GPIODATA address, there are no objects and no function calls.
+
+   Only the ports of the MCU are covered, the expander channels and the runtime
+   configured channel groups go through the C services of Dio.h.
+   The direction checks use DIO_CFG_PORT_x_OUTPUT_MASK, a direction changed at run
+   time (Dio_RefreshPortDirection) is not seen by them.
+*/
+
+namespace Dio
+{
+
+/*****************************************************************/
+/*				    Configuration Lookups   	    	         */
+/*****************************************************************/
+
+/* Base address of a port ID, follows DioAhbAperture as the C driver does */
+constexpr uint32 PortBase(const Dio_PortType PortId)
+{
+	return ((PortId == 0u) ? (uint32)DIO_PORTA_BASE :
+			(PortId == 1u) ? (uint32)DIO_PORTB_BASE :
+			(PortId == 2u) ? (uint32)DIO_PORTC_BASE :
+			(PortId == 3u) ? (uint32)DIO_PORTD_BASE :
+			(PortId == 4u) ? (uint32)DIO_PORTE_BASE :
+							 (uint32)DIO_PORTF_BASE);
+}
+
+/* Configured channels of a port ID */
+constexpr uint8 PortChannelMask(const Dio_PortType PortId)
+{
+	return ((PortId == 0u) ? (uint8)DIO_CFG_PORT_A_CHANNEL_MASK :
+			(PortId == 1u) ? (uint8)DIO_CFG_PORT_B_CHANNEL_MASK :
+			(PortId == 2u) ? (uint8)DIO_CFG_PORT_C_CHANNEL_MASK :
+			(PortId == 3u) ? (uint8)DIO_CFG_PORT_D_CHANNEL_MASK :
+			(PortId == 4u) ? (uint8)DIO_CFG_PORT_E_CHANNEL_MASK :
+			(PortId == 5u) ? (uint8)DIO_CFG_PORT_F_CHANNEL_MASK : (uint8)0u);
+}
+
+/* Output pins of a port ID after the board pin setup */
+constexpr uint8 PortOutputMask(const Dio_PortType PortId)
+{
+	return ((PortId == 0u) ? (uint8)DIO_CFG_PORT_A_OUTPUT_MASK :
+			(PortId == 1u) ? (uint8)DIO_CFG_PORT_B_OUTPUT_MASK :
+			(PortId == 2u) ? (uint8)DIO_CFG_PORT_C_OUTPUT_MASK :
+			(PortId == 3u) ? (uint8)DIO_CFG_PORT_D_OUTPUT_MASK :
+			(PortId == 4u) ? (uint8)DIO_CFG_PORT_E_OUTPUT_MASK :
+			(PortId == 5u) ? (uint8)DIO_CFG_PORT_F_OUTPUT_MASK : (uint8)0u);
+}
+
+/* Position of the lowest pin of a mask, the offset of a channel group */
+constexpr uint8 MaskOffset(const uint8 Mask)
+{
+	uint8 Offset = 0u;
+	
+	while((Offset < 7u) && (0u == (Mask & (1u << Offset))))
+	{
+		Offset++;
+	}
+	
+	return (Offset);
+}
+
+/*****************************************************************/
+/*				        Channel Types        		  	         */
+/*****************************************************************/
+
+/* One DIO channel, pin PinId of port PortId */
+template<Dio_PortType PortId, uint8 PinId>
+class Pin
+{
+	static_assert(PortId <= DIO_MAX_PORT_ID, "Dio::Pin: not a port of the MCU, expander channels use the C services.");
+	static_assert(PinId < 8u, "Dio::Pin: a port has pins 0..7.");
+	static_assert(0u != (PortChannelMask(PortId) & (1u << PinId)), "Dio::Pin: the channel is not part of the DIO configuration.");
+	
+public:
+	/* Channel ID of the C services */
+	static constexpr Dio_ChannelType ChannelId = (Dio_ChannelType)((PortId << 4u) | PinId);
+	
+	/* Mask of the pin within its port */
+	static constexpr uint8 PinMask = (uint8)(1u << PinId);
+	
+	/* Masked GPIODATA address of the pin, only this pin is seen by a load or a store */
+	static constexpr uint32 DataAddress = DIO_MASKED_DATA_ADDRESS(PortBase(PortId), PinMask);
+	
+	/* TRUE if the pin is configured as an output */
+	static constexpr bool IsOutput = (0u != (PortOutputMask(PortId) & PinMask));
+	
+	Pin() = delete;
+	
+	/* Physical level of the pin, input or output */
+	static Dio_LevelType Read(void)
+	{
+		/* The masked load returns the pin bit only */
+		return ((Dio_LevelType)(GET_PORT(DataAddress) >> PinId));
+	}
+	
+	/* Drives the pin, one store */
+	static void Write(const Dio_LevelType Level)
+	{
+		static_assert(IsOutput, "Dio::Pin::Write: the channel is configured as an input.");
+		
+		SET_PORT(DataAddress, ((STD_LOW != Level) ? PinMask : 0x00u));
+	}
+	
+	/* Drives the pin high, one store */
+	static void Set(void)
+	{
+		static_assert(IsOutput, "Dio::Pin::Set: the channel is configured as an input.");
+		
+		SET_PORT(DataAddress, PinMask);
+	}
+	
+	/* Drives the pin low, one store */
+	static void Clear(void)
+	{
+		static_assert(IsOutput, "Dio::Pin::Clear: the channel is configured as an input.");
+		
+		SET_PORT(DataAddress, 0x00u);
+	}
+	
+	/*
+	   Inverts the pin and returns its new level, one load and one store. The masked
+	   address keeps the other pins of the port out of the read-modify-write, only a
+	   write of the same pin from an interrupt in between can be lost.
+	*/
+	static Dio_LevelType Flip(void)
+	{
+		static_assert(IsOutput, "Dio::Pin::Flip: the channel is configured as an input.");
+		
+		const uint32 Level = (GET_PORT(DataAddress) ^ PinMask);
+		
+		SET_PORT(DataAddress, Level);
+		
+		return ((Dio_LevelType)(Level >> PinId));
+	}
+};
+
+/* Channel by its generated ID, Dio::Channel<LED1> */
+template<Dio_ChannelType ChannelId>
+using Channel = Pin<DIO_CHANNEL_PORT(ChannelId), (uint8)(ChannelId & 0x0Fu)>;
+
+/*****************************************************************/
+/*				      Group and Port Types     		  	         */
+/*****************************************************************/
+
+/* Pins Mask of port PortId read and written as one value, aligned to the lowest pin of the mask */
+template<Dio_PortType PortId, uint8 Mask>
+class Group
+{
+	static_assert(PortId <= DIO_MAX_PORT_ID, "Dio::Group: not a port of the MCU, expander groups use the C services.");
+	static_assert(0u != Mask, "Dio::Group: the group has no pins.");
+	
+public:
+	/* Mask and offset as in Dio_ChannelGroupType */
+	static constexpr uint8 GroupMask = Mask;
+	static constexpr uint8 Offset	 = MaskOffset(Mask);
+	
+	/* Masked GPIODATA address of the group */
+	static constexpr uint32 DataAddress = DIO_MASKED_DATA_ADDRESS(PortBase(PortId), Mask);
+	
+	/* TRUE if every pin of the group is configured as an output */
+	static constexpr bool IsOutput = (Mask == (PortOutputMask(PortId) & Mask));
+	
+	Group() = delete;
+	
+	/* Level of the group, one load */
+	static Dio_PortLevelType Read(void)
+	{
+		return ((Dio_PortLevelType)(GET_PORT(DataAddress) >> Offset));
+	}
+	
+	/* Drives the group, one store, the bits of Level outside the group are ignored */
+	static void Write(const Dio_PortLevelType Level)
+	{
+		static_assert(IsOutput, "Dio::Group::Write: a pin of the group is configured as an input.");
+		
+		SET_PORT(DataAddress, ((uint32)Level << Offset));
+	}
+};
+
+/* A whole port, as Dio_ReadPort / Dio_WritePort */
+template<Dio_PortType PortId>
+class Port
+{
+	static_assert(PortId <= DIO_MAX_PORT_ID, "Dio::Port: not a port of the MCU, expander ports use the C services.");
+	
+public:
+	/* GPIODATA address with every pin unmasked */
+	static constexpr uint32 DataAddress = DIO_MASKED_DATA_ADDRESS(PortBase(PortId), 0xFFu);
+	
+	/* Output pins of the port */
+	static constexpr uint8 OutputMask = PortOutputMask(PortId);
+	
+	Port() = delete;
+	
+	/* Level of the port, one load */
+	static Dio_PortLevelType Read(void)
+	{
+		return ((Dio_PortLevelType)GET_PORT(DataAddress));
+	}
+	
+	/* Drives the output pins of the port, one store, the input pins keep their level */
+	static void Write(const Dio_PortLevelType Level)
+	{
+		static_assert(0u != OutputMask, "Dio::Port::Write: the port has no output pins.");
+		
+		SET_PORT(DataAddress, Level);
+	}
+};
+
+} /* namespace Dio */
+
+#endif /* DIO_HPP */
@@ -0,0 +1,176 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Dio_Expander.c												 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : MCP23017 port expander transport on I2C1						 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : Yes                           						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Dio_Expander.h"
+#include "hw_memmap.h"
+#include "i2c.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* I2C master the expanders are connected to (PA6 SCL, PA7 SDA), set up by the integration code */
+#define DIO_EXPANDER_I2C_BASE		I2C1_BASE
+
+/* 
+   MCP23017 registers of port A (IOCON.BANK = 0), the port B register follows each of them
+   and the address pointer steps through both ports in one sequential transfer
+*/
+#define DIO_EXPANDER_IODIRA			(0x00u)
+#define DIO_EXPANDER_GPIOA			(0x12u)
+#define DIO_EXPANDER_OLATA			(0x14u)
+
+/* Ports of one MCP23017 */
+#define DIO_EXPANDER_NUM_OF_PORTS	(2u)
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to wait for the end of an I2C master command and check it was acknowledged */
+static Std_ReturnType DioExpanderWait(uint32 Command);
+
+/* Function to write consecutive registers of an expander in one transaction */
+static Std_ReturnType DioExpanderWriteRegisters(uint8 DeviceAddress, uint8 Register, const uint8* DataPtr, uint8 Length);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+Std_ReturnType Dio_ExpanderWrite(uint8 DeviceAddress, const uint8* DataPtr, uint8 Length)
+{
+	/* Output latches, written pins which are inputs keep their level */
+	return (DioExpanderWriteRegisters(DeviceAddress, DIO_EXPANDER_OLATA, DataPtr, Length));
+}
+
+Std_ReturnType Dio_ExpanderRead(uint8 DeviceAddress, uint8* DataPtr, uint8 Length)
+{
+	Std_ReturnType RetVal = E_NOT_OK;
+	uint8 Index;
+	
+	if((0u != Length) && (Length <= DIO_EXPANDER_NUM_OF_PORTS))
+	{
+		/* Address pointer to GPIOA, then a repeated start to read the ports */
+		I2CMasterSlaveAddrSet(DIO_EXPANDER_I2C_BASE, DeviceAddress, false);
+		I2CMasterDataPut(DIO_EXPANDER_I2C_BASE, DIO_EXPANDER_GPIOA);
+		
+		RetVal = DioExpanderWait(I2C_MASTER_CMD_BURST_SEND_START);
+		
+		if(E_OK == RetVal)
+		{
+			I2CMasterSlaveAddrSet(DIO_EXPANDER_I2C_BASE, DeviceAddress, true);
+			
+			RetVal = DioExpanderWait((1u == Length) ? I2C_MASTER_CMD_SINGLE_RECEIVE : I2C_MASTER_CMD_BURST_RECEIVE_START);
+		}
+		
+		for(Index = 0u; (Index < Length) && (E_OK == RetVal); Index++)
+		{
+			if(0u != Index)
+			{
+				RetVal = DioExpanderWait(((Index + 1u) == Length) ? I2C_MASTER_CMD_BURST_RECEIVE_FINISH : I2C_MASTER_CMD_BURST_RECEIVE_CONT);
+			}
+			
+			DataPtr[Index] = (uint8)I2CMasterDataGet(DIO_EXPANDER_I2C_BASE);
+		}
+	}
+	
+	return (RetVal);
+}
+
+Std_ReturnType Dio_ExpanderSetDirection(uint8 DeviceAddress, const uint8* OutputMaskPtr, uint8 Length)
+{
+	/* IODIR bits are set for the inputs */
+	uint8 Direction[DIO_EXPANDER_NUM_OF_PORTS];
+	Std_ReturnType RetVal = E_NOT_OK;
+	uint8 Index;
+	
+	if(Length <= DIO_EXPANDER_NUM_OF_PORTS)
+	{
+		for(Index = 0u; Index < Length; Index++)
+		{
+			Direction[Index] = (uint8)(~OutputMaskPtr[Index]);
+		}
+		
+		RetVal = DioExpanderWriteRegisters(DeviceAddress, DIO_EXPANDER_IODIRA, Direction, Length);
+	}
+	
+	return (RetVal);
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static Std_ReturnType DioExpanderWait(uint32 Command)
+{
+	Std_ReturnType RetVal = E_OK;
+	
+	I2CMasterControl(DIO_EXPANDER_I2C_BASE, Command);
+	
+	while(I2CMasterBusy(DIO_EXPANDER_I2C_BASE))
+	{
+		
+	}
+	
+	if(I2C_MASTER_ERR_NONE != I2CMasterErr(DIO_EXPANDER_I2C_BASE))
+	{
+		/* Release the bus, the transaction is lost */
+		I2CMasterControl(DIO_EXPANDER_I2C_BASE, I2C_MASTER_CMD_BURST_SEND_ERROR_STOP);
+		
+		RetVal = E_NOT_OK;
+	}
+	
+	return (RetVal);
+}
+
+static Std_ReturnType DioExpanderWriteRegisters(uint8 DeviceAddress, uint8 Register, const uint8* DataPtr, uint8 Length)
+{
+	Std_ReturnType RetVal = E_NOT_OK;
+	uint8 Index;
+	
+	if((0u != Length) && (Length <= DIO_EXPANDER_NUM_OF_PORTS))
+	{
+		I2CMasterSlaveAddrSet(DIO_EXPANDER_I2C_BASE, DeviceAddress, false);
+		I2CMasterDataPut(DIO_EXPANDER_I2C_BASE, Register);
+		
+		RetVal = DioExpanderWait(I2C_MASTER_CMD_BURST_SEND_START);
+		
+		for(Index = 0u; (Index < Length) && (E_OK == RetVal); Index++)
+		{
+			I2CMasterDataPut(DIO_EXPANDER_I2C_BASE, DataPtr[Index]);
+			
+			RetVal = DioExpanderWait(((Index + 1u) == Length) ? I2C_MASTER_CMD_BURST_SEND_FINISH : I2C_MASTER_CMD_BURST_SEND_CONT);
+		}
+	}
+	
+	return (RetVal);
+}
@@ -0,0 +1,58 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Dio_Expander.h												 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Port expander transport of the DIO Driver						 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : Yes                           						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef DIO_EXPANDER_H
+#define DIO_EXPANDER_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/*
+   Bus transactions of the port expanders used by the DIO driver, Length consecutive 
+   ports starting at the first port of the expander are transferred in one transaction.
+   They are only called from the task context of Dio_MainFunction(), never from inside
+   the DIO exclusive area.
+*/
+
+/* Writes the output latches of the expander ports */
+extern Std_ReturnType Dio_ExpanderWrite(uint8 DeviceAddress, const uint8* DataPtr, uint8 Length);
+
+/* Reads the pin levels of the expander ports */
+extern Std_ReturnType Dio_ExpanderRead(uint8 DeviceAddress, uint8* DataPtr, uint8 Length);
+
+/* 
+   Sets the output pins of the expander ports, the other pins are inputs. 
+   Called once by the integration code before the first DIO access to the expander
+*/
+extern Std_ReturnType Dio_ExpanderSetDirection(uint8 DeviceAddress, const uint8* OutputMaskPtr, uint8 Length);
+
+#endif /* DIO_EXPANDER_H */
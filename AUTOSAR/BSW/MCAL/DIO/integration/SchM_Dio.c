@@ -0,0 +1,71 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	SchM_Dio.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Schedule Manager exclusive areas of the DIO Driver			 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_RTE, AUTOSAR Release 4.3.1					 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : Yes                           						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "SchM_Dio.h"
+#include "interrupt.h"
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Nesting depth of DIO_EXCLUSIVE_AREA_0 */
+static uint8 SchMDioNesting = 0u;
+
+/* TRUE if the interrupts were already masked when the outermost area was entered */
+static boolean SchMDioWasMasked = FALSE;
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+void SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0(void)
+{
+	/* IntMasterDisable returns true if the interrupts were already masked */
+	boolean WasMasked = (true == IntMasterDisable()) ? TRUE : FALSE;
+	
+	/* The interrupts are masked from here, the state can be updated safely */
+	if(0u == SchMDioNesting)
+	{
+		SchMDioWasMasked = WasMasked;
+	}
+	
+	SchMDioNesting++;
+}
+
+void SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0(void)
+{
+	SchMDioNesting--;
+	
+	/* Unmask the interrupts only when leaving the outermost area of an unmasked caller */
+	if((0u == SchMDioNesting) && (FALSE == SchMDioWasMasked))
+	{
+		(void)IntMasterEnable();
+	}
+}
@@ -0,0 +1,46 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	SchM_Dio.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Schedule Manager exclusive areas of the DIO Driver			 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_RTE, AUTOSAR Release 4.3.1					 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : Yes                           						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef SCHM_DIO_H
+#define SCHM_DIO_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/*
+   DIO_EXCLUSIVE_AREA_0 protects the short read / write sequences of the
+   driver against interrupts, it may be nested.
+*/
+extern void SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0(void);
+extern void SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0(void);
+
+#endif /* SCHM_DIO_H */
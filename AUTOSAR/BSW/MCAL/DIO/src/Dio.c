@@ -35,6 +35,20 @@
 #include "hw_gpio.h"
 #include "hw_memmap.h"
 
+#if (DioAhbAperture == STD_ON)
+#include "hw_sysctl.h"
+#endif /* DioAhbAperture */
+
+#if ((DioPatternApi == STD_ON) || (DioEdgeCaptureApi == STD_ON))
+#include "hw_ints.h"
+#include "interrupt.h"
+#endif /* DioPatternApi, DioEdgeCaptureApi */
+
+#if (DioPatternApi == STD_ON)
+#include "timer.h"
+#include "udma.h"
+#endif /* DioPatternApi */
+
 #if (DioDevErrorDetect == STD_ON)
 #include "Det.h"
 #endif /* DioDevErrorDetect */
@@ -83,25 +97,50 @@
 /* 0th bit definition */
 #define DIO_NUM_0 	(0u)
 
-/* Dio directions definitions */
-#define DIO_PIN_INPUT	(0u)
-#define DIO_PIN_OUTPUT	(1u)
-
 /* Dio Maximum pins in one port */
 #define DIO_PORT_WIDTH  (0x08u)
 
 /* Dio Data regeister definition */
 #define DIO_DATA_REG	(GPIO_O_DATA + 0x3FC)
 
-/* Dio port addresses for Tiva C */
+/* Value written through a masked data address to drive the selected pins high / low */
+#define DIO_MASKED_HIGH	(0xFFu)
+#define DIO_MASKED_LOW	(0x00u)
+
+#if (DioExpanderApi == STD_ON)
+
+/* Number of port IDs, the MCU ports followed by the expander ports */
+#define DIO_NUM_OF_PORT_IDS				(DIO_EXPANDER_FIRST_PORT_ID + DIO_CFG_NUM_OF_EXPANDER_PORTS)
+
+/* TRUE if the port ID is an expander port */
+#define DIO_IS_EXPANDER_PORT(PortId)	((PortId) >= DIO_EXPANDER_FIRST_PORT_ID)
+
+/* Channel IDs are 8 bit, (Port << 4) | Pin leaves room for ten expander ports */
+#if (DIO_NUM_OF_PORT_IDS > 16u)
+#error "DIO_CFG_NUM_OF_EXPANDER_PORTS exceeds the channel ID range."
+#endif /* DIO_NUM_OF_PORT_IDS */
+
+/* The read requests of the expanders are kept in a 32-bit mask */
+#if (DIO_CFG_NUM_OF_EXPANDERS > 32u)
+#error "DIO_CFG_NUM_OF_EXPANDERS shall not exceed 32."
+#endif /* DIO_CFG_NUM_OF_EXPANDERS */
+
+#else
+
+/* Number of port IDs */
+#define DIO_NUM_OF_PORT_IDS				(DIO_MAX_PORT_ID + 1u)
+
+#endif /* DioExpanderApi */
+
+/* Dio port addresses for Tiva C (APB or AHB aperture, see DioAhbAperture) */
 static const uint32 DioPortAddress[] = 
 {
-	GPIO_PORTA_BASE,
-	GPIO_PORTB_BASE,
-	GPIO_PORTC_BASE,
-	GPIO_PORTD_BASE,
-	GPIO_PORTE_BASE,
-	GPIO_PORTF_BASE
+	DIO_PORTA_BASE,
+	DIO_PORTB_BASE,
+	DIO_PORTC_BASE,
+	DIO_PORTD_BASE,
+	DIO_PORTE_BASE,
+	DIO_PORTF_BASE
 	
 };
 
@@ -111,6 +150,79 @@ extern Dio_ConfigType Dio_Config;
 /* Save the main container in a private one */	
 static const Dio_ConfigType* DioConfig = &Dio_Config ;
 
+#if (DioPatternApi == STD_ON)
+
+/* Pattern being streamed, NULL_PTR if the engine is idle */
+static const Dio_PatternType* volatile DioActivePattern = NULL_PTR;
+
+/* Masked data address of the output pins of the running pattern's group */
+static uint32 DioPatternDataAddress;
+
+/* INLINE Function to load the samples of a pattern into the uDMA channel and enable it */
+LOCAL_INLINE void DioPatternArm(const Dio_PatternType* PatternPtr);
+
+#endif /* DioPatternApi */
+
+#if (DioInputSnapshotApi == STD_ON)
+
+/* Debounced levels of the input channels of each port, written by Dio_MainFunction only */
+static volatile Dio_PortLevelType DioSnapshotLevel[DIO_MAX_PORT_ID + 1u];
+
+/* Input channels of each port whose debounced level changed in the last cycle */
+static volatile Dio_PortLevelType DioSnapshotChanged[DIO_MAX_PORT_ID + 1u];
+
+/* Consecutive samples of each input channel which differ from its debounced level */
+static uint8 DioDebounceCounter[DIO_CFG_NUM_OF_INPUT_CHANNELS];
+
+/* FALSE until the first Dio_MainFunction cycle has filled the snapshot */
+static boolean DioSnapshotValid = FALSE;
+
+#endif /* DioInputSnapshotApi */
+
+#if (DioExpanderApi == STD_ON)
+
+/* 
+   Output latches of the expander ports as set by the Dio services, and as last written 
+   to the expanders. Both start at 0, the power-on value of the expander output latches
+*/
+static Dio_PortLevelType DioExpanderOutput[DIO_CFG_NUM_OF_EXPANDER_PORTS];
+static Dio_PortLevelType DioExpanderLatch [DIO_CFG_NUM_OF_EXPANDER_PORTS];
+
+/* 
+   Pin levels of the expander ports as last read by Dio_MainFunction,
+   0 until the first read. Only Dio_MainFunction writes them
+*/
+static volatile Dio_PortLevelType DioExpanderInput[DIO_CFG_NUM_OF_EXPANDER_PORTS];
+
+/* Bit n set if a read service needed input pins of expander n since the last Dio_MainFunction */
+static volatile uint32 DioExpanderReadRequest = 0u;
+
+#endif /* DioExpanderApi */
+
+#if (DioEdgeCaptureApi == STD_ON)
+
+#if ((DIO_CFG_EDGE_RING_SIZE & (DIO_CFG_EDGE_RING_SIZE - 1u)) != 0u) || (DIO_CFG_EDGE_RING_SIZE > 0x8000u)
+#error "DIO_CFG_EDGE_RING_SIZE shall be a power of two not above 0x8000."
+#endif /* DIO_CFG_EDGE_RING_SIZE */
+
+/* Edge events, single producer (Dio_EdgeIsr) and single consumer (Dio_ReadEdgeEvents) */
+static Dio_EdgeEventType DioEdgeRing[DIO_CFG_EDGE_RING_SIZE];
+
+/* Free running indexes of the ring, the head is written by the ISR and the tail by the consumer only */
+static volatile uint16 DioEdgeHead = 0u;
+static volatile uint16 DioEdgeTail = 0u;
+
+/* Events lost because the ring was full */
+static volatile uint32 DioEdgeOverflow = 0u;
+
+/* INLINE Function to set or clear the bit of a pin in a GPIO interrupt register */
+LOCAL_INLINE void DioEdgeSelect(uint32 RegAddress, uint8 PinMask, boolean Set);
+
+/* INLINE Function to push one edge event into the ring */
+LOCAL_INLINE void DioEdgePush(Dio_ChannelType ChannelId, Dio_LevelType Level, uint32 Timestamp);
+
+#endif /* DioEdgeCaptureApi */
+
 #if (DioDevErrorDetect == STD_ON)
 
 /* INLINE Function to Check ChannelId if it is valid or Not */
@@ -122,25 +234,55 @@ LOCAL_INLINE uint8 DioCheckGroupID(const Dio_ChannelGroupType* GroupIdPtr);
 /* INLINE Function to Check PortId if it is valid or Not */
 LOCAL_INLINE uint8 DioCheckPortID(Dio_PortType PortId);
 
+#if (DioVirtualGroupApi == STD_ON)
+/* INLINE Function to Check a virtual group pointer if it is valid or Not */
+LOCAL_INLINE uint8 DioCheckVirtualGroupID(const Dio_VirtualGroupType* GroupPtr);
+#endif /* DioVirtualGroupApi */
+
+#if (DioExpanderApi == STD_ON)
+/* INLINE Function to Check a ChannelId of an expander port if it is valid or Not */
+LOCAL_INLINE uint8 DioCheckExpanderChannelID(Dio_ChannelType ChannelId);
+
+/* INLINE Function to Check an expander PortId if it is valid or Not */
+LOCAL_INLINE uint8 DioCheckExpanderPortID(Dio_PortType PortId);
+#endif /* DioExpanderApi */
+
 #endif /* DioDevErrorDetect */
 
 /* INLINE Function to Get the port address from the port symbolic ID */
 LOCAL_INLINE uint32 DioGetPortAddress(Dio_PortType PortNumber);
 
-/* INLINE Function to Get the PortNumber from the Channel symbolic ID */
-LOCAL_INLINE Dio_PortType DioGetChannelPortNumber(Dio_ChannelType ChannelId);
-
-/* INLINE Function to Get the Pin position from the Channel symbolic ID */
-LOCAL_INLINE uint8 DioGetChannelPinNumber(Dio_ChannelType ChannelId);
+/* INLINE Function to Get the decode data of a channel from the Channel symbolic ID */
+LOCAL_INLINE const Dio_ChannelDecodeType* DioGetChannelDecode(Dio_ChannelType ChannelId);
 
 /* INLINE Function to Set a value of the Pin of the specifies level */
-LOCAL_INLINE void DioWritePin(uint32 PortAddress, uint8 PinNumber, Dio_LevelType Level);
+LOCAL_INLINE void DioWritePin(uint32 DataAddress, Dio_LevelType Level);
 
 /* INLINE Function to Get a value of the Pin Level */
-LOCAL_INLINE Dio_LevelType DioReadPin(uint32 PortAddress, uint8 PinNumber);
+LOCAL_INLINE Dio_LevelType DioReadPin(uint32 DataAddress);
 
 /* INLINE Function to Get the value of a Pin Direction */
-LOCAL_INLINE uint8 DioGetPinDirection(uint32 PortAddress, uint8 PinNumber);
+LOCAL_INLINE uint8 DioGetPinDirection(Dio_PortType PortId, uint8 PinMask);
+
+/* INLINE Function to Get the output pins of a port */
+LOCAL_INLINE uint8 DioGetOutputMask(Dio_PortType PortId);
+
+#if (DioExpanderApi == STD_ON)
+/* INLINE Function to Get the level of an expander port from the RAM shadows and request its read */
+LOCAL_INLINE Dio_PortLevelType DioExpanderReadPort(Dio_PortType PortId, uint8 PinMask);
+
+/* INLINE Function to Set output pins of an expander port in the RAM shadow */
+LOCAL_INLINE void DioExpanderWritePort(Dio_PortType PortId, uint8 PinMask, Dio_PortLevelType Level);
+
+/* INLINE Function to Invert a channel of an expander port in the RAM shadow */
+LOCAL_INLINE Dio_LevelType DioExpanderFlipChannel(Dio_PortType PortId, uint8 PinMask);
+
+/* INLINE Function to Write the changed expanders */
+LOCAL_INLINE void DioExpanderFlush(void);
+
+/* INLINE Function to Read the inputs of the requested expanders into the RAM shadow */
+LOCAL_INLINE void DioExpanderReadInputs(void);
+#endif /* DioExpanderApi */
 
 
 /***********************************************************************************/
@@ -176,12 +318,8 @@ LOCAL_INLINE uint8 DioGetPinDirection(uint32 PortAddress, uint8 PinNumber);
 ***********************************************************************************/
 Dio_LevelType Dio_ReadChannel( const Dio_ChannelType ChannelId )
 {
-	/* Variable to save the channel's port number  */
-	Dio_PortType  ChannelPortNumber ;
-	/* Varialbe to save the channel's Pin Position */
-	uint8  	      ChannelPinNumber  ;
-	/* Variable to hold the channel's port address */
-	uint32 		  ChannelPortAddress;
+	/* Pointer to the channel's decode data */
+	const Dio_ChannelDecodeType* Channel;
 	/* varilabe to hold the return value(physical level of the channel) */
 	Dio_LevelType ChannelLevel	    ;
 	
@@ -191,6 +329,13 @@ Dio_LevelType Dio_ReadChannel( const Dio_ChannelType ChannelId )
 	    development error detection is enabled
 	*/
 	uint8 Check      = DioCheckChannelID(ChannelId);
+#if (DioExpanderApi == STD_ON)
+	/* A channel which is not an MCU channel may be an expander channel */
+	if(DIO_ERROR == Check)
+	{
+		Check = DioCheckExpanderChannelID(ChannelId);
+	}
+#endif /* DioExpanderApi */
 	/* Variable to Save the API's Error State */
 	uint8 ErrorState = E_OK;
 	
@@ -220,20 +365,36 @@ Dio_LevelType Dio_ReadChannel( const Dio_ChannelType ChannelId )
 	if(E_OK == ErrorState)
 #endif
 	{
-		/* Get the channel port number from its ID */
-		ChannelPortNumber  = DioGetChannelPortNumber(ChannelId);
-		
-		/* Get the channel's Pin Position */
-		ChannelPinNumber   = DioGetChannelPinNumber(ChannelId);
-		
-		/* Get the channel's port address */
-		ChannelPortAddress = DioGetPortAddress(ChannelPortNumber);
-		
-		/* Read the channel level to decide the return value */
-		/* if it is not low */
-		if(DioReadPin(ChannelPortAddress, ChannelPinNumber) != STD_LOW)
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(DIO_CHANNEL_PORT(ChannelId)))
 		{
-			ChannelLevel = STD_HIGH;
+			/* Output pins come from the RAM shadow, input pins as last read by Dio_MainFunction */
+			if(0u != (DioExpanderReadPort(DIO_CHANNEL_PORT(ChannelId), DIO_CHANNEL_PIN_MASK(ChannelId)) & 
+					  DIO_CHANNEL_PIN_MASK(ChannelId)))
+			{
+				ChannelLevel = STD_HIGH;
+			}
+			else
+			{
+				ChannelLevel = STD_LOW;
+			}
+		}
+		else
+#endif /* DioExpanderApi */
+		{
+			/* Get the channel's port address and pin mask from its ID */
+			Channel = DioGetChannelDecode(ChannelId);
+		
+			/* Read the channel level to decide the return value */
+			/* if it is not low */
+			if(DioReadPin(Channel->DataAddress) != STD_LOW)
+			{
+				ChannelLevel = STD_HIGH;
+			}
+			else
+			{
+				ChannelLevel = STD_LOW;
+			}
 		}
 	}
 	
@@ -273,12 +434,8 @@ Dio_LevelType Dio_ReadChannel( const Dio_ChannelType ChannelId )
 ***********************************************************************************/
 void Dio_WriteChannel( const Dio_ChannelType ChannelId, const Dio_LevelType Level )
 {
- 	/* Variable to save the channel's port number   */	
-	Dio_PortType  ChannelPortNumber ;
-	/* Varialbe to save the channel's Pin Position  */
-	uint8  	      ChannelPinNumber  ;
-	/* Variable to hold the channel's port address  */
-	uint32 		  ChannelPortAddress;
+	/* Pointer to the channel's decode data */
+	const Dio_ChannelDecodeType* Channel;
 	/* Variable to hold the channel's Pin Direction */
 	uint8		  ChannelDirection = DIO_PIN_OUTPUT;
 	
@@ -288,6 +445,13 @@ void Dio_WriteChannel( const Dio_ChannelType ChannelId, const Dio_LevelType Leve
 	    development error detection is enabled
 	*/
 	uint8 Check      = DioCheckChannelID(ChannelId);
+#if (DioExpanderApi == STD_ON)
+	/* A channel which is not an MCU channel may be an expander channel */
+	if(DIO_ERROR == Check)
+	{
+		Check = DioCheckExpanderChannelID(ChannelId);
+	}
+#endif /* DioExpanderApi */
 	/* Variable to Save the API's Error State */
 	uint8 ErrorState = E_OK;
 	
@@ -314,35 +478,40 @@ void Dio_WriteChannel( const Dio_ChannelType ChannelId, const Dio_LevelType Leve
 	if(E_OK == ErrorState)
 #endif /* DioDevErrorDetect */
 	{
-		/* Get the channel port number from its ID */
-		ChannelPortNumber  = DioGetChannelPortNumber(ChannelId);
-		
-		/* Get the channel's Pin Position */
-		ChannelPinNumber   = DioGetChannelPinNumber(ChannelId);
-		
-		/* Get the channel's port address */
-		ChannelPortAddress = DioGetPortAddress(ChannelPortNumber);
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(DIO_CHANNEL_PORT(ChannelId)))
+		{
+			/* [SWS_Dio_00070] only the output pins of the expander port are written */
+			DioExpanderWritePort(DIO_CHANNEL_PORT(ChannelId), DIO_CHANNEL_PIN_MASK(ChannelId),
+								 ((STD_HIGH == Level) ? DIO_MASKED_HIGH : DIO_MASKED_LOW));
+		}
+		else
+#endif /* DioExpanderApi */
+		{
+			/* Get the channel's port address and pin mask from its ID */
+			Channel = DioGetChannelDecode(ChannelId);
 		
-		/* Get the channel's PIN Direction */
-		ChannelDirection   = DioGetPinDirection(ChannelPortAddress, ChannelPinNumber);
+			/* Get the channel's PIN Direction */
+			ChannelDirection   = DioGetPinDirection(Channel->PortId, Channel->PinMask);
 		
-		/*
-			[SWS_Dio_00070] if a Dio write function is used on an input channel,
-			it shall have no effect on the physical output level
-		*/
-		if(DIO_PIN_INPUT != ChannelDirection)
-		{
-			/* Decide the value to be written */
-			/*if it is high*/
-			if(STD_HIGH == Level)
-			{
-				/* Set the corresponding channel to STD_HIGH */
-				DioWritePin(ChannelPortAddress, ChannelPinNumber, STD_HIGH);
-			}
-			else
+			/*
+				[SWS_Dio_00070] if a Dio write function is used on an input channel,
+				it shall have no effect on the physical output level
+			*/
+			if(DIO_PIN_INPUT != ChannelDirection)
 			{
-				/* if low, Set the corresponding channel to STD_LOW */
-				DioWritePin(ChannelPortAddress, ChannelPinNumber, STD_LOW);
+				/* Decide the value to be written */
+				/*if it is high*/
+				if(STD_HIGH == Level)
+				{
+					/* Set the corresponding channel to STD_HIGH */
+					DioWritePin(Channel->DataAddress, STD_HIGH);
+				}
+				else
+				{
+					/* if low, Set the corresponding channel to STD_LOW */
+					DioWritePin(Channel->DataAddress, STD_LOW);
+				}
 			}
 		}
 	}
@@ -390,6 +559,14 @@ Dio_PortLevelType Dio_ReadPort( const Dio_PortType PortId )
 	*/
 	uint8 Check      = DioCheckPortID(PortId);
 	
+#if (DioExpanderApi == STD_ON)
+	/* A port which is not an MCU port may be an expander port */
+	if(DIO_ERROR == Check)
+	{
+		Check = DioCheckExpanderPortID(PortId);
+	}
+#endif /* DioExpanderApi */
+	
 	/* Variable to Save the API's Error State */
 	uint8 ErrorState = E_OK;
 	
@@ -419,11 +596,20 @@ Dio_PortLevelType Dio_ReadPort( const Dio_PortType PortId )
 	if(E_OK == ErrorState)
 #endif	/* DioDevErrorDetect */
 	{
-		/* Get the Corresponding port address */
-		PortAddress = DioGetPortAddress(PortId);
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(PortId))
+		{
+			PortLevel = DioExpanderReadPort(PortId, DIO_MASKED_HIGH);
+		}
+		else
+#endif /* DioExpanderApi */
+		{
+			/* Get the Corresponding port address */
+			PortAddress = DioGetPortAddress(PortId);
 		
-		/* Get the Corresponding port level*/
-		PortLevel = (GET_PORT((uint32)(PortAddress + DIO_DATA_REG)));
+			/* Get the Corresponding port level*/
+			PortLevel = (GET_PORT((uint32)(PortAddress + DIO_DATA_REG)));
+		}
 	}
 	
 	/* Return the port level */
@@ -464,14 +650,8 @@ void Dio_WritePort( const Dio_PortType PortId, const Dio_PortLevelType Level )
 {
 	/* Variable to save the port address  */
 	uint32 	 PortAddress;
-	/* Varialbe to save the Pin Position  */
-	uint8  	 PinNumber;
 	/* Variable to hold Port Direction */
 	uint8	 ChannelsDirection;
-	/* Variable to hold the old data reg value */
-	uint8 	 OldDataReg;
-	/* Variable to hold the new Port data reg value */
-	Dio_PortLevelType PortNewVal;
 	
 #if (DioDevErrorDetect == STD_ON)
 	
@@ -481,6 +661,14 @@ void Dio_WritePort( const Dio_PortType PortId, const Dio_PortLevelType Level )
 	*/
 	uint8 Check      = DioCheckPortID(PortId);
 	
+#if (DioExpanderApi == STD_ON)
+	/* A port which is not an MCU port may be an expander port */
+	if(DIO_ERROR == Check)
+	{
+		Check = DioCheckExpanderPortID(PortId);
+	}
+#endif /* DioExpanderApi */
+	
 	/* Variable to Save the API's Error State */
 	uint8 ErrorState = E_OK;
 	
@@ -508,27 +696,32 @@ void Dio_WritePort( const Dio_PortType PortId, const Dio_PortLevelType Level )
 	if(E_OK == ErrorState)
 #endif	
 	{
-		/* Get the Corresponding port address */
-		PortAddress = DioGetPortAddress(PortId);
-		
-		/* Get the all Port's Pin direction */
-		ChannelsDirection = (GET_PORT((uint32)(PortAddress + GPIO_O_DIR)));
-		
-		/* Get the old Dio Port Data register value */
-		OldDataReg 		  = (GET_PORT((uint32)(PortAddress + DIO_DATA_REG)));
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(PortId))
+		{
+			/* [SWS_Dio_00004] [SWS_Dio_00007] all output pins, committed by the next Dio_MainFunction */
+			DioExpanderWritePort(PortId, DIO_MASKED_HIGH, Level);
+		}
+		else
+#endif /* DioExpanderApi */
+		{
+			/* Get the Corresponding port address */
+			PortAddress = DioGetPortAddress(PortId);
 		
-		/*
-			[SWS_Dio_00004]The API shall ensure that the functionality of 
-			the input channels of that port is not affected.
-		*/
-		/* Masking to the pin direction if it is input noting will be changed */
-		PortNewVal = ((~ChannelsDirection) & OldDataReg) | (Level & ChannelsDirection);
+			/* Get the all Port's Pin direction */
+			ChannelsDirection = DioGetOutputMask(PortId);
 		
-		/*
-			[SWS_Dio_00007] The API function shall simultaneously set the levels 
-			 of all output channels (at one shot ).
-		*/
-		SET_PORT((uint32)(PortAddress + DIO_DATA_REG) , PortNewVal);
+			/*
+				[SWS_Dio_00004]The API shall ensure that the functionality of 
+				the input channels of that port is not affected.
+			*/
+			/*
+				[SWS_Dio_00007] The API function shall simultaneously set the levels 
+				 of all output channels (at one shot ).
+			*/
+			/* Store through the output pins' masked address, input pins are not addressed */
+			SET_PORT(DIO_MASKED_DATA_ADDRESS(PortAddress, ChannelsDirection) , Level);
+		}
 
 	}		
 } 
@@ -561,8 +754,6 @@ void Dio_WritePort( const Dio_PortType PortId, const Dio_PortLevelType Level )
 ***********************************************************************************/
 Dio_PortLevelType Dio_ReadChannelGroup( const Dio_ChannelGroupType* const ChannelGroupIdPtr )
 {
-	/* Variable to hole the port address  */
-	uint32 		  	  ChannelPortAddress;
 	/* Variable to save the port level    */
 	Dio_PortLevelType RetVal;
 	
@@ -603,14 +794,21 @@ Dio_PortLevelType Dio_ReadChannelGroup( const Dio_ChannelGroupType* const Channe
 	if(E_OK == ErrorState)
 #endif /* DioDevErrorDetect */
 	{
-		/* Get the Corresponding channel group port address */
-		ChannelPortAddress = DioGetPortAddress(ChannelGroupIdPtr->port);	
-	
 		/*
 		  [SWS_Dio_00092] The API shall do the masking of the channel group.
 		*/	
-		RetVal = (Dio_PortLevelType)((GET_PORT((uint32)(ChannelPortAddress + DIO_DATA_REG))) & \
-									 ChannelGroupIdPtr->mask);		  
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(ChannelGroupIdPtr->port))
+		{
+			RetVal = (Dio_PortLevelType)(DioExpanderReadPort(ChannelGroupIdPtr->port, (uint8)ChannelGroupIdPtr->mask) & 
+										 ChannelGroupIdPtr->mask);
+		}
+		else
+#endif /* DioExpanderApi */
+		{
+			/* The masked data address only returns the group's pins */
+			RetVal = (Dio_PortLevelType)(GET_PORT(ChannelGroupIdPtr->DataAddress));
+		}
 		
 		/*[SWS_Dio_00093] The API function shall do the shifting 
 		   so that the values read by the function are aligned to the LSB
@@ -657,12 +855,10 @@ void Dio_WriteChannelGroup( const Dio_ChannelGroupType* const ChannelGroupIdPtr,
 {
 	/* Variable to save the port address  */
 	uint32 	  		ChannelPortAddress  ;
-	/* Variable to save the Next port level value */
-	uint32    		NewPortValue		;
-	/* Variable to hold Channel group's pins Direction */
-	uint8	  		ChannelsDirection    ;
-	/* Variable to hold the old data reg value */
-	uint8 	 OldDataRegVal;
+	/* Variable to save the masked data address to be written */
+	uint32    		DataAddress			;
+	/* Variable to hold Channel group's output pins */
+	uint8	  		OutputMask		    ;
 	
 #if (DioDevErrorDetect == STD_ON)
 
@@ -698,38 +894,51 @@ void Dio_WriteChannelGroup( const Dio_ChannelGroupType* const ChannelGroupIdPtr,
 	if(E_OK == ErrorState)
 #endif /* DioDevErrorDetect */ 
 	{
-		/* Get the Corresponding channel group port address */
-		ChannelPortAddress = DioGetPortAddress(ChannelGroupIdPtr->port);
-		
-		/* Get the old Dio Port Data register value */
-		OldDataRegVal 		   = (GET_PORT((uint32)(ChannelPortAddress + DIO_DATA_REG)));
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(ChannelGroupIdPtr->port))
+		{
+			/* [SWS_Dio_00040] [SWS_Dio_00091] only the group's output pins, aligned to the LSB */
+			DioExpanderWritePort(ChannelGroupIdPtr->port, (uint8)ChannelGroupIdPtr->mask,
+								 (Dio_PortLevelType)((uint32)Level << ChannelGroupIdPtr->offset));
+		}
+		else
+#endif /* DioExpanderApi */
+		{
+			/* Get the Corresponding channel group port address */
+			ChannelPortAddress = DioGetPortAddress(ChannelGroupIdPtr->port);
 		
-		/* Get the all Port's Pin direction */
-		ChannelsDirection = (GET_PORT((uint32)(ChannelPortAddress + GPIO_O_DIR)));
+			/* Get the group's pins which are configured as output */
+			OutputMask = (uint8)(DioGetOutputMask(ChannelGroupIdPtr->port) & ChannelGroupIdPtr->mask);
 		
-		/*	
-		  [SWS_Dio_00040] The API shall not change the remaining channels of the port
-		  and channels which are configured as input
-		*/
-		/*
-		  [SWS_Dio_00090] The API function shall 
-		  do the masking of the channel group.
-	    */
-		/*
-		  [SWS_Dio_00091] The API shall do the shifting so that 
-		  the values written by the function are aligned to the LSB
-		*/
-		NewPortValue = (((~ChannelsDirection) & OldDataRegVal) 		   | \
-					   ((~(ChannelGroupIdPtr->mask)) & OldDataRegVal)  | \
-					   (ChannelsDirection & (ChannelGroupIdPtr->mask) &  \
-					   (Level << ChannelGroupIdPtr->offset))); 
+			/*	
+			  [SWS_Dio_00040] The API shall not change the remaining channels of the port
+			  and channels which are configured as input
+			*/
+			/*
+			  [SWS_Dio_00090] The API function shall 
+			  do the masking of the channel group.
+		    */
+			if(OutputMask == ChannelGroupIdPtr->mask)
+			{
+				/* All group pins are outputs, use the precomputed masked address */
+				DataAddress = ChannelGroupIdPtr->DataAddress;
+			}
+			else
+			{
+				/* Exclude the input pins from the masked address */
+				DataAddress = DIO_MASKED_DATA_ADDRESS(ChannelPortAddress, OutputMask);
+			}
 		
-		/*
-		   [SWS_Dio_00008]The API shall simultaneously set an adjoining 
-		   subset of DIO channels (channel group).
-		*/   
-		SET_PORT((uint32)(ChannelPortAddress + DIO_DATA_REG) , NewPortValue);		
-	
+			/*
+			  [SWS_Dio_00091] The API shall do the shifting so that 
+			  the values written by the function are aligned to the LSB
+			*/
+			/*
+			   [SWS_Dio_00008]The API shall simultaneously set an adjoining 
+			   subset of DIO channels (channel group).
+			*/   
+			SET_PORT(DataAddress , ((uint32)Level << ChannelGroupIdPtr->offset));
+		}
 	}
 }
 
@@ -838,16 +1047,13 @@ void Dio_GetVersionInfo(Std_VersionInfoType* const VersionInfo )
 ***********************************************************************************/
 Dio_LevelType Dio_FlipChannel( Dio_ChannelType ChannelId )
 {
-	/* Variable to save the channel's port number  */
-	Dio_PortType  ChannelPortNumber ;
-	/* Varialbe to save the channel's Pin Position */
-	uint8  	      ChannelPinNumber  ;
-	/* Variable to save the port address  */
-	uint32 		  ChannelPortAddress;
-	/* Varialbe to save the current Pin Level */
-	Dio_LevelType ChannelLevel		;
-	/* Varialbe to save the Next Pin Level value */
-	Dio_LevelType RetVal			;
+	/* Pointer to the channel's decode data */
+	const Dio_ChannelDecodeType* Channel;
+	/* 
+	   Varialbe to save the Next Pin Level value, [SWS_Dio_00118] read 
+	   functions shall return '0' if a development error ocurred.
+	*/
+	Dio_LevelType RetVal			= STD_LOW;
 	/* Variable to hold the channel's Pin Direction */
 	uint8		  ChannelDirection = DIO_PIN_OUTPUT;
 	
@@ -858,6 +1064,13 @@ Dio_LevelType Dio_FlipChannel( Dio_ChannelType ChannelId )
 	    development error detection is enabled
 	*/
 	uint8 Check      = DioCheckChannelID(ChannelId);
+#if (DioExpanderApi == STD_ON)
+	/* A channel which is not an MCU channel may be an expander channel */
+	if(DIO_ERROR == Check)
+	{
+		Check = DioCheckExpanderChannelID(ChannelId);
+	}
+#endif /* DioExpanderApi */
 	/* Variable to Save the API's Error State */
 	uint8 ErrorState = E_OK;
 	
@@ -879,37 +1092,47 @@ Dio_LevelType Dio_FlipChannel( Dio_ChannelType ChannelId )
 	if(E_OK == ErrorState)
 #endif /* DioDevErrorDetect */
 	{
-		/* Get the channel port number from its ID */
-		ChannelPortNumber  = DioGetChannelPortNumber(ChannelId);
-	
-		/* Get the channel's Pin Position */
-		ChannelPinNumber   = DioGetChannelPinNumber(ChannelId);
-		
-		/* Get the channel's port address */
-		ChannelPortAddress = DioGetPortAddress(ChannelPortNumber);
-	
-		/* Get the channel's PIN Direction */
-		ChannelDirection   = DioGetPinDirection(ChannelPortAddress, ChannelPinNumber);
-		
-		/* Get the current channel level */
-	    ChannelLevel	   = DioReadPin(ChannelPortAddress, ChannelPinNumber);	
-		
-		/*
-		  [SWS_Dio_00192] If the specified channel is configured as an input channel, the API 
-		  shall have no influence on the physical output.
-		*/
-		if(DIO_PIN_INPUT != ChannelDirection)
+#if (DioExpanderApi == STD_ON)
+		if(DIO_IS_EXPANDER_PORT(DIO_CHANNEL_PORT(ChannelId)))
 		{
-			TOGGLE_BIT(((uint32)ChannelPortAddress + DIO_DATA_REG),ChannelPinNumber);
-				
-			RetVal = DioReadPin(ChannelPortAddress, ChannelPinNumber);	
+			/* [SWS_Dio_00191] [SWS_Dio_00192] on the RAM shadow of the expander port */
+			RetVal = DioExpanderFlipChannel(DIO_CHANNEL_PORT(ChannelId), DIO_CHANNEL_PIN_MASK(ChannelId));
 		}
 		else
+#endif /* DioExpanderApi */
 		{
+			/* Get the channel's port address and pin mask from its ID */
+			Channel = DioGetChannelDecode(ChannelId);
+	
+			/* Get the channel's PIN Direction */
+			ChannelDirection   = DioGetPinDirection(Channel->PortId, Channel->PinMask);
+		
 			/*
-			   [SWS_Dio_00192]the return value shall be the level of the specified channel.
+			  [SWS_Dio_00192] If the specified channel is configured as an input channel, the API 
+			  shall have no influence on the physical output.
 			*/
-			RetVal = ChannelLevel;
+			if(DIO_PIN_INPUT != ChannelDirection)
+			{
+				/* No interrupt may change the channel between the read and the write */
+				SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+			
+				/*
+				   [SWS_Dio_00191] read the level through the channel's masked address, 
+				   the inverted level is both written back and returned.
+				*/
+				RetVal = (Dio_LevelType)(DioReadPin(Channel->DataAddress) ^ STD_HIGH);
+			
+				DioWritePin(Channel->DataAddress, RetVal);
+			
+				SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+			}
+			else
+			{
+				/*
+				   [SWS_Dio_00192]the return value shall be the level of the specified channel.
+				*/
+				RetVal = DioReadPin(Channel->DataAddress);
+			}
 		}
 	}
 	
@@ -919,95 +1142,1338 @@ Dio_LevelType Dio_FlipChannel( Dio_ChannelType ChannelId )
 
 #endif /* DioFlipChannelApi */
 
-/***********************************************************************************/
-/*				    		Local Function Definitions	         				   */
-/***********************************************************************************/
-
+#if (DioWriteChannelListApi == STD_ON)
 /**********************************************************************************
-**	Service name: DioGetChannelPortNumber                             		     **
+**	Service name: Dio_WriteChannelList                             				 **
 **	                                                      						 **
-**	Syntax:	      Dio_PortType DioGetChannelPortNumber	  						 **
+**	Syntax:	      void Dio_WriteChannelList									 	 **
 **				  ( 															 **
-**					const Dio_ChannelType ChannelId								 **
+**					const Dio_ChannelLevelType * const ChannelListPtr,		     **
+**					const uint8 NumOfChannels 									 **
 ** 				  )																 **
 **																				 **
-**  Description : This LOCAL_INLINE API 									     **
-**				  -Gets the port Number of the specified channel.			   	 **
-**																				 **
+**  Description : This API 													     **
+**				  -sets the levels of a list of DIO channels					 **
+**				  -merges the channels of each port into one mask and value		 **
+**				   and sets each port with a single store						 **
+**				  -have no effect on the physical output level On Input Channels **
+**				  -only available if DioWriteChannelListApi is STD_ON			 **
 **                                                        						 **
-**	Service ID:   NA                           						    	     **
+**	Service ID:   0x20                            						    	 **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
 **  Reentrancy:   Reentrant                                              		 **
 **                                                        						 **
-**	Parameters (in): ChannelId - ID of DIO channel                         		 **
+**	Parameters (in): ChannelListPtr - Pointer to the channel / level pairs       **
+**					 NumOfChannels  - Number of entries in the list				 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
-**                                                   						 	 **                                           					
+**                                                   						 	 **
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    RetVal- the port Number of the specified channel. 			 **
-**																 				 **
+**	Return value: NA				       	 									 **
+**                                                       						 **
 ***********************************************************************************/
-LOCAL_INLINE Dio_PortType DioGetChannelPortNumber(const Dio_ChannelType ChannelId)
+void Dio_WriteChannelList
+(
+	const Dio_ChannelLevelType* const ChannelListPtr,
+	const uint8 NumOfChannels
+)
 {
-	Dio_PortType RetVal;
-	uint8 LocalIndex   ;
+	/* Port and pin of the channel, decoded from the channel ID */
+	Dio_PortType PortId;
+	uint8		 PinMask;
+	/* Pins to be written on each port */
+	uint8	PortMask [DIO_NUM_OF_PORT_IDS] = {0u};
+	/* Levels to be written on each port */
+	uint8	PortLevel[DIO_NUM_OF_PORT_IDS] = {0u};
+	/* Variable to hold the written pins which are configured as output */
+	uint8	OutputMask;
+	/* Variable to save the port address  */
+	uint32	PortAddress;
+	/* Loop indices */
+	uint8	ListIndex;
+	uint8	PortIndex;
+	
+#if (DioDevErrorDetect == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
 	
-	for(LocalIndex = DIO_NUM_0 ; LocalIndex < NUM_OF_USED_PINS; LocalIndex++)
+	if(NULL_PTR == ChannelListPtr)
+	{
+		/* The list pointer shall not be a null pointer */
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITECHANNELLIST_SID, DIO_E_PARAM_POINTER);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	else
 	{
-		if(DioConfig->Dio_PortChannel[LocalIndex].Channel_Id == ChannelId)
+		for(ListIndex = 0u; ListIndex < NumOfChannels; ListIndex++)
 		{
-			RetVal = DioConfig->Dio_PortChannel[LocalIndex].PortId;
+			/* 
+			   [SWS_Dio_00074] if a ChannelId is not valid within the current configuration
+			   the API shall raise the error DIO_E_PARAM_INVALID_CHANNEL_ID to the DET.  
+			*/
+			if((DIO_ERROR == DioCheckChannelID(ChannelListPtr[ListIndex].ChannelId))
+#if (DioExpanderApi == STD_ON)
+			   && (DIO_ERROR == DioCheckExpanderChannelID(ChannelListPtr[ListIndex].ChannelId))
+#endif /* DioExpanderApi */
+			  )
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITECHANNELLIST_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				
+				/* Set the API Errorstate to E_NOT_OK */
+				ErrorState = E_NOT_OK;
+				
+				break;
+			}
 		}
 	}
 	
-	return (RetVal);
+#endif /* DioDevErrorDetect */
+
+	/*
+		[SWS_Dio_00119] if development errors are enabled and an error ocurred,
+		the Dio module’s write functions shall NOT process the write command.
+	*/
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		/* Merge the channels of each port into one mask and one value */
+		for(ListIndex = 0u; ListIndex < NumOfChannels; ListIndex++)
+		{
+			/* MCU and expander channel IDs share the (Port << 4) | Pin encoding */
+			PortId	= DIO_CHANNEL_PORT(ChannelListPtr[ListIndex].ChannelId);
+			PinMask = DIO_CHANNEL_PIN_MASK(ChannelListPtr[ListIndex].ChannelId);
+			
+			/* Entries of an invalid port are skipped, with DET off they would index past the merge arrays */
+			if(PortId < DIO_NUM_OF_PORT_IDS)
+			{
+				PortMask[PortId] |= PinMask;
+				
+				/* A channel listed twice takes its last level */
+				if(STD_LOW != ChannelListPtr[ListIndex].Level)
+				{
+					PortLevel[PortId] |= PinMask;
+				}
+				else
+				{
+					PortLevel[PortId] &= (uint8)(~PinMask);
+				}
+			}
+		}
+		
+#if (DioExpanderApi == STD_ON)
+		/* The expander ports are merged into their RAM shadow, committed by Dio_MainFunction */
+		for(PortIndex = DIO_EXPANDER_FIRST_PORT_ID; PortIndex < DIO_NUM_OF_PORT_IDS; PortIndex++)
+		{
+			if(0u != PortMask[PortIndex])
+			{
+				DioExpanderWritePort(PortIndex, PortMask[PortIndex], PortLevel[PortIndex]);
+			}
+		}
+#endif /* DioExpanderApi */
+		
+		/* Commit each written port with a single store */
+		for(PortIndex = 0u; PortIndex <= DIO_MAX_PORT_ID; PortIndex++)
+		{
+			if(0u != PortMask[PortIndex])
+			{
+				PortAddress = DioGetPortAddress(PortIndex);
+				
+				/*
+					[SWS_Dio_00070] if a Dio write function is used on an input channel,
+					it shall have no effect on the physical output level
+				*/
+				OutputMask = (uint8)(DioGetOutputMask(PortIndex) & PortMask[PortIndex]);
+				
+				if(0u != OutputMask)
+				{
+					SET_PORT(DIO_MASKED_DATA_ADDRESS(PortAddress, OutputMask) , PortLevel[PortIndex]);
+				}
+			}
+		}
+	}
 }
 
+#endif /* DioWriteChannelListApi */
+
+#if (DioDirectionShadow == STD_ON)
 /**********************************************************************************
-**	Service name: DioGetChannelPinNumber                             		     **
+**	Service name: Dio_RefreshPortDirection                         				 **
 **	                                                      						 **
-**	Syntax:	      uint8 DioGetChannelPinNumber	  						 		 **
+**	Syntax:	      void Dio_RefreshPortDirection							 	 	 **
 **				  ( 															 **
-**					const Dio_ChannelType ChannelId								 **
+**					const Dio_PortType PortId								     **
 ** 				  )																 **
 **																				 **
-**  Description : This LOCAL_INLINE API 									     **
-**				  -Gets Pin number from its symbolic ID.					   	 **
-**																				 **
+**  Description : This API 													     **
+**				  -reloads the output pins shadow of a port from its			 **
+**				   direction register											 **
+**				  -shall be called by the Port driver (or the application)		 **
+**				   after the direction of any pin of the port is changed		 **
+**				  -only available if DioDirectionShadow is STD_ON				 **
 **                                                        						 **
-**	Service ID:   NA                           						    	     **
+**	Service ID:   0x21                            						    	 **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
 **  Reentrancy:   Reentrant                                              		 **
 **                                                        						 **
-**	Parameters (in): ChannelId - ID of DIO channel                         		 **
+**	Parameters (in): PortId - ID of DIO Port                      				 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
-**                                                   						 	 **                                           					
+**                                                   						 	 **
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    RetVal- Pin number from its symbolic ID.		 			 **
-**																 				 **
+**	Return value: NA				       	 									 **
+**                                                       						 **
 ***********************************************************************************/
-LOCAL_INLINE uint8 DioGetChannelPinNumber( const Dio_ChannelType ChannelId)
+void Dio_RefreshPortDirection( const Dio_PortType PortId )
 {
-	uint8 LocalTemp = 0x0F  ;
-	Dio_PortType RetVal;
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
 	
-	RetVal = (ChannelId & LocalTemp);
+	/* Every port of the device has a shadow entry, only the range is checked */
+	if(PortId > DIO_MAX_PORT_ID)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_REFRESHPORTDIRECTION_SID, DIO_E_PARAM_INVALID_PORT_ID);
 		
-	return (RetVal);
-}
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
 
-/**********************************************************************************
-**	Service name: DioGetPortAddress                             		         **
-**	                                                      						 **
-**	Syntax:	      uint32 DioGetPortAddress	  						 		     **
-**				  ( 															 **
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		/* Single byte store, a concurrent writer sees either the old or the new mask */
+		DioConfig->Dio_PortOutputMask[PortId] = (uint8)(GET_PORT((uint32)(DioGetPortAddress(PortId) + GPIO_O_DIR)));
+	}
+}
+
+#endif /* DioDirectionShadow */
+
+#if (DioAhbAperture == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_EnableAhbAperture                         				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_EnableAhbAperture( void )						 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -moves the ports of DIO_CFG_AHB_PORT_MASK to the AHB			 **
+**				   aperture (GPIOHBCTL), the other ports stay on APB			 **
+**				  -shall be called once at start-up, before the pins of these	 **
+**				   ports are set up and before any other Dio service			 **
+**				  -only available if DioAhbAperture is STD_ON					 **
+**                                                        						 **
+**	Service ID:   0x22                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_EnableAhbAperture( void )
+{
+	/* Select the AHB aperture of the configured ports, the bits of the other ports are kept */
+	SET_PORT(SYSCTL_GPIOHBCTL , (GET_PORT(SYSCTL_GPIOHBCTL) | DIO_CFG_AHB_PORT_MASK));
+}
+
+#endif /* DioAhbAperture */
+
+#if (DioPatternApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_StartPattern                               				 **
+**	                                                      						 **
+**	Syntax:	      Std_ReturnType Dio_StartPattern							 	 **
+**				  ( 															 **
+**					const Dio_PatternType * const PatternPtr				     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -starts streaming the samples of a pattern to its channel		 **
+**				   group, one sample every Period timer ticks					 **
+**				  -the samples are moved by the uDMA on the timer request,		 **
+**				   the CPU only runs at the end of the table					 **
+**				  -input pins of the group are not written						 **
+**				  -only available if DioPatternApi is STD_ON					 **
+**                                                        						 **
+**	Service ID:   0x23                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Asynchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): PatternPtr - Pointer to the pattern, it shall stay valid	 **
+**								  until the pattern completes or is stopped		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: E_OK     - The pattern is started				 				 **
+**				  E_NOT_OK - A pattern is already running or a development		 **
+**							 error ocurred										 **
+**                                                       						 **
+***********************************************************************************/
+Std_ReturnType Dio_StartPattern( const Dio_PatternType* const PatternPtr )
+{
+	/* Variable to hold the group's output pins */
+	uint8			OutputMask;
+	/* TRUE if the engine was idle and is now owned by this pattern */
+	boolean			Claimed = FALSE;
+	Std_ReturnType	RetVal  = E_NOT_OK;
+	
+#if (DioDevErrorDetect == STD_ON)
+
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	if(NULL_PTR == PatternPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_STARTPATTERN_SID, DIO_E_PARAM_POINTER);
+		
+		ErrorState = E_NOT_OK;
+	}
+	/* The uDMA streams to an MCU port, expander groups can't be patterned */
+	else if((DIO_ERROR == DioCheckGroupID(PatternPtr->Group)) || (PatternPtr->Group->port > DIO_MAX_PORT_ID))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_STARTPATTERN_SID, DIO_E_PARAM_INVALID_GROUP);
+		
+		ErrorState = E_NOT_OK;
+	}
+	else if((NULL_PTR == PatternPtr->Samples) || (0u == PatternPtr->NumOfSamples) ||
+			(PatternPtr->NumOfSamples > DIO_PATTERN_MAX_SAMPLES) || (0u == PatternPtr->Period))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_STARTPATTERN_SID, DIO_E_PARAM_INVALID_PATTERN);
+		
+		ErrorState = E_NOT_OK;
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		/* Take the engine if it is idle */
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		if(NULL_PTR == DioActivePattern)
+		{
+			DioActivePattern = PatternPtr;
+			
+			Claimed = TRUE;
+		}
+		
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		if(TRUE == Claimed)
+		{
+			/*
+			  [SWS_Dio_00040] The samples shall not change the remaining channels 
+			  of the port and channels which are configured as input
+			*/
+			OutputMask = (uint8)(DioGetOutputMask(PatternPtr->Group->port) & PatternPtr->Group->mask);
+			
+			DioPatternDataAddress = DIO_MASKED_DATA_ADDRESS(DioGetPortAddress(PatternPtr->Group->port), OutputMask);
+			
+			/* One byte per timer request, from the incrementing table to the fixed data address */
+			uDMAChannelAssign(DIO_CFG_PATTERN_UDMA_CHANNEL);
+			uDMAChannelAttributeDisable(DIO_CFG_PATTERN_UDMA_CHANNEL, UDMA_ATTR_ALL);
+			uDMAChannelControlSet(DIO_CFG_PATTERN_UDMA_CHANNEL | UDMA_PRI_SELECT,
+								  UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+			DioPatternArm(PatternPtr);
+			
+			/* The timer requests one sample per period, its interrupt only signals the uDMA done */
+			TimerConfigure(DIO_CFG_PATTERN_TIMER_BASE, TIMER_CFG_PERIODIC);
+			TimerLoadSet(DIO_CFG_PATTERN_TIMER_BASE, TIMER_A, (PatternPtr->Period - 1u));
+			TimerIntClear(DIO_CFG_PATTERN_TIMER_BASE, (TIMER_TIMA_DMA | TIMER_TIMA_TIMEOUT));
+			TimerIntEnable(DIO_CFG_PATTERN_TIMER_BASE, TIMER_TIMA_DMA);
+			IntEnable(DIO_CFG_PATTERN_TIMER_INT);
+			
+			if(NULL_PTR != PatternPtr->StartNotification)
+			{
+				PatternPtr->StartNotification();
+			}
+			
+			TimerEnable(DIO_CFG_PATTERN_TIMER_BASE, TIMER_A);
+			
+			RetVal = E_OK;
+		}
+	}
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: Dio_StopPattern                               				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_StopPattern( void )								 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -stops the running pattern, the group keeps the level of		 **
+**				   the last sample written										 **
+**				  -calls the stop notification of the stopped pattern			 **
+**				  -only available if DioPatternApi is STD_ON					 **
+**                                                        						 **
+**	Service ID:   0x24                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_StopPattern( void )
+{
+	/* Pattern which was running */
+	const Dio_PatternType* Stopped;
+	
+	SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	Stopped = DioActivePattern;
+	
+	if(NULL_PTR != Stopped)
+	{
+		TimerDisable(DIO_CFG_PATTERN_TIMER_BASE, TIMER_A);
+		TimerIntDisable(DIO_CFG_PATTERN_TIMER_BASE, TIMER_TIMA_DMA);
+		uDMAChannelDisable(DIO_CFG_PATTERN_UDMA_CHANNEL);
+		
+		DioActivePattern = NULL_PTR;
+	}
+	
+	SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	if((NULL_PTR != Stopped) && (NULL_PTR != Stopped->StopNotification))
+	{
+		Stopped->StopNotification();
+	}
+}
+
+/**********************************************************************************
+**	Service name: Dio_PatternIsr                               					 **
+**	                                                      						 **
+**	Syntax:	      void Dio_PatternIsr( void )								 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -is the interrupt handler of DIO_CFG_PATTERN_TIMER_INT,		 **
+**				   it shall be placed in the vector table (or IntRegister)		 **
+**				  -runs once at the end of the table, re-arms a repeated		 **
+**				   pattern and calls the completion notification				 **
+**				  -only available if DioPatternApi is STD_ON					 **
+**                                                        						 **
+**	Service ID:   NA                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_PatternIsr( void )
+{
+	/* Pattern being streamed */
+	const Dio_PatternType* Pattern = DioActivePattern;
+	
+	TimerIntClear(DIO_CFG_PATTERN_TIMER_BASE, (TIMER_TIMA_DMA | TIMER_TIMA_TIMEOUT));
+	
+	/* The uDMA disables the channel after the last sample */
+	if((NULL_PTR != Pattern) && (true != uDMAChannelIsEnabled(DIO_CFG_PATTERN_UDMA_CHANNEL)))
+	{
+		if(TRUE == Pattern->Repeat)
+		{
+			/* Re-armed within one period, the first sample follows without a gap */
+			DioPatternArm(Pattern);
+		}
+		else
+		{
+			TimerDisable(DIO_CFG_PATTERN_TIMER_BASE, TIMER_A);
+			
+			DioActivePattern = NULL_PTR;
+		}
+		
+		if(NULL_PTR != Pattern->CompleteNotification)
+		{
+			Pattern->CompleteNotification();
+		}
+	}
+}
+
+#endif /* DioPatternApi */
+
+#if ((DioInputSnapshotApi == STD_ON) || (DioExpanderApi == STD_ON))
+/**********************************************************************************
+**	Service name: Dio_MainFunction                         						 **
+**	                                                      						 **
+**	Syntax:	      void Dio_MainFunction( void )							 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -samples the input pins of every configured input port		 **
+**				   with one masked read per port								 **
+**				  -debounces each input channel with a counter, a new level is	 **
+**				   taken after DebounceCycles consecutive samples				 **
+**				  -updates the RAM snapshot and the mask of the channels		 **
+**				   changed in this cycle										 **
+**				  -shall be called periodically, the first call takes the		 **
+**				   sampled levels without debouncing							 **
+**				  -commits the writes of the cycle to the port expanders, one	 **
+**				   transaction per expander whose outputs changed				 **
+**				  -reads the inputs of the port expanders whose input pins		 **
+**				   were read since the last cycle, one transaction per			 **
+**				   expander, the read services return these levels				 **
+**				  -only available if DioInputSnapshotApi or DioExpanderApi		 **
+**				   is STD_ON													 **
+**                                                        						 **
+**	Service ID:   0x28                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_MainFunction( void )
+{
+#if (DioInputSnapshotApi == STD_ON)
+	/* Raw levels sampled in this cycle and channels whose debounced level changes */
+	Dio_PortLevelType				  Sample[DIO_MAX_PORT_ID + 1u];
+	Dio_PortLevelType				  Changed[DIO_MAX_PORT_ID + 1u];
+	const Dio_InputPortType*		  Port;
+	const Dio_InputChannelConfigType* Input;
+	const Dio_ChannelDecodeType*	  Channel;
+	uint8							  Index;
+#endif /* DioInputSnapshotApi */
+	
+#if (DioInputSnapshotApi == STD_ON)
+	for(Index = 0u; Index <= DIO_MAX_PORT_ID; Index++)
+	{
+		Sample[Index]  = DIO_NUM_0;
+		Changed[Index] = DIO_NUM_0;
+	}
+	
+	/* One read per port, however many channels and consumers it has */
+	for(Index = 0u; Index < DIO_CFG_NUM_OF_INPUT_PORTS; Index++)
+	{
+		Port = &DioConfig->Dio_InputPort[Index];
+		
+		Sample[Port->PortId] = (Dio_PortLevelType)GET_PORT(Port->DataAddress);
+	}
+	
+	if(TRUE != DioSnapshotValid)
+	{
+		/* Nothing to debounce against yet, the first samples are taken as they are */
+		for(Index = 0u; Index <= DIO_MAX_PORT_ID; Index++)
+		{
+			DioSnapshotLevel[Index] = Sample[Index];
+		}
+		
+		DioSnapshotValid = TRUE;
+	}
+	else
+	{
+		for(Index = 0u; Index < DIO_CFG_NUM_OF_INPUT_CHANNELS; Index++)
+		{
+			Input   = &DioConfig->Dio_InputChannel[Index];
+			Channel = DioGetChannelDecode(Input->ChannelId);
+			
+			/* Count the consecutive samples which differ from the debounced level */
+			if(0u != ((Sample[Channel->PortId] ^ DioSnapshotLevel[Channel->PortId]) & Channel->PinMask))
+			{
+				DioDebounceCounter[Index]++;
+				
+				if(DioDebounceCounter[Index] >= Input->DebounceCycles)
+				{
+					Changed[Channel->PortId] |= Channel->PinMask;
+					
+					DioDebounceCounter[Index] = DIO_NUM_0;
+				}
+				else
+				{
+					
+				}
+			}
+			else
+			{
+				/* A bounce back restarts the filter */
+				DioDebounceCounter[Index] = DIO_NUM_0;
+			}
+		}
+		
+		/* Single byte stores, a concurrent reader sees either the old or the new cycle of a port */
+		for(Index = 0u; Index <= DIO_MAX_PORT_ID; Index++)
+		{
+			DioSnapshotLevel[Index]  ^= Changed[Index];
+			DioSnapshotChanged[Index] = Changed[Index];
+		}
+	}
+#endif /* DioInputSnapshotApi */
+	
+#if (DioExpanderApi == STD_ON)
+	/* One bus transaction per changed expander, however many writes the cycle had */
+	DioExpanderFlush();
+	
+	/* The read services never touch the bus, they request the reads done here */
+	DioExpanderReadInputs();
+#endif /* DioExpanderApi */
+}
+
+#endif /* DioInputSnapshotApi, DioExpanderApi */
+
+#if (DioInputSnapshotApi == STD_ON)
+
+/**********************************************************************************
+**	Service name: Dio_ReadChannelSnapshot                         				 **
+**	                                                      						 **
+**	Syntax:	      Dio_LevelType Dio_ReadChannelSnapshot						 	 **
+**				  ( 															 **
+**					const Dio_ChannelType ChannelId							     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the debounced level of an input channel from the		 **
+**				   snapshot of the last Dio_MainFunction cycle, no register		 **
+**				   is accessed													 **
+**				  -returns STD_LOW before the first Dio_MainFunction cycle		 **
+**				  -only available if DioInputSnapshotApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x25                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): ChannelId - ID of a debounced DIO input channel     		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_LevelType - STD_HIGH / STD_LOW						 	 **
+**                                                       						 **
+***********************************************************************************/
+Dio_LevelType Dio_ReadChannelSnapshot( const Dio_ChannelType ChannelId )
+{
+	/* Pointer to the channel's decode data */
+	const Dio_ChannelDecodeType* Channel;
+	Dio_LevelType ChannelLevel = STD_LOW;
+	
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	/* Only input channels are sampled into the snapshot */
+	if((DIO_ERROR == DioCheckChannelID(ChannelId)) || 
+	   (DIO_PIN_INPUT != DioConfig->Dio_ChannelDecode[ChannelId].Direction))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READCHANNELSNAPSHOT_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		Channel = DioGetChannelDecode(ChannelId);
+		
+		if(0u != (DioSnapshotLevel[Channel->PortId] & Channel->PinMask))
+		{
+			ChannelLevel = STD_HIGH;
+		}
+	}
+	
+	return (ChannelLevel);
+}
+
+/**********************************************************************************
+**	Service name: Dio_ReadPortSnapshot                         					 **
+**	                                                      						 **
+**	Syntax:	      Dio_PortLevelType Dio_ReadPortSnapshot					 	 **
+**				  ( 															 **
+**					const Dio_PortType PortId								     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the debounced levels of the input channels of a		 **
+**				   port from the snapshot, the other pins read as 0				 **
+**				  -only available if DioInputSnapshotApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x26                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId - ID of DIO Port                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_PortLevelType - Debounced levels of the port			 	 **
+**                                                       						 **
+***********************************************************************************/
+Dio_PortLevelType Dio_ReadPortSnapshot( const Dio_PortType PortId )
+{
+	Dio_PortLevelType PortLevel = DIO_NUM_0;
+	
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	if(DIO_ERROR == DioCheckPortID(PortId))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READPORTSNAPSHOT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		PortLevel = DioSnapshotLevel[PortId];
+	}
+	
+	return (PortLevel);
+}
+
+/**********************************************************************************
+**	Service name: Dio_ReadPortChanged                         					 **
+**	                                                      						 **
+**	Syntax:	      Dio_PortLevelType Dio_ReadPortChanged						 	 **
+**				  ( 															 **
+**					const Dio_PortType PortId								     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the input channels of a port whose debounced level	 **
+**				   changed in the last Dio_MainFunction cycle					 **
+**				  -the mask is replaced every cycle, it is not cleared by		 **
+**				   reading so any number of consumers may read it				 **
+**				  -only available if DioInputSnapshotApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x27                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId - ID of DIO Port                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_PortLevelType - Mask of the changed channels			 	 **
+**                                                       						 **
+***********************************************************************************/
+Dio_PortLevelType Dio_ReadPortChanged( const Dio_PortType PortId )
+{
+	Dio_PortLevelType ChangedMask = DIO_NUM_0;
+	
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	if(DIO_ERROR == DioCheckPortID(PortId))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READPORTCHANGED_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		ChangedMask = DioSnapshotChanged[PortId];
+	}
+	
+	return (ChangedMask);
+}
+
+#endif /* DioInputSnapshotApi */
+
+#if (DioEdgeCaptureApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_StartEdgeCapture                         					 **
+**	                                                      						 **
+**	Syntax:	      void Dio_StartEdgeCapture( void )						 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -selects the configured edges of every edge channel in		 **
+**				   its port's interrupt registers and unmasks them				 **
+**				  -enables the GPIO interrupt of every edge port				 **
+**				  -the channels shall be configured as input and				 **
+**				   Dio_EdgeIsr registered on the edge port interrupts			 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x29                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_StartEdgeCapture( void )
+{
+	const Dio_EdgeChannelConfigType* Edge;
+	const Dio_ChannelDecodeType*	 Channel;
+	uint8							 Index;
+	
+	/* The interrupt registers are shared with the other pins of the ports */
+	SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	for(Index = 0u; Index < DIO_CFG_NUM_OF_EDGE_CHANNELS; Index++)
+	{
+		Edge	= &DioConfig->Dio_EdgeChannel[Index];
+		Channel = DioGetChannelDecode(Edge->ChannelId);
+		
+		/* The pin is masked while its sense is changed, so a spurious edge is not served */
+		DioEdgeSelect(Channel->PortAddress + GPIO_O_IM, Channel->PinMask, FALSE);
+		
+		/* Edge sensitive, on both edges or on the one selected by GPIOIEV */
+		DioEdgeSelect(Channel->PortAddress + GPIO_O_IS, Channel->PinMask, FALSE);
+		DioEdgeSelect(Channel->PortAddress + GPIO_O_IBE, Channel->PinMask, 
+					  (DIO_EDGE_BOTH == Edge->Edge) ? TRUE : FALSE);
+		DioEdgeSelect(Channel->PortAddress + GPIO_O_IEV, Channel->PinMask, 
+					  (DIO_EDGE_RISING == Edge->Edge) ? TRUE : FALSE);
+		
+		/* Drop an edge latched before the capture was started */
+		SET_PORT((Channel->PortAddress + GPIO_O_ICR), Channel->PinMask);
+		
+		DioEdgeSelect(Channel->PortAddress + GPIO_O_IM, Channel->PinMask, TRUE);
+	}
+	
+	SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	for(Index = 0u; Index < DIO_CFG_NUM_OF_EDGE_PORTS; Index++)
+	{
+		IntEnable(DioConfig->Dio_EdgePort[Index].Interrupt);
+	}
+}
+
+/**********************************************************************************
+**	Service name: Dio_StopEdgeCapture                         					 **
+**	                                                      						 **
+**	Syntax:	      void Dio_StopEdgeCapture( void )						 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -masks the edge channels and disables the GPIO interrupt		 **
+**				   of every edge port											 **
+**				  -events already in the ring can still be read					 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2A                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_StopEdgeCapture( void )
+{
+	const Dio_ChannelDecodeType* Channel;
+	uint8						 Index;
+	
+	SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	for(Index = 0u; Index < DIO_CFG_NUM_OF_EDGE_CHANNELS; Index++)
+	{
+		Channel = DioGetChannelDecode(DioConfig->Dio_EdgeChannel[Index].ChannelId);
+		
+		DioEdgeSelect(Channel->PortAddress + GPIO_O_IM, Channel->PinMask, FALSE);
+	}
+	
+	SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	/* The ports may still have other pins unmasked by the application, only the vector is disabled */
+	for(Index = 0u; Index < DIO_CFG_NUM_OF_EDGE_PORTS; Index++)
+	{
+		IntDisable(DioConfig->Dio_EdgePort[Index].Interrupt);
+	}
+}
+
+/**********************************************************************************
+**	Service name: Dio_ReadEdgeEvents                         					 **
+**	                                                      						 **
+**	Syntax:	      uint16 Dio_ReadEdgeEvents									 	 **
+**				  ( 															 **
+**					Dio_EdgeEventType* const EventsPtr,						     **
+**					const uint16 MaxEvents										 **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -moves up to MaxEvents of the oldest captured edge events		 **
+**				   to EventsPtr, in the order they were captured				 **
+**				  -the ring has a single consumer, the API shall only be		 **
+**				   called from one task											 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2B                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): MaxEvents - Size of the EventsPtr array	     			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   EventsPtr - Events read from the ring 				 	 **
+**                                                                               **
+**	Return value: uint16 - Number of events read							 	 **
+**                                                       						 **
+***********************************************************************************/
+uint16 Dio_ReadEdgeEvents( Dio_EdgeEventType* const EventsPtr, const uint16 MaxEvents )
+{
+	uint16 Tail;
+	uint16 Count = DIO_NUM_0;
+	uint16 Index;
+	
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	if(NULL_PTR == EventsPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READEDGEEVENTS_SID, DIO_E_PARAM_POINTER);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		/* Only this API writes the tail, the head is read once so a whole batch is taken */
+		Tail  = DioEdgeTail;
+		Count = (uint16)(DioEdgeHead - Tail);
+		
+		/* The events up to the head are complete, the ISR publishes the head after the event */
+		COMPILER_BARRIER();
+		
+		if(Count > MaxEvents)
+		{
+			Count = MaxEvents;
+		}
+		
+		for(Index = 0u; Index < Count; Index++)
+		{
+			EventsPtr[Index] = DioEdgeRing[(uint16)(Tail + Index) & (DIO_CFG_EDGE_RING_SIZE - 1u)];
+		}
+		
+		/* The slots are handed back to the ISR only after they were copied */
+		COMPILER_BARRIER();
+		
+		DioEdgeTail = (uint16)(Tail + Count);
+	}
+	
+	return (Count);
+}
+
+/**********************************************************************************
+**	Service name: Dio_GetEdgeOverflowCount                         				 **
+**	                                                      						 **
+**	Syntax:	      uint32 Dio_GetEdgeOverflowCount( void )					 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -returns the number of edge events lost because the ring		 **
+**				   was full, the newest events are the ones dropped				 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2C                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: uint32 - Number of lost events since start-up			 	 **
+**                                                       						 **
+***********************************************************************************/
+uint32 Dio_GetEdgeOverflowCount( void )
+{
+	return (DioEdgeOverflow);
+}
+
+/**********************************************************************************
+**	Service name: Dio_EdgeIsr                         							 **
+**	                                                      						 **
+**	Syntax:	      void Dio_EdgeIsr( void )								 	 	 **
+**																				 **
+**  Description : This API 													     **
+**				  -interrupt handler of the edge ports, shall be registered		 **
+**				   on the GPIO interrupt of every port of the edge				 **
+**				   configuration												 **
+**				  -acknowledges the captured edges of the edge channels and		 **
+**				   pushes one event (channel, level, timestamp) per edge		 **
+**				   into the ring, other pins of the port are not touched		 **
+**				  -only available if DioEdgeCaptureApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   NA                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): NA						                      				 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_EdgeIsr( void )
+{
+	uint32 PortAddress;
+	uint32 Timestamp;
+	uint8  Pending;
+	uint8  Levels;
+	uint8  Pin;
+	uint8  Index;
+	
+	for(Index = 0u; Index < DIO_CFG_NUM_OF_EDGE_PORTS; Index++)
+	{
+		PortAddress = DioGetPortAddress(DioConfig->Dio_EdgePort[Index].PortId);
+		
+		/* Pins unmasked by another driver on the same port are left to its handler */
+		Pending = (uint8)(GET_PORT((PortAddress + GPIO_O_MIS)) & DioConfig->Dio_EdgePort[Index].PinMask);
+		
+		if(0u != Pending)
+		{
+			/* Acknowledge first, an edge arriving while the events are pushed raises the interrupt again */
+			SET_PORT((PortAddress + GPIO_O_ICR), Pending);
+			
+			/* One timestamp and one level read for all edges served together */
+			Timestamp = GET_PORT(DIO_CFG_EDGE_TIMESTAMP_ADDRESS);
+			Levels	  = (uint8)GET_PORT(DIO_MASKED_DATA_ADDRESS(PortAddress, Pending));
+			
+			for(Pin = 0u; Pin < DIO_PORT_WIDTH; Pin++)
+			{
+				if(0u != (Pending & (1u << Pin)))
+				{
+					DioEdgePush((Dio_ChannelType)((DioConfig->Dio_EdgePort[Index].PortId << 4u) | Pin), 
+								((0u != (Levels & (1u << Pin))) ? STD_HIGH : STD_LOW), Timestamp);
+				}
+			}
+		}
+	}
+}
+
+#endif /* DioEdgeCaptureApi */
+
+#if (DioVirtualGroupApi == STD_ON)
+/**********************************************************************************
+**	Service name: Dio_ReadVirtualGroup                         					 **
+**	                                                      						 **
+**	Syntax:	      Dio_VirtualGroupLevelType Dio_ReadVirtualGroup			 	 **
+**				  ( 															 **
+**					const Dio_VirtualGroupType* const GroupPtr				     **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -reads the ports of a virtual group back to back inside		 **
+**				   the exclusive area and assembles the group value				 **
+**				  -only available if DioVirtualGroupApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2D                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): GroupPtr - Pointer to the virtual group		     		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: Dio_VirtualGroupLevelType - Level of the group				 **
+**                                                       						 **
+***********************************************************************************/
+Dio_VirtualGroupLevelType Dio_ReadVirtualGroup( const Dio_VirtualGroupType* const GroupPtr )
+{
+	/* Levels of the parts' ports, sampled together */
+	Dio_PortLevelType				PortLevel[DIO_MAX_PORT_ID + 1u];
+	const Dio_VirtualGroupPartType* Part;
+	Dio_VirtualGroupLevelType		Level = 0u;
+	uint8							Index;
+	
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	if(DIO_ERROR == DioCheckVirtualGroupID(GroupPtr))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READVIRTUALGROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	/* Have all checks passed */
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */
+	{
+		Part = GroupPtr->Parts;
+		
+		/* Only the port reads are inside the exclusive area, an interrupt can't split the sample */
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		for(Index = 0u; Index < GroupPtr->NumOfParts; Index++)
+		{
+			PortLevel[Index] = (Dio_PortLevelType)GET_PORT(Part[Index].DataAddress);
+		}
+		
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		for(Index = 0u; Index < GroupPtr->NumOfParts; Index++)
+		{
+			Level |= (Dio_VirtualGroupLevelType)(PortLevel[Index] >> Part[Index].PinOffset) << Part[Index].ValueShift;
+		}
+	}
+	
+	return (Level);
+}
+
+/**********************************************************************************
+**	Service name: Dio_WriteVirtualGroup                         				 **
+**	                                                      						 **
+**	Syntax:	      void Dio_WriteVirtualGroup								 	 **
+**				  ( 															 **
+**					const Dio_VirtualGroupType* const GroupPtr,				     **
+**					const Dio_VirtualGroupLevelType Level						 **
+** 				  )																 **
+**																				 **
+**  Description : This API 													     **
+**				  -splits Level into the values of the ports of a virtual		 **
+**				   group, then writes the ports back to back inside the			 **
+**				   exclusive area												 **
+**				  -input pins of the group are not changed						 **
+**				  -only available if DioVirtualGroupApi is STD_ON				 **
+**                                                        						 **
+**	Service ID:   0x2E                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): GroupPtr - Pointer to the virtual group		     		 **
+**					 Level	  - Value to be written, aligned to the LSB			 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+void Dio_WriteVirtualGroup( const Dio_VirtualGroupType* const GroupPtr, const Dio_VirtualGroupLevelType Level )
+{
+	/* Masked data address and value of each part, prepared before the exclusive area */
+	uint32							DataAddress[DIO_MAX_PORT_ID + 1u];
+	uint32							PortValue[DIO_MAX_PORT_ID + 1u];
+	const Dio_VirtualGroupPartType* Part;
+	uint8							OutputMask;
+	uint8							Index;
+	
+#if (DioDevErrorDetect == STD_ON)
+	
+	/* Variable to Save the API's Error State */
+	uint8 ErrorState = E_OK;
+	
+	if(DIO_ERROR == DioCheckVirtualGroupID(GroupPtr))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITEVIRTUALGROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		
+		/* Set the API Errorstate to E_NOT_OK */
+		ErrorState = E_NOT_OK;
+	}
+	
+#endif /* DioDevErrorDetect */
+
+#if (DioDevErrorDetect == STD_ON)
+	if(E_OK == ErrorState)
+#endif /* DioDevErrorDetect */ 
+	{
+		Part = GroupPtr->Parts;
+		
+		for(Index = 0u; Index < GroupPtr->NumOfParts; Index++)
+		{
+			/*	
+			  [SWS_Dio_00040] The API shall not change the remaining channels of the port
+			  and channels which are configured as input
+			*/
+			OutputMask = (uint8)(DioGetOutputMask(Part[Index].PortId) & Part[Index].Mask);
+			
+			if(OutputMask == Part[Index].Mask)
+			{
+				DataAddress[Index] = Part[Index].DataAddress;
+			}
+			else
+			{
+				DataAddress[Index] = DIO_MASKED_DATA_ADDRESS(DioGetPortAddress(Part[Index].PortId), OutputMask);
+			}
+			
+			PortValue[Index] = (uint32)(Level >> Part[Index].ValueShift) << Part[Index].PinOffset;
+		}
+		
+		/* The ports are committed back to back, the skew is the stores of this loop only */
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		for(Index = 0u; Index < GroupPtr->NumOfParts; Index++)
+		{
+			SET_PORT(DataAddress[Index], PortValue[Index]);
+		}
+		
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	}
+}
+
+#endif /* DioVirtualGroupApi */
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+/**********************************************************************************
+**	Service name: DioGetChannelDecode                             		         **
+**	                                                      						 **
+**	Syntax:	      const Dio_ChannelDecodeType* DioGetChannelDecode	  			 **
+**				  ( 															 **
+**					const Dio_ChannelType ChannelId								 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Gets the decode data (port address, pin mask, direction)	   	 **
+**				   of the specified channel in constant time.					 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): ChannelId - ID of DIO channel                         		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    RetVal- Pointer to the decode data of the channel. 		 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE const Dio_ChannelDecodeType* DioGetChannelDecode(const Dio_ChannelType ChannelId)
+{
+	const Dio_ChannelDecodeType* RetVal;
+	
+	RetVal = &(DioConfig->Dio_ChannelDecode[ChannelId]);
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: DioGetPortAddress                             		         **
+**	                                                      						 **
+**	Syntax:	      uint32 DioGetPortAddress	  						 		     **
+**				  ( 															 **
 **					const Dio_PortType PortNumber							     **
 ** 				  )																 **
 **																				 **
@@ -1073,157 +2539,434 @@ LOCAL_INLINE uint32 DioGetPortAddress(const Dio_PortType PortNumber)
 LOCAL_INLINE uint8 DioCheckChannelID(const Dio_ChannelType ChannelId)
 {
 	uint8 ErrorState  = DIO_OK ;
-    uint8 CannelIndex = 0      ;
-	uint8 Config  	  = 0  	   ;
 	
 	if(ChannelId > DIO_MAX_CHANNEL_ID)
 	{
 		ErrorState = DIO_ERROR ;
 	}	
+	else if(TRUE != DioConfig->Dio_ChannelDecode[ChannelId].Valid)
+	{
+		ErrorState = DIO_ERROR ;
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
 	else
 	{
-		for(CannelIndex = DIO_NUM_0 ; CannelIndex < NUM_OF_USED_PINS ; CannelIndex++)
-		{
-			if(DioConfig->Dio_PortChannel[CannelIndex].Channel_Id == ChannelId)
-			{
-				Config++;
+		
+	}
+	
+	return (ErrorState);
+}
 
-				break;
-			}
+
+/**********************************************************************************
+**	Service name: DioCheckPortID                             		             **
+**	                                                      						 **
+**	Syntax:	      uint8 DioCheckPortID	  						 		         **
+**				  ( 															 **
+**					const Dio_PortType PortId							     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks the PortId if valid or Not.						   	 **
+**																				 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId - ID of DIO Port                         		     **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of PortId, 										 **
+**					 DIO_OK    - PortId Valid				 					 **
+**                   DIO_ERROR - PortId Not Valid               				 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 DioCheckPortID(const Dio_PortType PortId)
+{
+	uint8 ErrorState  = DIO_OK ;
+	
+	if(PortId > DIO_MAX_PORT_ID)
+	{
+		ErrorState = DIO_ERROR ;
+	}	
+	/* Look the port up in the generated bitmap of the ports used by channels and groups */
+	else if(0u == (DIO_CFG_USED_PORT_MASK & (1u << PortId)))
+	{
+		ErrorState = DIO_ERROR ;
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
+	
+	return (ErrorState);
+}
+
+/**********************************************************************************
+**	Service name: DioCheckGroupID                             		             **
+**	                                                      						 **
+**	Syntax:	      uint8 DioCheckGroupID	  						 		         **
+**				  ( 															 **
+**					const Dio_ChannelGroupType * const GroupIdPtr		     	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks the GroupIdPtr if valid or Not.					   	 **
+**																				 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup                 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **                                           					
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of GroupIdPtr, 									 **
+**					 DIO_OK    - GroupIdPtr Valid			 					 **
+**                   DIO_ERROR - GroupIdPtr Not Valid              				 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 DioCheckGroupID(const Dio_ChannelGroupType* const GroupIdPtr)
+{
+	uint32 GroupOffset;
+	uint8 ErrorState = (uint8)DIO_ERROR;
+	
+	/* 
+	   Byte offset of the pointer from the start of the group table, 
+	   a pointer below the table wraps to a large offset
+	*/
+	GroupOffset = (uint32)GroupIdPtr - (uint32)(DioConfig->Dio_ChannelGroup);
+	
+	/* The pointer shall be inside the table and point to the start of an entry */
+	if((GroupOffset < (NUM_OF_USED_GROUPS * sizeof(Dio_ChannelGroupType))) &&
+	   (0u == (GroupOffset % sizeof(Dio_ChannelGroupType))))
+	{
+		ErrorState = (uint8)DIO_OK;
+	}
+
+	return (ErrorState);
+}
+
+#if (DioVirtualGroupApi == STD_ON)
+/**********************************************************************************
+**	Service name: DioCheckVirtualGroupID                             			 **
+**	                                                      						 **
+**	Syntax:	      uint8 DioCheckVirtualGroupID  						 		 **
+**				  ( 															 **
+**					const Dio_VirtualGroupType* const GroupPtr				 	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Checks that GroupPtr points to an entry of the virtual		 **
+**				   group table.													 **
+**                                                        						 **
+**	Service ID:   NA                           						    	     **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): GroupPtr - Pointer to the virtual group            		 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    ErrorState of GroupPtr, 									 **
+**					 DIO_OK    - GroupPtr Valid				 					 **
+**                   DIO_ERROR - GroupPtr Not Valid               				 **
+**																 				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 DioCheckVirtualGroupID(const Dio_VirtualGroupType* const GroupPtr)
+{
+	uint32 GroupOffset;
+	uint8 ErrorState = (uint8)DIO_ERROR;
+	
+	/* Same range and stride check as DioCheckGroupID, NULL_PTR wraps to a large offset */
+	GroupOffset = (uint32)GroupPtr - (uint32)(DioConfig->Dio_VirtualGroup);
+	
+	if((GroupOffset < (DIO_CFG_NUM_OF_VIRTUAL_GROUPS * sizeof(Dio_VirtualGroupType))) &&
+	   (0u == (GroupOffset % sizeof(Dio_VirtualGroupType))))
+	{
+		ErrorState = (uint8)DIO_OK;
+	}
+
+	return (ErrorState);
+}
+
+#endif /* DioVirtualGroupApi */
+
+#if (DioExpanderApi == STD_ON)
+/**********************************************************************************
+**	Service name: DioCheckExpanderChannelID										 **
+**																				 **
+**	Syntax:	      uint8 DioCheckExpanderChannelID								 **
+**				  ( 															 **
+**				  	const Dio_ChannelType ChannelId								 **
+**				   )															 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Checks that ChannelId is a configured channel of an			 **
+**				   expander port												 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): ChannelId - ID of DIO channel								 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: ErrorState of ChannelId,										 **
+**				  DIO_OK    - ChannelId Valid									 **
+**				  DIO_ERROR - ChannelId Not Valid								 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 DioCheckExpanderChannelID(const Dio_ChannelType ChannelId)
+{
+	uint8 ErrorState  = DIO_ERROR ;
+	Dio_PortType PortId = DIO_CHANNEL_PORT(ChannelId);
+	
+	if((DIO_IS_EXPANDER_PORT(PortId)) && (PortId < DIO_NUM_OF_PORT_IDS) &&
+	   (((uint8)ChannelId & 0x0Fu) < DIO_PORT_WIDTH))
+	{
+		if(0u != (DioConfig->Dio_ExpanderPort[PortId - DIO_EXPANDER_FIRST_PORT_ID].ChannelMask & 
+				  DIO_CHANNEL_PIN_MASK(ChannelId)))
+		{
+			ErrorState = DIO_OK ;
 		}
 	}
 	
-	if(Config == 0)
+	return (ErrorState);
+}
+
+/**********************************************************************************
+**	Service name: DioCheckExpanderPortID										 **
+**																				 **
+**	Syntax:	      uint8 DioCheckExpanderPortID									 **
+**				  ( 															 **
+**				  	const Dio_PortType PortId									 **
+**				   )															 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Checks that PortId is the ID of an expander port				 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): PortId - ID of DIO Port									 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: ErrorState of PortId,											 **
+**				  DIO_OK    - PortId Valid										 **
+**				  DIO_ERROR - PortId Not Valid									 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE uint8 DioCheckExpanderPortID(const Dio_PortType PortId)
+{
+	uint8 ErrorState  = DIO_ERROR ;
+	
+	if((DIO_IS_EXPANDER_PORT(PortId)) && (PortId < DIO_NUM_OF_PORT_IDS))
 	{
-		ErrorState = DIO_ERROR ;
+		ErrorState = DIO_OK ;
 	}
 	
-	return (ErrorState);
+	return (ErrorState);
+}
+
+#endif /* DioExpanderApi */
+
+#endif /* DioDevErrorDetect */
+
+#if (DioPatternApi == STD_ON)
+/**********************************************************************************
+**	Service name: DioPatternArm                             					 **
+**	                                                      						 **
+**	Syntax:	      void DioPatternArm									 		 **
+**				  ( 															 **
+**					const Dio_PatternType * PatternPtr					         **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Loads the samples of a pattern into the uDMA channel and		 **
+**				   enables the channel											 **
+**                                                        						 **
+**	Service ID:   NA                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Non Reentrant                                          		 **
+**                                                        						 **
+**	Parameters (in): PatternPtr - Pointer to the pattern					     **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value: NA				       	 									 **
+**                                                       						 **
+***********************************************************************************/
+LOCAL_INLINE void DioPatternArm(const Dio_PatternType* PatternPtr)
+{
+	uDMAChannelTransferSet(DIO_CFG_PATTERN_UDMA_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+						   (void*)PatternPtr->Samples, (void*)DioPatternDataAddress,
+						   PatternPtr->NumOfSamples);
+	
+	uDMAChannelEnable(DIO_CFG_PATTERN_UDMA_CHANNEL);
 }
 
+#endif /* DioPatternApi */
 
+#if (DioEdgeCaptureApi == STD_ON)
 /**********************************************************************************
-**	Service name: DioCheckPortID                             		             **
+**	Service name: DioEdgeSelect                             					 **
 **	                                                      						 **
-**	Syntax:	      uint8 DioCheckPortID	  						 		         **
+**	Syntax:	      void DioEdgeSelect										 	 **
 **				  ( 															 **
-**					const Dio_PortType PortId							     	 **
+**					const uint32 RegAddress,						         	 **
+**					const uint8 PinMask,										 **
+**					const boolean Set											 **
 ** 				  )																 **
 **																				 **
 **  Description : This LOCAL_INLINE API 									     **
-**				  -Checks the PortId if valid or Not.						   	 **
-**																				 **
+**				  -Sets or clears the bit of a pin in a GPIO interrupt			 **
+**				   register, the other pins are kept							 **
 **                                                        						 **
-**	Service ID:   NA                           						    	     **
+**	Service ID:   NA                            						    	 **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
-**  Reentrancy:   Reentrant                                              		 **
+**  Reentrancy:   Non Reentrant                                          		 **
 **                                                        						 **
-**	Parameters (in): PortId - ID of DIO Port                         		     **
+**	Parameters (in): RegAddress - Address of the interrupt register			 	 **
+**					 PinMask	- Mask of the pin within its port				 **
+**					 Set		- TRUE to set the bit, FALSE to clear it		 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
-**                                                   						 	 **                                           					
+**                                                   						 	 **
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    ErrorState of PortId, 										 **
-**					 DIO_OK    - PortId Valid				 					 **
-**                   DIO_ERROR - PortId Not Valid               				 **
-**																 				 **
+**	Return value: NA				       	 									 **
+**                                                       						 **
 ***********************************************************************************/
-LOCAL_INLINE uint8 DioCheckPortID(const Dio_PortType PortId)
+LOCAL_INLINE void DioEdgeSelect
+(
+	const uint32 RegAddress,
+	const uint8 PinMask,
+	const boolean Set
+)
 {
-	uint8 ErrorState  = DIO_OK ;
-    uint8 PortIndex   = 0      ;
-	uint8 Config  	  = 0  	   ;
-	
-	if(PortId > DIO_MAX_PORT_ID)
-	{
-		ErrorState = DIO_ERROR ;
-	}	
-	else
+	if(TRUE == Set)
 	{
-		for(PortIndex = DIO_NUM_0 ; PortIndex < NUM_OF_USED_PORTS ; PortIndex++)
-		{
-			if(DioConfig->Dio_PortChannel[PortIndex].PortId == PortId)
-			{
-				Config++;
-
-				break;
-			}
-		}
+		SET_PORT((RegAddress), (GET_PORT((RegAddress)) | PinMask));
 	}
-	
-	if(Config == 0)
+	else
 	{
-		ErrorState = DIO_ERROR ;
+		SET_PORT((RegAddress), (GET_PORT((RegAddress)) & (uint32)(~(uint32)PinMask)));
 	}
-	
-	return (ErrorState);
 }
 
 /**********************************************************************************
-**	Service name: DioCheckGroupID                             		             **
+**	Service name: DioEdgePush                             						 **
 **	                                                      						 **
-**	Syntax:	      uint8 DioCheckGroupID	  						 		         **
+**	Syntax:	      void DioEdgePush											 	 **
 **				  ( 															 **
-**					const Dio_ChannelGroupType * const GroupIdPtr		     	 **
+**					const Dio_ChannelType ChannelId,				         	 **
+**					const Dio_LevelType Level,									 **
+**					const uint32 Timestamp										 **
 ** 				  )																 **
 **																				 **
 **  Description : This LOCAL_INLINE API 									     **
-**				  -Checks the GroupIdPtr if valid or Not.					   	 **
-**																				 **
+**				  -Pushes one edge event into the ring, the event is			 **
+**				   counted as lost if the ring is full							 **
+**				  -shall only be called by Dio_EdgeIsr (single producer)		 **
 **                                                        						 **
-**	Service ID:   NA                           						    	     **
+**	Service ID:   NA                            						    	 **
 **                                                        						 **
 **	Sync/Async:	  Synchronous           						 				 **
 **																				 **
-**  Reentrancy:   Reentrant                                              		 **
+**  Reentrancy:   Non Reentrant                                          		 **
 **                                                        						 **
-**	Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup                 **
+**	Parameters (in): ChannelId - Channel of the edge						 	 **
+**					 Level	   - Level of the channel after the edge			 **
+**					 Timestamp - Time of the edge								 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
-**                                                   						 	 **                                           					
+**                                                   						 	 **
 **	Parameters (out):   NA    													 **
 **                                                                               **
-**	Return value:    ErrorState of GroupIdPtr, 									 **
-**					 DIO_OK    - GroupIdPtr Valid			 					 **
-**                   DIO_ERROR - GroupIdPtr Not Valid              				 **
-**																 				 **
+**	Return value: NA				       	 									 **
+**                                                       						 **
 ***********************************************************************************/
-LOCAL_INLINE uint8 DioCheckGroupID(const Dio_ChannelGroupType* const GroupIdPtr)
+LOCAL_INLINE void DioEdgePush
+(
+	const Dio_ChannelType ChannelId,
+	const Dio_LevelType Level,
+	const uint32 Timestamp
+)
 {
-	uint32 LocalGroupIndex;
-	uint8 ErrorState = (uint8)DIO_ERROR;
-		
-	if(NULL_PTR != GroupIdPtr)
+	Dio_EdgeEventType* Event;
+	uint16 Head = DioEdgeHead;
+	
+	if((uint16)(Head - DioEdgeTail) >= DIO_CFG_EDGE_RING_SIZE)
 	{
-		for(LocalGroupIndex = 0 ; LocalGroupIndex < NUM_OF_USED_GROUPS; LocalGroupIndex++)
-		{
-			if(GroupIdPtr == &(DioConfig->Dio_ChannelGroup[LocalGroupIndex]))
-			{
-				ErrorState = (uint8)DIO_OK;
-			}
-		}
-	}	
-
-	return (ErrorState);
+		/* The consumer is behind, the oldest events are kept */
+		DioEdgeOverflow++;
+	}
+	else
+	{
+		Event = &DioEdgeRing[Head & (DIO_CFG_EDGE_RING_SIZE - 1u)];
+		
+		Event->Timestamp = Timestamp;
+		Event->ChannelId = ChannelId;
+		Event->Level	 = Level;
+		
+		/* The event is complete before the consumer can see it */
+		COMPILER_BARRIER();
+		
+		DioEdgeHead = (uint16)(Head + 1u);
+	}
 }
 
-#endif /* DioDevErrorDetect */
+#endif /* DioEdgeCaptureApi */
 
 /**********************************************************************************
 **	Service name: DioWritePin                             					     **
 **	                                                      						 **
 **	Syntax:	      void DioWritePin									 		     **
 **				  ( 															 **
-**					const uint32 PortAddress,						         	 **
-**					const uint8 PinNumber, 										 **
+**					const uint32 DataAddress,						         	 **
 **					const Dio_LevelType Level									 **
 ** 				  )																 **
 **																				 **
 **  Description : This LOCAL_INLINE API 									     **
 **				  -set a value of the Pin of the specifies level.				 **
+**				  -writes with a single store to the pin's masked address,		 **
+**				   so other pins of the port are never read or modified.		 **
 **                                                        						 **
 **	Service ID:   NA                            						    	 **
 **                                                        						 **
@@ -1231,8 +2974,7 @@ LOCAL_INLINE uint8 DioCheckGroupID(const Dio_ChannelGroupType* const GroupIdPtr)
 **																				 **
 **  Reentrancy:   Reentrant                                              		 **
 **                                                        						 **
-**	Parameters (in): PortAddress  - Addresss of DIO Port    					 **			
-**					 PinNumber	  - Pin number from its symbolic ID				 **
+**	Parameters (in): DataAddress  - Masked data address of the pin    			 **			
 **					 Level        - Value to be written					         **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
@@ -1244,18 +2986,17 @@ LOCAL_INLINE uint8 DioCheckGroupID(const Dio_ChannelGroupType* const GroupIdPtr)
 ***********************************************************************************/	
 LOCAL_INLINE void DioWritePin
 (
-	const uint32 PortAddress,
-	const uint8 PinNumber, 
+	const uint32 DataAddress,
 	const Dio_LevelType Level
 )
 {
 	if(Level != STD_LOW)
 	{
-		SET_BIT((uint32)(PortAddress + DIO_DATA_REG), PinNumber);
+		SET_PORT(DataAddress, DIO_MASKED_HIGH);
 	}
 	else
 	{
-		CLEAR_BIT((uint32)(PortAddress + DIO_DATA_REG), PinNumber);
+		SET_PORT(DataAddress, DIO_MASKED_LOW);
 	}
 }
 
@@ -1264,8 +3005,7 @@ LOCAL_INLINE void DioWritePin
 **	                                                      						 **
 **	Syntax:	      Dio_LevelType DioReadPin							    	     **
 **				  ( 															 **
-**					const uint32 PortAddress,						         	 **
-**					const uint8 PinNumber 										 **
+**					const uint32 DataAddress						         	 **
 ** 				  )																 **
 **																				 **
 **  Description : This LOCAL_INLINE API 									     **
@@ -1277,8 +3017,7 @@ LOCAL_INLINE void DioWritePin
 **																				 **
 **  Reentrancy:   Reentrant                                              		 **
 **                                                        						 **
-**	Parameters (in): PortAddress  - Addresss of DIO Port    					 **			
-**					 PinNumber	  - Pin number from its symbolic ID				 **
+**	Parameters (in): DataAddress  - Masked data address of the pin    			 **			
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
 **                                                   						 	 **                                           			
@@ -1289,13 +3028,16 @@ LOCAL_INLINE void DioWritePin
 ***********************************************************************************/
 LOCAL_INLINE Dio_LevelType DioReadPin
 (
-	const uint32 PortAddress,
-	const uint8 PinNumber
+	const uint32 DataAddress
 )
 {
-	Dio_LevelType RetVal;
+	Dio_LevelType RetVal = STD_LOW;
 	
-	RetVal = GET_BIT((uint32)(PortAddress + DIO_DATA_REG) , PinNumber);
+	/* The masked data address only returns the level of the pin */
+	if(GET_PORT(DataAddress) != 0u)
+	{
+		RetVal = STD_HIGH;
+	}
 	
 	return (RetVal);
 }
@@ -1305,8 +3047,8 @@ LOCAL_INLINE Dio_LevelType DioReadPin
 **	                                                      						 **
 **	Syntax:	      uint8 DioGetPinDirection									 	 **
 **				  ( 															 **
-**					const uint32 PortAddress,						         	 **
-**					const uint8 PinNumber 										 **
+**					const Dio_PortType PortId,						         	 **
+**					const uint8 PinMask 										 **
 ** 				  )																 **
 **																				 **
 **  Description : This LOCAL_INLINE API 									     **
@@ -1318,8 +3060,8 @@ LOCAL_INLINE Dio_LevelType DioReadPin
 **																				 **
 **  Reentrancy:   Reentrant                                              		 **
 **                                                        						 **
-**	Parameters (in): PortAddress  - Addresss of DIO Port    					 **			
-**					 PinNumber	  - Pin number from its symbolic ID				 **
+**	Parameters (in): PortId  	  - ID of DIO Port		    					 **			
+**					 PinMask	  - Mask of the pin within its port				 **
 **                                                        						 **
 **	Parameters (inout): NA               						 				 **
 **                                                   						 	 **                                           	
@@ -1333,14 +3075,385 @@ LOCAL_INLINE Dio_LevelType DioReadPin
 ***********************************************************************************/
 LOCAL_INLINE uint8 DioGetPinDirection
 (
-	const uint32 PortAddress, 
-	const uint8 PinNumber
+	const Dio_PortType PortId, 
+	const uint8 PinMask
+)
+{
+	uint8 RetVal = DIO_PIN_INPUT;
+	
+	if((DioGetOutputMask(PortId) & PinMask) != 0u)
+	{
+		RetVal = DIO_PIN_OUTPUT;
+	}
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: DioGetOutputMask                             					 **
+**	                                                      						 **
+**	Syntax:	      uint8 DioGetOutputMask									 	 **
+**				  ( 															 **
+**					const Dio_PortType PortId						         	 **
+** 				  )																 **
+**																				 **
+**  Description : This LOCAL_INLINE API 									     **
+**				  -Gets the pins of a port which are configured as output,		 **
+**				   from the direction shadow if DioDirectionShadow is STD_ON	 **
+**				   or else from the direction register							 **
+**                                                        						 **
+**	Service ID:   NA                            						    	 **
+**                                                        						 **
+**	Sync/Async:	  Synchronous           						 				 **
+**																				 **
+**  Reentrancy:   Reentrant                                              		 **
+**                                                        						 **
+**	Parameters (in): PortId  - ID of DIO Port			    					 **
+**                                                        						 **
+**	Parameters (inout): NA               						 				 **
+**                                                   						 	 **
+**	Parameters (out):   NA    													 **
+**                                                                               **
+**	Return value:    RetVal - Mask of the output pins of the port				 **
+**                                                       						 **
+***********************************************************************************/
+LOCAL_INLINE uint8 DioGetOutputMask(const Dio_PortType PortId)
+{
+	uint8 RetVal;
+	
+#if (DioDirectionShadow == STD_ON)
+	RetVal = DioConfig->Dio_PortOutputMask[PortId];
+#else
+	RetVal = (uint8)(GET_PORT((uint32)(DioGetPortAddress(PortId) + GPIO_O_DIR)));
+#endif /* DioDirectionShadow */
+	
+	return (RetVal);
+}
+
+#if (DioExpanderApi == STD_ON)
+/**********************************************************************************
+**	Service name: DioExpanderReadPort											 **
+**																				 **
+**	Syntax:	      Dio_PortLevelType DioExpanderReadPort							 **
+**				  ( 															 **
+**				  	const Dio_PortType PortId,									 **
+**				  	const uint8 PinMask											 **
+**				   )															 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Returns the level of an expander port, the output pins		 **
+**				   from the RAM shadow and the input pins as last read by		 **
+**				   Dio_MainFunction												 **
+**				  -Requests a read of the expander by the next					 **
+**				   Dio_MainFunction if PinMask has configured input pins		 **
+**				  -Never accesses the bus										 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): PortId  - ID of the expander port							 **
+**					 PinMask - Pins the caller needs							 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: Level of the expander port									 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE Dio_PortLevelType DioExpanderReadPort
+(
+	const Dio_PortType PortId,
+	const uint8 PinMask
+)
+{
+	uint8						Index = (uint8)(PortId - DIO_EXPANDER_FIRST_PORT_ID);
+	const Dio_ExpanderPortType* Port  = &DioConfig->Dio_ExpanderPort[Index];
+	uint32						Request = ((uint32)1u << Port->Expander);
+	
+	/* 
+	   Only configured input pins need a read, a request which is already pending costs 
+	   no exclusive area. Dio_MainFunction clears the mask before it reads the expanders
+	*/
+	if((0u != (PinMask & Port->ChannelMask & (uint8)(~Port->OutputMask))) && 
+	   (0u == (DioExpanderReadRequest & Request)))
+	{
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		DioExpanderReadRequest |= Request;
+		
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	}
+	
+	/* Single byte loads, a reader sees either the old or the new level of each shadow */
+	return ((Dio_PortLevelType)((DioExpanderOutput[Index] & Port->OutputMask) | 
+								(DioExpanderInput[Index] & (uint8)(~Port->OutputMask))));
+}
+
+/**********************************************************************************
+**	Service name: DioExpanderWritePort											 **
+**																				 **
+**	Syntax:	      void DioExpanderWritePort										 **
+**				  ( 															 **
+**				  	const Dio_PortType PortId,									 **
+**				  	const uint8 PinMask,										 **
+**				  	const Dio_PortLevelType Level								 **
+**				   )															 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Sets the output pins of PinMask to Level in the RAM			 **
+**				   shadow of an expander port, input pins are not changed		 **
+**				  -The expander is written by the next Dio_MainFunction			 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): PortId  - ID of the expander port							 **
+**					 PinMask - Pins to be written								 **
+**					 Level   - Levels of the port's pins						 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: NA															 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE void DioExpanderWritePort
+(
+	const Dio_PortType PortId,
+	const uint8 PinMask,
+	const Dio_PortLevelType Level
+)
+{
+	uint8 Index		 = (uint8)(PortId - DIO_EXPANDER_FIRST_PORT_ID);
+	uint8 OutputMask = (uint8)(DioConfig->Dio_ExpanderPort[Index].OutputMask & PinMask);
+	
+	/* Read modify write of the shadow, no other writer may interleave */
+	SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	DioExpanderOutput[Index] = (Dio_PortLevelType)((DioExpanderOutput[Index] & (uint8)(~OutputMask)) | (Level & OutputMask));
+	
+	SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+}
+
+/**********************************************************************************
+**	Service name: DioExpanderFlipChannel										 **
+**																				 **
+**	Syntax:	      Dio_LevelType DioExpanderFlipChannel							 **
+**				  ( 															 **
+**				  	const Dio_PortType PortId,									 **
+**				  	const uint8 PinMask											 **
+**				   )															 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Inverts an output channel of an expander port in the			 **
+**				   RAM shadow and returns its new level						 **
+**				  -Returns the level of an input channel unchanged				 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): PortId  - ID of the expander port							 **
+**					 PinMask - Pin of the channel								 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: Level of the channel after the flip							 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE Dio_LevelType DioExpanderFlipChannel
+(
+	const Dio_PortType PortId,
+	const uint8 PinMask
 )
 {
-	Dio_LevelType RetVal;
+	Dio_LevelType RetVal = STD_LOW;
+	uint8 Index = (uint8)(PortId - DIO_EXPANDER_FIRST_PORT_ID);
 	
-	RetVal = GET_BIT((uint32)(PortAddress + GPIO_O_DIR) , PinNumber);
+	if(0u != (DioConfig->Dio_ExpanderPort[Index].OutputMask & PinMask))
+	{
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		DioExpanderOutput[Index] ^= PinMask;
+		
+		if(0u != (DioExpanderOutput[Index] & PinMask))
+		{
+			RetVal = STD_HIGH;
+		}
+		
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	}
+	else if(0u != (DioExpanderReadPort(PortId, PinMask) & PinMask))
+	{
+		RetVal = STD_HIGH;
+	}
+	/* (MISRA-C:2004 Rule 14.10 (required)) 
+	All if … else if constructs shall be terminated with an else clause. */
+	else
+	{
+		
+	}
 	
 	return (RetVal);
 }
 
+/**********************************************************************************
+**	Service name: DioExpanderFlush												 **
+**																				 **
+**	Syntax:	      void DioExpanderFlush( void )									 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Writes all ports of every expander whose RAM shadow			 **
+**				   differs from its output latches, one transaction per		 **
+**				   expander, a failed write is retried in the next cycle		 **
+**				  -shall only be called by Dio_MainFunction						 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): NA															 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: NA															 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE void DioExpanderFlush( void )
+{
+	/* Copy of the shadow, the bus transaction runs outside the exclusive area */
+	Dio_PortLevelType		Output[DIO_CFG_NUM_OF_EXPANDER_PORTS];
+	const Dio_ExpanderType* Expander;
+	boolean					Changed;
+	uint8					ExpanderIndex;
+	uint8					Index;
+	
+	for(ExpanderIndex = 0u; ExpanderIndex < DIO_CFG_NUM_OF_EXPANDERS; ExpanderIndex++)
+	{
+		Expander = &DioConfig->Dio_Expander[ExpanderIndex];
+		Changed	 = FALSE;
+		
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		for(Index = Expander->FirstPort; Index < (Expander->FirstPort + Expander->NumOfPorts); Index++)
+		{
+			Output[Index] = DioExpanderOutput[Index];
+		}
+		
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+		
+		for(Index = Expander->FirstPort; Index < (Expander->FirstPort + Expander->NumOfPorts); Index++)
+		{
+			if(Output[Index] != DioExpanderLatch[Index])
+			{
+				Changed = TRUE;
+			}
+		}
+		
+		/* Writes which cancel out within the cycle cost no transaction */
+		if(TRUE == Changed)
+		{
+			if(E_OK == Expander->Write(Expander->DeviceAddress, &Output[Expander->FirstPort], Expander->NumOfPorts))
+			{
+				for(Index = Expander->FirstPort; Index < (Expander->FirstPort + Expander->NumOfPorts); Index++)
+				{
+					DioExpanderLatch[Index] = Output[Index];
+				}
+			}
+		}
+	}
+}
+
+/**********************************************************************************
+**	Service name: DioExpanderReadInputs											 **
+**																				 **
+**	Syntax:	      void DioExpanderReadInputs( void )							 **
+**																				 **
+**  Description : This LOCAL_INLINE API											 **
+**				  -Reads all ports of every expander whose inputs were			 **
+**				   requested by a read service since the last call, one			 **
+**				   transaction per expander, into the RAM shadow				 **
+**				  -A failed read keeps the last levels and is retried in		 **
+**				   the next cycle												 **
+**				  -shall only be called by Dio_MainFunction						 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): NA															 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: NA															 **
+**																				 **
+***********************************************************************************/
+LOCAL_INLINE void DioExpanderReadInputs( void )
+{
+	/* The bus transaction fills a local copy outside the exclusive area */
+	Dio_PortLevelType		Input[DIO_CFG_NUM_OF_EXPANDER_PORTS];
+	const Dio_ExpanderType* Expander;
+	uint32					Requested;
+	uint8					ExpanderIndex;
+	uint8					Index;
+	
+	/* Requests made from here on are served by the next cycle */
+	SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	Requested			   = DioExpanderReadRequest;
+	DioExpanderReadRequest = 0u;
+	
+	SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+	
+	for(ExpanderIndex = 0u; ExpanderIndex < DIO_CFG_NUM_OF_EXPANDERS; ExpanderIndex++)
+	{
+		Expander = &DioConfig->Dio_Expander[ExpanderIndex];
+		
+		/* Expanders whose inputs nobody read cost no transaction */
+		if(0u != (Requested & ((uint32)1u << ExpanderIndex)))
+		{
+			if(E_OK == Expander->Read(Expander->DeviceAddress, &Input[Expander->FirstPort], Expander->NumOfPorts))
+			{
+				/* The shadow is only updated inside the exclusive area, like the output shadow */
+				SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+				
+				for(Index = Expander->FirstPort; Index < (Expander->FirstPort + Expander->NumOfPorts); Index++)
+				{
+					DioExpanderInput[Index] = Input[Index];
+				}
+				
+				SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+			}
+			else
+			{
+				SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
+				
+				DioExpanderReadRequest |= ((uint32)1u << ExpanderIndex);
+				
+				SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
+			}
+		}
+	}
+}
+
+#endif /* DioExpanderApi */
@@ -0,0 +1,268 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim.c														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host simulation of the Tiva C register bus.					 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "hw_memmap.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Number of register windows on the simulated bus */
+#define SIM_NUM_OF_REGIONS		(sizeof(SimRegions) / sizeof(SimRegions[0]))
+
+/* Number of 32-bit registers in one register window */
+#define SIM_REGS_PER_REGION		(SIM_REGION_SIZE / 4u)
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Register windows of the simulated bus */
+static const Sim_RegionType SimRegions[] =
+{
+	{ GPIO_PORTA_BASE, SIM_GPIO_DATA_ALIAS_SIZE, 0u, Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, 1u, Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTC_BASE, SIM_GPIO_DATA_ALIAS_SIZE, 2u, Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTD_BASE, SIM_GPIO_DATA_ALIAS_SIZE, 3u, Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTE_BASE, SIM_GPIO_DATA_ALIAS_SIZE, 4u, Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTF_BASE, SIM_GPIO_DATA_ALIAS_SIZE, 5u, Sim_GpioRead, Sim_GpioWrite },
+	
+	{ GPIO_PORTA_AHB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, (SIM_GPIO_AHB_INSTANCE | 0u), Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTB_AHB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, (SIM_GPIO_AHB_INSTANCE | 1u), Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTC_AHB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, (SIM_GPIO_AHB_INSTANCE | 2u), Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTD_AHB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, (SIM_GPIO_AHB_INSTANCE | 3u), Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTE_AHB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, (SIM_GPIO_AHB_INSTANCE | 4u), Sim_GpioRead, Sim_GpioWrite },
+	{ GPIO_PORTF_AHB_BASE, SIM_GPIO_DATA_ALIAS_SIZE, (SIM_GPIO_AHB_INSTANCE | 5u), Sim_GpioRead, Sim_GpioWrite },
+	
+	{ SYSCTL_BASE, 0u, 0u, Sim_SysCtlRead, Sim_SysCtlWrite },
+	
+	{ SIM_DWT_BASE, 0u, 0u, Sim_DwtRead, Sim_DwtWrite }
+};
+
+/* Per register access counters of every register window */
+static uint32 SimReadCount [sizeof(SimRegions) / sizeof(SimRegions[0])][SIM_REGS_PER_REGION];
+static uint32 SimWriteCount[sizeof(SimRegions) / sizeof(SimRegions[0])][SIM_REGS_PER_REGION];
+
+/* Bus access sequence number of the last write of every register */
+static uint32 SimLastWrite [sizeof(SimRegions) / sizeof(SimRegions[0])][SIM_REGS_PER_REGION];
+
+/* Total access counters */
+static uint32 SimTotalReads;
+static uint32 SimTotalWrites;
+static uint32 SimUnmappedAccesses;
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to find the register window and counter index of an address */
+static const Sim_RegionType* SimDecode(uint32 Address, uint32* RegionIndex, uint32* CounterIndex);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+uint32 Sim_ReadRegister(uint32 Address)
+{
+	const Sim_RegionType* Region;
+	uint32 RegionIndex;
+	uint32 CounterIndex;
+	uint32 RetVal = 0u;
+	
+	Region = SimDecode(Address, &RegionIndex, &CounterIndex);
+	
+	if(NULL_PTR != Region)
+	{
+		SimReadCount[RegionIndex][CounterIndex]++;
+		SimTotalReads++;
+		
+		RetVal = Region->Read(Region->Instance, (Address - Region->Base));
+	}
+	else
+	{
+		SimUnmappedAccesses++;
+	}
+	
+	return (RetVal);
+}
+
+void Sim_WriteRegister(uint32 Address, uint32 Value)
+{
+	const Sim_RegionType* Region;
+	uint32 RegionIndex;
+	uint32 CounterIndex;
+	
+	Region = SimDecode(Address, &RegionIndex, &CounterIndex);
+	
+	if(NULL_PTR != Region)
+	{
+		SimWriteCount[RegionIndex][CounterIndex]++;
+		SimTotalWrites++;
+		SimLastWrite[RegionIndex][CounterIndex] = SimTotalReads + SimTotalWrites;
+		
+		Region->Write(Region->Instance, (Address - Region->Base), Value);
+	}
+	else
+	{
+		SimUnmappedAccesses++;
+	}
+}
+
+void Sim_Reset(void)
+{
+	Sim_GpioReset();
+	
+	Sim_SysCtlReset();
+	
+	Sim_IntReset();
+	
+	Sim_TimerReset();
+	
+	Sim_UdmaReset();
+	
+	Sim_DwtReset();
+	
+	Sim_ExpanderReset();
+	
+	Sim_ResetCounters();
+}
+
+void Sim_ResetCounters(void)
+{
+	uint32 RegionIndex;
+	uint32 RegIndex;
+	
+	for(RegionIndex = 0u; RegionIndex < SIM_NUM_OF_REGIONS; RegionIndex++)
+	{
+		for(RegIndex = 0u; RegIndex < SIM_REGS_PER_REGION; RegIndex++)
+		{
+			SimReadCount [RegionIndex][RegIndex] = 0u;
+			SimWriteCount[RegionIndex][RegIndex] = 0u;
+			SimLastWrite [RegionIndex][RegIndex] = 0u;
+		}
+	}
+	
+	SimTotalReads		= 0u;
+	SimTotalWrites		= 0u;
+	SimUnmappedAccesses = 0u;
+}
+
+uint32 Sim_GetReadCount(uint32 Address)
+{
+	uint32 RegionIndex;
+	uint32 CounterIndex;
+	uint32 RetVal = 0u;
+	
+	if(NULL_PTR != SimDecode(Address, &RegionIndex, &CounterIndex))
+	{
+		RetVal = SimReadCount[RegionIndex][CounterIndex];
+	}
+	
+	return (RetVal);
+}
+
+uint32 Sim_GetWriteCount(uint32 Address)
+{
+	uint32 RegionIndex;
+	uint32 CounterIndex;
+	uint32 RetVal = 0u;
+	
+	if(NULL_PTR != SimDecode(Address, &RegionIndex, &CounterIndex))
+	{
+		RetVal = SimWriteCount[RegionIndex][CounterIndex];
+	}
+	
+	return (RetVal);
+}
+
+uint32 Sim_GetLastWriteSequence(uint32 Address)
+{
+	uint32 RegionIndex;
+	uint32 CounterIndex;
+	uint32 RetVal = 0u;
+	
+	if(NULL_PTR != SimDecode(Address, &RegionIndex, &CounterIndex))
+	{
+		RetVal = SimLastWrite[RegionIndex][CounterIndex];
+	}
+	
+	return (RetVal);
+}
+
+uint32 Sim_GetTotalReads(void)
+{
+	return (SimTotalReads);
+}
+
+uint32 Sim_GetTotalWrites(void)
+{
+	return (SimTotalWrites);
+}
+
+uint32 Sim_GetUnmappedAccesses(void)
+{
+	return (SimUnmappedAccesses);
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static const Sim_RegionType* SimDecode(uint32 Address, uint32* RegionIndex, uint32* CounterIndex)
+{
+	const Sim_RegionType* RetVal = NULL_PTR;
+	uint32 LocalIndex;
+	uint32 Offset;
+	
+	for(LocalIndex = 0u; LocalIndex < SIM_NUM_OF_REGIONS; LocalIndex++)
+	{
+		if((Address >= SimRegions[LocalIndex].Base) && 
+		   (Address <  (SimRegions[LocalIndex].Base + SIM_REGION_SIZE)))
+		{
+			Offset = Address - SimRegions[LocalIndex].Base;
+			
+			/* Masked aliases of a register are counted on the register itself */
+			if(Offset < SimRegions[LocalIndex].AliasSize)
+			{
+				Offset = 0u;
+			}
+			
+			*RegionIndex  = LocalIndex;
+			*CounterIndex = Offset / 4u;
+			
+			RetVal = &SimRegions[LocalIndex];
+			
+			break;
+		}
+	}
+	
+	return (RetVal);
+}
@@ -0,0 +1,197 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host simulation of the Tiva C register bus.					 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef SIM_H
+#define SIM_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/* Simulated GPIO ports (A..F) */
+#define SIM_GPIO_NUM_OF_PORTS		(6u)
+
+/* Size of one simulated peripheral register window */
+#define SIM_REGION_SIZE				(0x1000u)
+
+/* Accesses inside the GPIODATA masked aperture are counted as GPIODATA accesses */
+#define SIM_GPIO_DATA_ALIAS_SIZE	(0x400u)
+
+/* Instance flag of the GPIO windows on the AHB aperture, the low bits hold the port number */
+#define SIM_GPIO_AHB_INSTANCE		(0x80u)
+
+/* Cortex-M4 data watchpoint and trace unit, only its cycle counter is modelled */
+#define SIM_DWT_BASE				(0xE0001000u)
+#define SIM_DWT_O_CTRL				(0x000u)
+#define SIM_DWT_O_CYCCNT			(0x004u)
+#define SIM_DWT_CTRL_CYCCNTENA		(0x00000001u)
+
+/* Port expanders answering on the expander bus (MCP23017, addresses 0x20..0x27, two ports each) */
+#define SIM_EXPANDER_FIRST_ADDRESS	(0x20u)
+#define SIM_EXPANDER_NUM_OF_DEVICES	(8u)
+#define SIM_EXPANDER_NUM_OF_PORTS	(2u)
+
+/*****************************************************************/
+/*				        Types Definition        		         */
+/*****************************************************************/
+
+/* Read and write handler of a simulated peripheral, Offset is relative to its base */
+typedef uint32 (*Sim_ReadFuncType)(uint8 Instance, uint32 Offset);
+typedef void   (*Sim_WriteFuncType)(uint8 Instance, uint32 Offset, uint32 Value);
+
+/* Type definition of one peripheral register window on the simulated bus */
+typedef struct 
+{
+	/* Base address of the register window */
+	uint32				Base;
+	
+	/* Accesses below this offset are counted on offset 0 (masked register aliases) */
+	uint32				AliasSize;
+	
+	/* Instance number passed to the handlers (e.g. the port number) */
+	uint8				Instance;
+	
+	/* Register read handler */
+	Sim_ReadFuncType	Read;
+	
+	/* Register write handler */
+	Sim_WriteFuncType	Write;
+}Sim_RegionType;
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/* Register bus access, used by the register access macros when SIM_REGISTER_ACCESS is defined */
+extern uint32 Sim_ReadRegister(uint32 Address);
+extern void   Sim_WriteRegister(uint32 Address, uint32 Value);
+
+/* Resets all simulated registers, pin levels and access counters */
+extern void   Sim_Reset(void);
+
+/* Clears the access counters only */
+extern void   Sim_ResetCounters(void);
+
+/* Number of reads / writes of the register at Address since the last counter reset */
+extern uint32 Sim_GetReadCount(uint32 Address);
+extern uint32 Sim_GetWriteCount(uint32 Address);
+
+/* 
+   Bus access sequence number (reads + writes since the last counter reset) of the 
+   last write to a register, 0 if it was not written. The difference of two registers
+   is the number of bus accesses between their writes
+*/
+extern uint32 Sim_GetLastWriteSequence(uint32 Address);
+
+/* Number of reads / writes of all registers since the last counter reset */
+extern uint32 Sim_GetTotalReads(void);
+extern uint32 Sim_GetTotalWrites(void);
+
+/* Number of accesses to addresses which are not mapped on the simulated bus */
+extern uint32 Sim_GetUnmappedAccesses(void);
+
+/* Drives the external level of the masked input pins of a port */
+extern void   Sim_SetPinInput(uint32 PortBase, uint8 PinMask, uint8 Level);
+
+/* Returns the physical level of all pins of a port (outputs driven, inputs sampled) */
+extern uint8  Sim_GetPinLevels(uint32 PortBase);
+
+/* Number of GPIO accesses through the aperture (APB / AHB) a port is not selected for */
+extern uint32 Sim_GetApertureFaults(void);
+
+/* GPIO port model, used by the simulated bus */
+extern uint32 Sim_GpioRead(uint8 Instance, uint32 Offset);
+extern void   Sim_GpioWrite(uint8 Instance, uint32 Offset, uint32 Value);
+extern void   Sim_GpioReset(void);
+
+/* TRUE while the simulated processor interrupts are masked */
+extern boolean Sim_IsIntMasked(void);
+
+/* Number of times the interrupts were masked since the last reset */
+extern uint32 Sim_GetIntMaskCount(void);
+
+/* Unmasks the interrupts and clears the interrupt model */
+extern void   Sim_IntReset(void);
+
+/* Raises an interrupt, its handler runs at once if enabled and not masked, else when it is */
+extern void   Sim_RaiseInterrupt(uint32 Interrupt);
+
+/* Number of interrupt handler entries since the last reset */
+extern uint32 Sim_GetIntServedCount(void);
+
+/* Virtual time in system clock ticks, advancing it runs the timers (and their DMA requests) */
+extern void   Sim_AdvanceTime(uint32 Ticks);
+extern uint32 Sim_GetTime(void);
+
+/* Timer model */
+extern void   Sim_TimerReset(void);
+
+/* uDMA model, a timer request moves one item and returns TRUE when the transfer completed */
+extern boolean Sim_UdmaRequest(uint32 Channel);
+extern uint32  Sim_GetUdmaTransfers(void);
+extern void    Sim_UdmaReset(void);
+
+/* Cycle counter model (DWT_CYCCNT counts the virtual time while enabled), used by the simulated bus */
+extern uint32 Sim_DwtRead(uint8 Instance, uint32 Offset);
+extern void   Sim_DwtWrite(uint8 Instance, uint32 Offset, uint32 Value);
+extern void   Sim_DwtReset(void);
+
+/* 
+   Port expander model, it stands in for the expander transport (Dio_Expander.h). 
+   Drives the input pins, returns the level of the output pins, makes an expander 
+   stop acknowledging, and counts the transactions and their bits on the bus
+*/
+extern void   Sim_ExpanderSetPinInput(uint8 DeviceAddress, uint8 Port, uint8 PinMask, uint8 Level);
+extern uint8  Sim_ExpanderGetOutput(uint8 DeviceAddress, uint8 Port);
+extern void   Sim_ExpanderSetNack(uint8 DeviceAddress, boolean Nack);
+extern uint32 Sim_GetExpanderWrites(void);
+extern uint32 Sim_GetExpanderReads(void);
+extern uint32 Sim_GetExpanderBusBits(void);
+extern void   Sim_ExpanderResetCounters(void);
+extern void   Sim_ExpanderReset(void);
+
+/* System control model, used by the simulated bus */
+extern uint32 Sim_SysCtlRead(uint8 Instance, uint32 Offset);
+extern void   Sim_SysCtlWrite(uint8 Instance, uint32 Offset, uint32 Value);
+extern void   Sim_SysCtlReset(void);
+
+/* Ports moved to the AHB aperture through GPIOHBCTL, bit n set for port n */
+extern uint8  Sim_SysCtlGetGpioAhbMask(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIM_H */
@@ -0,0 +1,120 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_Dwt.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host simulation of the Cortex-M4 cycle counter.				 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* DWT_CTRL, only CYCCNTENA has an effect */
+static uint32 SimDwtCtrl;
+
+/* Counter value at SimDwtStart, and the virtual time it was taken at */
+static uint32 SimDwtCount;
+static uint32 SimDwtStart;
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to get the current counter value */
+static uint32 SimDwtGetCount(void);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+uint32 Sim_DwtRead(uint8 Instance, uint32 Offset)
+{
+	uint32 RetVal = 0u;
+	
+	(void)Instance;
+	
+	if(SIM_DWT_O_CTRL == Offset)
+	{
+		RetVal = SimDwtCtrl;
+	}
+	else if(SIM_DWT_O_CYCCNT == Offset)
+	{
+		RetVal = SimDwtGetCount();
+	}
+	else
+	{
+		
+	}
+	
+	return (RetVal);
+}
+
+void Sim_DwtWrite(uint8 Instance, uint32 Offset, uint32 Value)
+{
+	(void)Instance;
+	
+	if(SIM_DWT_O_CTRL == Offset)
+	{
+		/* Keep the count reached so far, then count (or not) from now on */
+		SimDwtCount = SimDwtGetCount();
+		SimDwtStart = Sim_GetTime();
+		SimDwtCtrl  = Value;
+	}
+	else if(SIM_DWT_O_CYCCNT == Offset)
+	{
+		SimDwtCount = Value;
+		SimDwtStart = Sim_GetTime();
+	}
+	else
+	{
+		
+	}
+}
+
+void Sim_DwtReset(void)
+{
+	SimDwtCtrl  = 0u;
+	SimDwtCount = 0u;
+	SimDwtStart = 0u;
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static uint32 SimDwtGetCount(void)
+{
+	uint32 RetVal = SimDwtCount;
+	
+	if(0u != (SimDwtCtrl & SIM_DWT_CTRL_CYCCNTENA))
+	{
+		RetVal += (Sim_GetTime() - SimDwtStart);
+	}
+	
+	return (RetVal);
+}
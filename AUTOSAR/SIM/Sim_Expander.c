@@ -0,0 +1,259 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_Expander.c												 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host model of the DIO port expanders (MCP23017)				 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "Dio_Expander.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Bits on the bus of one byte (8 data bits and the acknowledge) and of a start / stop condition */
+#define SIM_EXPANDER_BYTE_BITS		(9u)
+#define SIM_EXPANDER_CONDITION_BITS	(1u)
+
+/*******************************************************************************/
+/*                      Local Types Definition  			                   */
+/*******************************************************************************/
+
+/* Registers and pins of one modelled expander */
+typedef struct 
+{
+	/* IODIR, bit set for an input (power-on value 0xFF) */
+	uint8	Direction[SIM_EXPANDER_NUM_OF_PORTS];
+	
+	/* OLAT, output latches (power-on value 0x00) */
+	uint8	Latch[SIM_EXPANDER_NUM_OF_PORTS];
+	
+	/* Level driven on the input pins from outside */
+	uint8	Input[SIM_EXPANDER_NUM_OF_PORTS];
+	
+	/* TRUE if the expander does not acknowledge its address */
+	boolean	Nack;
+}SimExpanderType;
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Modelled expanders, indexed by the bus address minus SIM_EXPANDER_FIRST_ADDRESS */
+static SimExpanderType SimExpander[SIM_EXPANDER_NUM_OF_DEVICES];
+
+/* Transactions and bus bits since the last reset */
+static uint32 SimExpanderWrites;
+static uint32 SimExpanderReads;
+static uint32 SimExpanderBusBits;
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to find the expander of a bus address, NULL_PTR if there is none */
+static SimExpanderType* SimExpanderDecode(uint8 DeviceAddress, uint8 Length);
+
+/* Function to find the expander addressed by a transaction, NULL_PTR if none acknowledges */
+static SimExpanderType* SimExpanderSelect(uint8 DeviceAddress, uint8 Length);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+Std_ReturnType Dio_ExpanderWrite(uint8 DeviceAddress, const uint8* DataPtr, uint8 Length)
+{
+	SimExpanderType* Expander = SimExpanderSelect(DeviceAddress, Length);
+	Std_ReturnType RetVal = E_NOT_OK;
+	uint8 Index;
+	
+	SimExpanderWrites++;
+	
+	/* START, address, register, data, STOP */
+	SimExpanderBusBits += (2u * SIM_EXPANDER_CONDITION_BITS) + ((2u + (uint32)Length) * SIM_EXPANDER_BYTE_BITS);
+	
+	if(NULL_PTR != Expander)
+	{
+		for(Index = 0u; Index < Length; Index++)
+		{
+			Expander->Latch[Index] = DataPtr[Index];
+		}
+		
+		RetVal = E_OK;
+	}
+	
+	return (RetVal);
+}
+
+Std_ReturnType Dio_ExpanderRead(uint8 DeviceAddress, uint8* DataPtr, uint8 Length)
+{
+	SimExpanderType* Expander = SimExpanderSelect(DeviceAddress, Length);
+	Std_ReturnType RetVal = E_NOT_OK;
+	uint8 Index;
+	
+	SimExpanderReads++;
+	
+	/* START, address, register, repeated START, address, data, STOP */
+	SimExpanderBusBits += (3u * SIM_EXPANDER_CONDITION_BITS) + ((3u + (uint32)Length) * SIM_EXPANDER_BYTE_BITS);
+	
+	if(NULL_PTR != Expander)
+	{
+		for(Index = 0u; Index < Length; Index++)
+		{
+			/* GPIO returns the latch on the output pins and the external level on the inputs */
+			DataPtr[Index] = (uint8)((Expander->Latch[Index] & (uint8)(~Expander->Direction[Index])) |
+									 (Expander->Input[Index] & Expander->Direction[Index]));
+		}
+		
+		RetVal = E_OK;
+	}
+	
+	return (RetVal);
+}
+
+Std_ReturnType Dio_ExpanderSetDirection(uint8 DeviceAddress, const uint8* OutputMaskPtr, uint8 Length)
+{
+	SimExpanderType* Expander = SimExpanderSelect(DeviceAddress, Length);
+	Std_ReturnType RetVal = E_NOT_OK;
+	uint8 Index;
+	
+	if(NULL_PTR != Expander)
+	{
+		for(Index = 0u; Index < Length; Index++)
+		{
+			Expander->Direction[Index] = (uint8)(~OutputMaskPtr[Index]);
+		}
+		
+		RetVal = E_OK;
+	}
+	
+	return (RetVal);
+}
+
+void Sim_ExpanderSetPinInput(uint8 DeviceAddress, uint8 Port, uint8 PinMask, uint8 Level)
+{
+	SimExpanderType* Expander = SimExpanderDecode(DeviceAddress, (uint8)(Port + 1u));
+	
+	if(NULL_PTR != Expander)
+	{
+		Expander->Input[Port] = (uint8)((Expander->Input[Port] & (uint8)(~PinMask)) | (Level & PinMask));
+	}
+}
+
+uint8 Sim_ExpanderGetOutput(uint8 DeviceAddress, uint8 Port)
+{
+	SimExpanderType* Expander = SimExpanderDecode(DeviceAddress, (uint8)(Port + 1u));
+	uint8 RetVal = 0u;
+	
+	if(NULL_PTR != Expander)
+	{
+		RetVal = (uint8)(Expander->Latch[Port] & (uint8)(~Expander->Direction[Port]));
+	}
+	
+	return (RetVal);
+}
+
+void Sim_ExpanderSetNack(uint8 DeviceAddress, boolean Nack)
+{
+	if((DeviceAddress >= SIM_EXPANDER_FIRST_ADDRESS) && 
+	   (DeviceAddress <  (SIM_EXPANDER_FIRST_ADDRESS + SIM_EXPANDER_NUM_OF_DEVICES)))
+	{
+		SimExpander[DeviceAddress - SIM_EXPANDER_FIRST_ADDRESS].Nack = Nack;
+	}
+}
+
+uint32 Sim_GetExpanderWrites(void)
+{
+	return (SimExpanderWrites);
+}
+
+uint32 Sim_GetExpanderReads(void)
+{
+	return (SimExpanderReads);
+}
+
+uint32 Sim_GetExpanderBusBits(void)
+{
+	return (SimExpanderBusBits);
+}
+
+void Sim_ExpanderResetCounters(void)
+{
+	SimExpanderWrites  = 0u;
+	SimExpanderReads   = 0u;
+	SimExpanderBusBits = 0u;
+}
+
+void Sim_ExpanderReset(void)
+{
+	uint8 Device;
+	uint8 Port;
+	
+	for(Device = 0u; Device < SIM_EXPANDER_NUM_OF_DEVICES; Device++)
+	{
+		for(Port = 0u; Port < SIM_EXPANDER_NUM_OF_PORTS; Port++)
+		{
+			SimExpander[Device].Direction[Port] = 0xFFu;
+			SimExpander[Device].Latch[Port]		= 0x00u;
+			SimExpander[Device].Input[Port]		= 0x00u;
+		}
+		
+		SimExpander[Device].Nack = FALSE;
+	}
+	
+	Sim_ExpanderResetCounters();
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static SimExpanderType* SimExpanderDecode(uint8 DeviceAddress, uint8 Length)
+{
+	SimExpanderType* RetVal = NULL_PTR;
+	
+	if((DeviceAddress >= SIM_EXPANDER_FIRST_ADDRESS) && 
+	   (DeviceAddress <  (SIM_EXPANDER_FIRST_ADDRESS + SIM_EXPANDER_NUM_OF_DEVICES)) &&
+	   (Length <= SIM_EXPANDER_NUM_OF_PORTS))
+	{
+		RetVal = &SimExpander[DeviceAddress - SIM_EXPANDER_FIRST_ADDRESS];
+	}
+	
+	return (RetVal);
+}
+
+static SimExpanderType* SimExpanderSelect(uint8 DeviceAddress, uint8 Length)
+{
+	SimExpanderType* RetVal = SimExpanderDecode(DeviceAddress, Length);
+	
+	if((NULL_PTR != RetVal) && (TRUE == RetVal->Nack))
+	{
+		RetVal = NULL_PTR;
+	}
+	
+	return (RetVal);
+}
@@ -0,0 +1,352 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_Gpio.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host simulation of the Tiva C GPIO ports.						 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "hw_memmap.h"
+#include "hw_gpio.h"
+#include "gpio.h"
+#include "hw_ints.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Number of 32-bit registers in one GPIO port window */
+#define SIM_GPIO_NUM_OF_REGS	(SIM_REGION_SIZE / 4u)
+
+/* Register index of a register offset */
+#define SIM_GPIO_REG(OFFSET)	((OFFSET) / 4u)
+
+/* Mask of the pins selected by a GPIODATA masked address */
+#define SIM_GPIO_DATA_MASK(OFFSET)	((uint8)((OFFSET) >> 2u))
+
+/* Port number of a GPIO window instance */
+#define SIM_GPIO_PORT(INSTANCE)		((uint8)((INSTANCE) & (uint8)(~SIM_GPIO_AHB_INSTANCE)))
+
+/*******************************************************************************/
+/*                      Local Types Definition		 	  	                   */
+/*******************************************************************************/
+
+/* Type definition of one simulated GPIO port */
+typedef struct 
+{
+	/* Output latch written through GPIODATA */
+	uint8	DataLatch;
+	
+	/* Level driven on the pins from outside (used for input pins) */
+	uint8	PinInput;
+	
+	/* Plain storage of all other registers (GPIODIR, GPIODEN, ...) */
+	uint32	Regs[SIM_GPIO_NUM_OF_REGS];
+}SimGpioPortType;
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Simulated GPIO ports */
+static SimGpioPortType SimGpioPort[SIM_GPIO_NUM_OF_PORTS];
+
+/* Accesses through the aperture a port is not selected for */
+static uint32 SimGpioApertureFaults;
+
+/* Base address of the simulated GPIO ports */
+static const uint32 SimGpioPortBase[SIM_GPIO_NUM_OF_PORTS] =
+{
+	GPIO_PORTA_BASE,
+	GPIO_PORTB_BASE,
+	GPIO_PORTC_BASE,
+	GPIO_PORTD_BASE,
+	GPIO_PORTE_BASE,
+	GPIO_PORTF_BASE
+};
+
+/* AHB base address of the simulated GPIO ports */
+static const uint32 SimGpioPortAhbBase[SIM_GPIO_NUM_OF_PORTS] =
+{
+	GPIO_PORTA_AHB_BASE,
+	GPIO_PORTB_AHB_BASE,
+	GPIO_PORTC_AHB_BASE,
+	GPIO_PORTD_AHB_BASE,
+	GPIO_PORTE_AHB_BASE,
+	GPIO_PORTF_AHB_BASE
+};
+
+/* GPIO interrupt of the simulated ports */
+static const uint32 SimGpioPortInterrupt[SIM_GPIO_NUM_OF_PORTS] =
+{
+	INT_GPIOA,
+	INT_GPIOB,
+	INT_GPIOC,
+	INT_GPIOD,
+	INT_GPIOE,
+	INT_GPIOF
+};
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to get the simulated port of a port base address */
+static SimGpioPortType* SimGpioGetPort(uint32 PortBase);
+
+/* Function to check that a window instance is the aperture selected in GPIOHBCTL */
+static boolean SimGpioApertureSelected(uint8 Instance);
+
+/* Function to latch the edges of a level change of the input pins and raise the port interrupt */
+static void SimGpioLatchEdges(uint32 PortIndex, uint8 OldLevels);
+
+/* Function to raise the port interrupt if a latched edge is unmasked */
+static void SimGpioUpdateInterrupt(uint32 PortIndex);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+uint32 Sim_GpioRead(uint8 Instance, uint32 Offset)
+{
+	SimGpioPortType* Port = &SimGpioPort[SIM_GPIO_PORT(Instance)];
+	uint8  Direction;
+	uint32 RetVal;
+	
+	if(TRUE != SimGpioApertureSelected(Instance))
+	{
+		/* The other aperture of the port does not respond */
+		SimGpioApertureFaults++;
+		
+		RetVal = 0u;
+	}
+	else if(Offset < SIM_GPIO_DATA_ALIAS_SIZE)
+	{
+		Direction = (uint8)Port->Regs[SIM_GPIO_REG(GPIO_O_DIR)];
+		
+		/* Output pins read back the latch, input pins the external level */
+		RetVal = (uint32)(((Port->DataLatch & Direction) | (Port->PinInput & (uint8)(~Direction))) & 
+						  SIM_GPIO_DATA_MASK(Offset));
+	}
+	else if(GPIO_O_MIS == Offset)
+	{
+		RetVal = Port->Regs[SIM_GPIO_REG(GPIO_O_RIS)] & Port->Regs[SIM_GPIO_REG(GPIO_O_IM)];
+	}
+	else
+	{
+		RetVal = Port->Regs[SIM_GPIO_REG(Offset)];
+	}
+	
+	return (RetVal);
+}
+
+void Sim_GpioWrite(uint8 Instance, uint32 Offset, uint32 Value)
+{
+	SimGpioPortType* Port = &SimGpioPort[SIM_GPIO_PORT(Instance)];
+	uint8 Mask;
+	
+	if(TRUE != SimGpioApertureSelected(Instance))
+	{
+		/* The other aperture of the port does not respond */
+		SimGpioApertureFaults++;
+	}
+	else if(Offset < SIM_GPIO_DATA_ALIAS_SIZE)
+	{
+		/* Only the pins selected by address bits [9:2] are written */
+		Mask = SIM_GPIO_DATA_MASK(Offset);
+		
+		Port->DataLatch = (uint8)((Port->DataLatch & (uint8)(~Mask)) | ((uint8)Value & Mask));
+	}
+	else if(GPIO_O_ICR == Offset)
+	{
+		/* Write 1 to clear the latched edges */
+		Port->Regs[SIM_GPIO_REG(GPIO_O_RIS)] &= ~Value;
+	}
+	else if((GPIO_O_RIS == Offset) || (GPIO_O_MIS == Offset))
+	{
+		/* Read only */
+	}
+	else
+	{
+		Port->Regs[SIM_GPIO_REG(Offset)] = Value;
+		
+		/* Unmasking a latched edge raises the interrupt */
+		if(GPIO_O_IM == Offset)
+		{
+			SimGpioUpdateInterrupt(SIM_GPIO_PORT(Instance));
+		}
+	}
+}
+
+void Sim_GpioReset(void)
+{
+	uint32 PortIndex;
+	uint32 RegIndex;
+	
+	for(PortIndex = 0u; PortIndex < SIM_GPIO_NUM_OF_PORTS; PortIndex++)
+	{
+		SimGpioPort[PortIndex].DataLatch = 0u;
+		SimGpioPort[PortIndex].PinInput  = 0u;
+		
+		for(RegIndex = 0u; RegIndex < SIM_GPIO_NUM_OF_REGS; RegIndex++)
+		{
+			SimGpioPort[PortIndex].Regs[RegIndex] = 0u;
+		}
+	}
+	
+	SimGpioApertureFaults = 0u;
+}
+
+uint32 Sim_GetApertureFaults(void)
+{
+	return (SimGpioApertureFaults);
+}
+
+void Sim_SetPinInput(uint32 PortBase, uint8 PinMask, uint8 Level)
+{
+	SimGpioPortType* Port = SimGpioGetPort(PortBase);
+	uint8 OldLevels;
+	
+	if(NULL_PTR != Port)
+	{
+		OldLevels = Port->PinInput;
+		
+		if(STD_LOW != Level)
+		{
+			Port->PinInput |= PinMask;
+		}
+		else
+		{
+			Port->PinInput &= (uint8)(~PinMask);
+		}
+		
+		SimGpioLatchEdges((uint32)(Port - SimGpioPort), OldLevels);
+	}
+}
+
+uint8 Sim_GetPinLevels(uint32 PortBase)
+{
+	SimGpioPortType* Port = SimGpioGetPort(PortBase);
+	uint8 Direction;
+	uint8 RetVal = 0u;
+	
+	if(NULL_PTR != Port)
+	{
+		Direction = (uint8)Port->Regs[SIM_GPIO_REG(GPIO_O_DIR)];
+		
+		RetVal = (uint8)((Port->DataLatch & Direction) | (Port->PinInput & (uint8)(~Direction)));
+	}
+	
+	return (RetVal);
+}
+
+/*
+	Subset of the TivaWare GPIO driver library used by the stubs and test
+	applications, implemented through the simulated register bus.
+*/
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+	Sim_WriteRegister(ui32Port + GPIO_O_DIR, Sim_ReadRegister(ui32Port + GPIO_O_DIR) | ui8Pins);
+	Sim_WriteRegister(ui32Port + GPIO_O_DEN, Sim_ReadRegister(ui32Port + GPIO_O_DEN) | ui8Pins);
+}
+
+void GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+	Sim_WriteRegister(ui32Port + GPIO_O_DIR, Sim_ReadRegister(ui32Port + GPIO_O_DIR) & ~(uint32)ui8Pins);
+	Sim_WriteRegister(ui32Port + GPIO_O_DEN, Sim_ReadRegister(ui32Port + GPIO_O_DEN) | ui8Pins);
+}
+
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+	Sim_WriteRegister(ui32Port + GPIO_O_DATA + ((uint32)ui8Pins << 2u), ui8Val);
+}
+
+int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
+{
+	return ((int32_t)Sim_ReadRegister(ui32Port + GPIO_O_DATA + ((uint32)ui8Pins << 2u)));
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static SimGpioPortType* SimGpioGetPort(uint32 PortBase)
+{
+	SimGpioPortType* RetVal = NULL_PTR;
+	uint32 PortIndex;
+	
+	for(PortIndex = 0u; PortIndex < SIM_GPIO_NUM_OF_PORTS; PortIndex++)
+	{
+		if((SimGpioPortBase[PortIndex] == PortBase) || (SimGpioPortAhbBase[PortIndex] == PortBase))
+		{
+			RetVal = &SimGpioPort[PortIndex];
+		}
+	}
+	
+	return (RetVal);
+}
+
+static void SimGpioLatchEdges(uint32 PortIndex, uint8 OldLevels)
+{
+	SimGpioPortType* Port = &SimGpioPort[PortIndex];
+	uint8 NewLevels = Port->PinInput;
+	uint8 Sensed;
+	uint8 Edges;
+	
+	/* Edge sensitive (GPIOIS clear) digital input pins, level sensitive pins are not modelled */
+	Sensed = (uint8)(Port->Regs[SIM_GPIO_REG(GPIO_O_DEN)] & ~Port->Regs[SIM_GPIO_REG(GPIO_O_DIR)] & 
+					 ~Port->Regs[SIM_GPIO_REG(GPIO_O_IS)]);
+	
+	/* Any edge on GPIOIBE pins, else the edge selected by GPIOIEV */
+	Edges = (uint8)((OldLevels ^ NewLevels) & 
+					(Port->Regs[SIM_GPIO_REG(GPIO_O_IBE)] | 
+					 ~(NewLevels ^ Port->Regs[SIM_GPIO_REG(GPIO_O_IEV)])) & Sensed);
+	
+	if(0u != Edges)
+	{
+		Port->Regs[SIM_GPIO_REG(GPIO_O_RIS)] |= Edges;
+		
+		SimGpioUpdateInterrupt(PortIndex);
+	}
+}
+
+static void SimGpioUpdateInterrupt(uint32 PortIndex)
+{
+	SimGpioPortType* Port = &SimGpioPort[PortIndex];
+	
+	if(0u != (Port->Regs[SIM_GPIO_REG(GPIO_O_RIS)] & Port->Regs[SIM_GPIO_REG(GPIO_O_IM)]))
+	{
+		Sim_RaiseInterrupt(SimGpioPortInterrupt[PortIndex]);
+	}
+}
+
+static boolean SimGpioApertureSelected(uint8 Instance)
+{
+	boolean OnAhb    = (0u != (Instance & SIM_GPIO_AHB_INSTANCE)) ? TRUE : FALSE;
+	boolean AhbOwned = (0u != (Sim_SysCtlGetGpioAhbMask() & (1u << SIM_GPIO_PORT(Instance)))) ? TRUE : FALSE;
+	
+	return ((OnAhb == AhbOwned) ? TRUE : FALSE);
+}
@@ -0,0 +1,214 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_Int.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Simulated processor interrupt mask.							 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "interrupt.h"
+#include "hw_ints.h"
+
+/*******************************************************************************/
+/*                      Local Types Definition		 	  	                   */
+/*******************************************************************************/
+
+/* Type definition of one interrupt vector of the simulated interrupt controller */
+typedef struct 
+{
+	/* Handler registered with IntRegister */
+	void	(*Handler)(void);
+	
+	/* TRUE if enabled with IntEnable */
+	boolean	Enabled;
+	
+	/* TRUE if raised and not yet served */
+	boolean	Pending;
+	
+	/* TRUE while the handler runs, the vector does not preempt itself */
+	boolean	Active;
+}SimIntVectorType;
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* TRUE while the processor interrupts are masked (PRIMASK set) */
+static boolean SimIntMasked = FALSE;
+
+/* Number of times the interrupts were masked */
+static uint32 SimIntMaskCount = 0u;
+
+/* Vectors of the simulated interrupt controller */
+static SimIntVectorType SimIntVector[NUM_INTERRUPTS];
+
+/* Number of handler entries */
+static uint32 SimIntServedCount = 0u;
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to run the handlers of all pending, enabled vectors if not masked */
+static void SimIntServePending(void);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+boolean Sim_IsIntMasked(void)
+{
+	return (SimIntMasked);
+}
+
+uint32 Sim_GetIntMaskCount(void)
+{
+	return (SimIntMaskCount);
+}
+
+void Sim_IntReset(void)
+{
+	uint32 IntIndex;
+	
+	SimIntMasked      = FALSE;
+	SimIntMaskCount   = 0u;
+	SimIntServedCount = 0u;
+	
+	for(IntIndex = 0u; IntIndex < NUM_INTERRUPTS; IntIndex++)
+	{
+		SimIntVector[IntIndex].Handler = NULL_PTR;
+		SimIntVector[IntIndex].Enabled = FALSE;
+		SimIntVector[IntIndex].Pending = FALSE;
+		SimIntVector[IntIndex].Active  = FALSE;
+	}
+}
+
+void Sim_RaiseInterrupt(uint32 Interrupt)
+{
+	if(Interrupt < NUM_INTERRUPTS)
+	{
+		SimIntVector[Interrupt].Pending = TRUE;
+		
+		SimIntServePending();
+	}
+}
+
+uint32 Sim_GetIntServedCount(void)
+{
+	return (SimIntServedCount);
+}
+
+/*
+	Subset of the TivaWare interrupt driver library, both return true if 
+	the interrupts were masked before the call.
+*/
+bool IntMasterEnable(void)
+{
+	bool RetVal = (TRUE == SimIntMasked);
+	
+	SimIntMasked = FALSE;
+	
+	/* Interrupts raised while masked are taken now */
+	SimIntServePending();
+	
+	return (RetVal);
+}
+
+bool IntMasterDisable(void)
+{
+	bool RetVal = (TRUE == SimIntMasked);
+	
+	if(TRUE != SimIntMasked)
+	{
+		SimIntMaskCount++;
+	}
+	
+	SimIntMasked = TRUE;
+	
+	return (RetVal);
+}
+
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void))
+{
+	if(ui32Interrupt < NUM_INTERRUPTS)
+	{
+		SimIntVector[ui32Interrupt].Handler = pfnHandler;
+	}
+}
+
+void IntUnregister(uint32_t ui32Interrupt)
+{
+	if(ui32Interrupt < NUM_INTERRUPTS)
+	{
+		SimIntVector[ui32Interrupt].Handler = NULL_PTR;
+	}
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+	if(ui32Interrupt < NUM_INTERRUPTS)
+	{
+		SimIntVector[ui32Interrupt].Enabled = TRUE;
+		
+		SimIntServePending();
+	}
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+	if(ui32Interrupt < NUM_INTERRUPTS)
+	{
+		SimIntVector[ui32Interrupt].Enabled = FALSE;
+	}
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static void SimIntServePending(void)
+{
+	uint32 IntIndex;
+	
+	/* Lower vector numbers first, as the NVIC does for equal priorities */
+	for(IntIndex = 0u; (IntIndex < NUM_INTERRUPTS) && (TRUE != SimIntMasked); IntIndex++)
+	{
+		if((TRUE == SimIntVector[IntIndex].Pending) && (TRUE == SimIntVector[IntIndex].Enabled) &&
+		   (TRUE != SimIntVector[IntIndex].Active)  && (NULL_PTR != SimIntVector[IntIndex].Handler))
+		{
+			SimIntVector[IntIndex].Pending = FALSE;
+			SimIntVector[IntIndex].Active  = TRUE;
+			SimIntServedCount++;
+			
+			SimIntVector[IntIndex].Handler();
+			
+			SimIntVector[IntIndex].Active  = FALSE;
+			
+			/* Serve what was raised meanwhile, including this vector again */
+			IntIndex = (uint32)(-1);
+		}
+	}
+}
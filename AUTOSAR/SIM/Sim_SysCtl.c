@@ -0,0 +1,86 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_SysCtl.c												 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Simulated TM4C123 system control registers.					 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "hw_memmap.h"
+#include "hw_sysctl.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Number of 32-bit registers in the system control window */
+#define SIM_SYSCTL_NUM_OF_REGS	(SIM_REGION_SIZE / 4u)
+
+/* Register index of a register offset */
+#define SIM_SYSCTL_REG(OFFSET)	((OFFSET) / 4u)
+
+/* Ports controlled by GPIOHBCTL */
+#define SIM_SYSCTL_GPIOHBCTL_MASK	(0x3Fu)
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Plain storage of the system control registers */
+static uint32 SimSysCtlRegs[SIM_SYSCTL_NUM_OF_REGS];
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+uint32 Sim_SysCtlRead(uint8 Instance, uint32 Offset)
+{
+	(void)Instance;
+	
+	return (SimSysCtlRegs[SIM_SYSCTL_REG(Offset)]);
+}
+
+void Sim_SysCtlWrite(uint8 Instance, uint32 Offset, uint32 Value)
+{
+	(void)Instance;
+	
+	SimSysCtlRegs[SIM_SYSCTL_REG(Offset)] = Value;
+}
+
+void Sim_SysCtlReset(void)
+{
+	uint32 RegIndex;
+	
+	for(RegIndex = 0u; RegIndex < SIM_SYSCTL_NUM_OF_REGS; RegIndex++)
+	{
+		SimSysCtlRegs[RegIndex] = 0u;
+	}
+}
+
+uint8 Sim_SysCtlGetGpioAhbMask(void)
+{
+	return ((uint8)(SimSysCtlRegs[SIM_SYSCTL_REG(SYSCTL_GPIOHBCTL - SYSCTL_BASE)] & SIM_SYSCTL_GPIOHBCTL_MASK));
+}
@@ -0,0 +1,323 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_Timer.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Simulated general purpose timers on the virtual time.			 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "hw_memmap.h"
+#include "hw_ints.h"
+#include "timer.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Number of simulated timers */
+#define SIM_NUM_OF_TIMERS		(sizeof(SimTimerHw) / sizeof(SimTimerHw[0]))
+
+/*******************************************************************************/
+/*                      Local Types Definition		 	  	                   */
+/*******************************************************************************/
+
+/* Type definition of the fixed hardware connections of a timer */
+typedef struct 
+{
+	/* Base address of the timer */
+	uint32	Base;
+	
+	/* Interrupt vector of timer A */
+	uint32	Interrupt;
+	
+	/* uDMA channel requested by timer A on time out */
+	uint32	DmaChannel;
+}SimTimerHwType;
+
+/* Type definition of the state of a timer */
+typedef struct 
+{
+	/* Reload value, the timer times out every Load + 1 ticks */
+	uint32	Load;
+	
+	/* Ticks left to the next time out */
+	uint32	Remaining;
+	
+	/* TRUE while counting */
+	boolean	Enabled;
+	
+	/* Interrupt mask (TIMER_TIMA_x) and raw interrupt status */
+	uint32	IntMask;
+	uint32	RawStatus;
+}SimTimerType;
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Hardware connections of the simulated timers (TM4C123 uDMA channel 18 is Timer0A, 20 is Timer1A) */
+static const SimTimerHwType SimTimerHw[] =
+{
+	{ TIMER0_BASE, INT_TIMER0A, 18u },
+	{ TIMER1_BASE, INT_TIMER1A, 20u }
+};
+
+/* State of the simulated timers */
+static SimTimerType SimTimer[sizeof(SimTimerHw) / sizeof(SimTimerHw[0])];
+
+/* Virtual time in system clock ticks */
+static uint32 SimTime = 0u;
+
+/*******************************************************************************/
+/*                      Local Function ProtoType  			                   */
+/*******************************************************************************/
+
+/* Function to get the timer of a base address */
+static SimTimerType* SimTimerGet(uint32 Base, uint32* Index);
+
+/* Function to run the time out of a timer */
+static void SimTimerTimeout(uint32 Index);
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+void Sim_TimerReset(void)
+{
+	uint32 Index;
+	
+	for(Index = 0u; Index < SIM_NUM_OF_TIMERS; Index++)
+	{
+		SimTimer[Index].Load	  = 0u;
+		SimTimer[Index].Remaining = 0u;
+		SimTimer[Index].Enabled   = FALSE;
+		SimTimer[Index].IntMask   = 0u;
+		SimTimer[Index].RawStatus = 0u;
+	}
+	
+	SimTime = 0u;
+}
+
+void Sim_AdvanceTime(uint32 Ticks)
+{
+	uint32 Index;
+	uint32 Step;
+	uint32 NextTimeout;
+	
+	while(Ticks > 0u)
+	{
+		/* Advance to the next time out of any running timer, or to the end */
+		Step = Ticks;
+		
+		for(Index = 0u; Index < SIM_NUM_OF_TIMERS; Index++)
+		{
+			if((TRUE == SimTimer[Index].Enabled) && (SimTimer[Index].Remaining < Step))
+			{
+				Step = SimTimer[Index].Remaining;
+			}
+		}
+		
+		SimTime += Step;
+		Ticks   -= Step;
+		
+		for(Index = 0u; Index < SIM_NUM_OF_TIMERS; Index++)
+		{
+			if(TRUE == SimTimer[Index].Enabled)
+			{
+				SimTimer[Index].Remaining -= Step;
+				
+				if(0u == SimTimer[Index].Remaining)
+				{
+					NextTimeout = SimTimer[Index].Load + 1u;
+					
+					SimTimer[Index].Remaining = NextTimeout;
+					
+					SimTimerTimeout(Index);
+				}
+			}
+		}
+	}
+}
+
+uint32 Sim_GetTime(void)
+{
+	return (SimTime);
+}
+
+/*
+	Subset of the TivaWare timer driver library, timer A only.
+*/
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	(void)ui32Config;
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->Enabled   = FALSE;
+		Timer->RawStatus = 0u;
+	}
+}
+
+void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	(void)ui32Timer;
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->Load		 = ui32Value;
+		Timer->Remaining = ui32Value + 1u;
+	}
+}
+
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	(void)ui32Timer;
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->Enabled = TRUE;
+	}
+}
+
+void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	(void)ui32Timer;
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->Enabled = FALSE;
+	}
+}
+
+void TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->IntMask |= ui32IntFlags;
+	}
+}
+
+void TimerIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->IntMask &= ~(uint32)ui32IntFlags;
+	}
+}
+
+void TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	
+	if(NULL_PTR != Timer)
+	{
+		Timer->RawStatus &= ~(uint32)ui32IntFlags;
+	}
+}
+
+uint32_t TimerIntStatus(uint32_t ui32Base, bool bMasked)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	uint32_t RetVal = 0u;
+	
+	if(NULL_PTR != Timer)
+	{
+		RetVal = (true == bMasked) ? (Timer->RawStatus & Timer->IntMask) : Timer->RawStatus;
+	}
+	
+	return (RetVal);
+}
+
+uint32_t TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer)
+{
+	SimTimerType* Timer = SimTimerGet(ui32Base, NULL_PTR);
+	uint32_t RetVal = 0u;
+	
+	(void)ui32Timer;
+	
+	if(NULL_PTR != Timer)
+	{
+		/* Down counter, reaches 0 at the time out */
+		RetVal = Timer->Remaining - 1u;
+	}
+	
+	return (RetVal);
+}
+
+/***********************************************************************************/
+/*				    		Local Function Definitions	         				   */
+/***********************************************************************************/
+
+static SimTimerType* SimTimerGet(uint32 Base, uint32* Index)
+{
+	SimTimerType* RetVal = NULL_PTR;
+	uint32 LocalIndex;
+	
+	for(LocalIndex = 0u; LocalIndex < SIM_NUM_OF_TIMERS; LocalIndex++)
+	{
+		if(SimTimerHw[LocalIndex].Base == Base)
+		{
+			RetVal = &SimTimer[LocalIndex];
+			
+			if(NULL_PTR != Index)
+			{
+				*Index = LocalIndex;
+			}
+		}
+	}
+	
+	return (RetVal);
+}
+
+static void SimTimerTimeout(uint32 Index)
+{
+	SimTimerType* Timer = &SimTimer[Index];
+	
+	Timer->RawStatus |= TIMER_TIMA_TIMEOUT;
+	
+	/* The time out requests one item from the timer's uDMA channel */
+	if(TRUE == Sim_UdmaRequest(SimTimerHw[Index].DmaChannel))
+	{
+		Timer->RawStatus |= TIMER_TIMA_DMA;
+	}
+	
+	if(0u != (Timer->RawStatus & Timer->IntMask))
+	{
+		Sim_RaiseInterrupt(SimTimerHw[Index].Interrupt);
+	}
+}
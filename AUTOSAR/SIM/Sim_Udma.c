@@ -0,0 +1,201 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Sim_Udma.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Simulated uDMA controller, basic mode memory to peripheral.	 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/***********************************************************************************/
+/*				    			Include Headers			         				   */
+/***********************************************************************************/
+
+#include "Sim.h"
+#include "udma.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Number of uDMA channels */
+#define SIM_UDMA_NUM_OF_CHANNELS	(32u)
+
+/* Channel number of a channel / structure index or mapping */
+#define SIM_UDMA_CHANNEL(INDEX)		((INDEX) & 0x1Fu)
+
+/*******************************************************************************/
+/*                      Local Types Definition		 	  	                   */
+/*******************************************************************************/
+
+/* Type definition of one simulated uDMA channel (primary structure only) */
+typedef struct 
+{
+	/* Source of the next byte */
+	const uint8*	Src;
+	
+	/* Peripheral register written by every item */
+	uint32			Dst;
+	
+	/* Items left in the transfer */
+	uint32			Remaining;
+	
+	/* Source increment, FALSE if UDMA_SRC_INC_NONE */
+	boolean			SrcIncrement;
+	
+	/* TRUE while the channel accepts requests */
+	boolean			Enabled;
+	
+	/* TRUE if assigned to its peripheral with uDMAChannelAssign */
+	boolean			Assigned;
+}SimUdmaChannelType;
+
+/*******************************************************************************/
+/*                      Local Variables Definition  		                   */
+/*******************************************************************************/
+
+/* Simulated uDMA channels */
+static SimUdmaChannelType SimUdmaChannel[SIM_UDMA_NUM_OF_CHANNELS];
+
+/* TRUE after uDMAEnable */
+static boolean SimUdmaEnabled = FALSE;
+
+/* Number of items moved */
+static uint32 SimUdmaTransfers = 0u;
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+void Sim_UdmaReset(void)
+{
+	uint32 Index;
+	
+	for(Index = 0u; Index < SIM_UDMA_NUM_OF_CHANNELS; Index++)
+	{
+		SimUdmaChannel[Index].Src		   = NULL_PTR;
+		SimUdmaChannel[Index].Dst		   = 0u;
+		SimUdmaChannel[Index].Remaining	   = 0u;
+		SimUdmaChannel[Index].SrcIncrement = TRUE;
+		SimUdmaChannel[Index].Enabled	   = FALSE;
+		SimUdmaChannel[Index].Assigned	   = FALSE;
+	}
+	
+	SimUdmaEnabled   = FALSE;
+	SimUdmaTransfers = 0u;
+}
+
+boolean Sim_UdmaRequest(uint32 Channel)
+{
+	SimUdmaChannelType* Chn = &SimUdmaChannel[SIM_UDMA_CHANNEL(Channel)];
+	boolean RetVal = FALSE;
+	
+	if((TRUE == SimUdmaEnabled) && (TRUE == Chn->Enabled) && (TRUE == Chn->Assigned) && (0u != Chn->Remaining))
+	{
+		/* Arbitration size 1, one item per request */
+		Sim_WriteRegister(Chn->Dst, (uint32)(*Chn->Src));
+		
+		SimUdmaTransfers++;
+		
+		if(TRUE == Chn->SrcIncrement)
+		{
+			Chn->Src++;
+		}
+		
+		Chn->Remaining--;
+		
+		/* The channel disables itself and signals done to the peripheral */
+		if(0u == Chn->Remaining)
+		{
+			Chn->Enabled = FALSE;
+			
+			RetVal = TRUE;
+		}
+	}
+	
+	return (RetVal);
+}
+
+uint32 Sim_GetUdmaTransfers(void)
+{
+	return (SimUdmaTransfers);
+}
+
+/*
+	Subset of the TivaWare uDMA driver library.
+*/
+void uDMAEnable(void)
+{
+	SimUdmaEnabled = TRUE;
+}
+
+void uDMAControlBaseSet(void *pControlTable)
+{
+	/* The simulated channels keep their control data internally */
+	(void)pControlTable;
+}
+
+void uDMAChannelAssign(uint32_t ui32Mapping)
+{
+	/* Only encoding 0 of the channels is modelled */
+	SimUdmaChannel[SIM_UDMA_CHANNEL(ui32Mapping)].Assigned = (0u == ((ui32Mapping >> 16u) & 0xFFu)) ? TRUE : FALSE;
+}
+
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+	(void)ui32ChannelNum;
+	(void)ui32Attr;
+}
+
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control)
+{
+	SimUdmaChannel[SIM_UDMA_CHANNEL(ui32ChannelStructIndex)].SrcIncrement = 
+		((ui32Control & UDMA_SRC_INC_NONE) == UDMA_SRC_INC_NONE) ? FALSE : TRUE;
+}
+
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode,
+							void *pvSrcAddr, void *pvDstAddr, uint32_t ui32TransferSize)
+{
+	SimUdmaChannelType* Chn = &SimUdmaChannel[SIM_UDMA_CHANNEL(ui32ChannelStructIndex)];
+	
+	Chn->Src	   = (const uint8*)pvSrcAddr;
+	Chn->Dst	   = (uint32)(unsigned long)pvDstAddr;
+	Chn->Remaining = (UDMA_MODE_STOP != ui32Mode) ? ui32TransferSize : 0u;
+}
+
+void uDMAChannelEnable(uint32_t ui32ChannelNum)
+{
+	SimUdmaChannel[SIM_UDMA_CHANNEL(ui32ChannelNum)].Enabled = TRUE;
+}
+
+void uDMAChannelDisable(uint32_t ui32ChannelNum)
+{
+	SimUdmaChannel[SIM_UDMA_CHANNEL(ui32ChannelNum)].Enabled = FALSE;
+}
+
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum)
+{
+	return (TRUE == SimUdmaChannel[SIM_UDMA_CHANNEL(ui32ChannelNum)].Enabled);
+}
+
+uint32_t uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex)
+{
+	return (SimUdmaChannel[SIM_UDMA_CHANNEL(ui32ChannelStructIndex)].Remaining);
+}
@@ -0,0 +1,115 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	gpio.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare GPIO driver API.				 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __DRIVERLIB_GPIO_H__
+#define __DRIVERLIB_GPIO_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* GPIO pin masks */
+#define GPIO_PIN_0              0x00000001  /* GPIO pin 0 */
+#define GPIO_PIN_1              0x00000002  /* GPIO pin 1 */
+#define GPIO_PIN_2              0x00000004  /* GPIO pin 2 */
+#define GPIO_PIN_3              0x00000008  /* GPIO pin 3 */
+#define GPIO_PIN_4              0x00000010  /* GPIO pin 4 */
+#define GPIO_PIN_5              0x00000020  /* GPIO pin 5 */
+#define GPIO_PIN_6              0x00000040  /* GPIO pin 6 */
+#define GPIO_PIN_7              0x00000080  /* GPIO pin 7 */
+
+/* Dio channel symbolic IDs, high nibble is the port and low nibble is the pin */
+enum
+{
+	DIO_CHANNEL_A_0 = 0x00,
+	DIO_CHANNEL_A_1 = 0x01,
+	DIO_CHANNEL_A_2 = 0x02,
+	DIO_CHANNEL_A_3 = 0x03,
+	DIO_CHANNEL_A_4 = 0x04,
+	DIO_CHANNEL_A_5 = 0x05,
+	DIO_CHANNEL_A_6 = 0x06,
+	DIO_CHANNEL_A_7 = 0x07,
+	DIO_CHANNEL_B_0 = 0x10,
+	DIO_CHANNEL_B_1 = 0x11,
+	DIO_CHANNEL_B_2 = 0x12,
+	DIO_CHANNEL_B_3 = 0x13,
+	DIO_CHANNEL_B_4 = 0x14,
+	DIO_CHANNEL_B_5 = 0x15,
+	DIO_CHANNEL_B_6 = 0x16,
+	DIO_CHANNEL_B_7 = 0x17,
+	DIO_CHANNEL_C_0 = 0x20,
+	DIO_CHANNEL_C_1 = 0x21,
+	DIO_CHANNEL_C_2 = 0x22,
+	DIO_CHANNEL_C_3 = 0x23,
+	DIO_CHANNEL_C_4 = 0x24,
+	DIO_CHANNEL_C_5 = 0x25,
+	DIO_CHANNEL_C_6 = 0x26,
+	DIO_CHANNEL_C_7 = 0x27,
+	DIO_CHANNEL_D_0 = 0x30,
+	DIO_CHANNEL_D_1 = 0x31,
+	DIO_CHANNEL_D_2 = 0x32,
+	DIO_CHANNEL_D_3 = 0x33,
+	DIO_CHANNEL_D_4 = 0x34,
+	DIO_CHANNEL_D_5 = 0x35,
+	DIO_CHANNEL_D_6 = 0x36,
+	DIO_CHANNEL_D_7 = 0x37,
+	DIO_CHANNEL_E_0 = 0x40,
+	DIO_CHANNEL_E_1 = 0x41,
+	DIO_CHANNEL_E_2 = 0x42,
+	DIO_CHANNEL_E_3 = 0x43,
+	DIO_CHANNEL_E_4 = 0x44,
+	DIO_CHANNEL_E_5 = 0x45,
+	DIO_CHANNEL_F_0 = 0x50,
+	DIO_CHANNEL_F_1 = 0x51,
+	DIO_CHANNEL_F_2 = 0x52,
+	DIO_CHANNEL_F_3 = 0x53
+};
+
+/* Dio port symbolic IDs */
+enum
+{
+	DIO_PORT_A = 0,
+	DIO_PORT_B = 1,
+	DIO_PORT_C = 2,
+	DIO_PORT_D = 3,
+	DIO_PORT_E = 4,
+	DIO_PORT_F = 5
+};
+
+/* Driver library functions provided by the simulation */
+extern void    GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins);
+extern void    GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins);
+extern void    GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val);
+extern int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DRIVERLIB_GPIO_H__ */
@@ -0,0 +1,41 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	hw_gpio.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare GPIO registers.					 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __HW_GPIO_H__
+#define __HW_GPIO_H__
+
+/* GPIO register offsets, only the subset used by the AUTOSAR modules is provided */
+#define GPIO_O_DATA             0x00000000  /* GPIO Data */
+#define GPIO_O_DIR              0x00000400  /* GPIO Direction */
+#define GPIO_O_IS               0x00000404  /* GPIO Interrupt Sense */
+#define GPIO_O_IBE              0x00000408  /* GPIO Interrupt Both Edges */
+#define GPIO_O_IEV              0x0000040C  /* GPIO Interrupt Event */
+#define GPIO_O_IM               0x00000410  /* GPIO Interrupt Mask */
+#define GPIO_O_RIS              0x00000414  /* GPIO Raw Interrupt Status */
+#define GPIO_O_MIS              0x00000418  /* GPIO Masked Interrupt Status */
+#define GPIO_O_ICR              0x0000041C  /* GPIO Interrupt Clear */
+#define GPIO_O_DEN              0x0000051C  /* GPIO Digital Enable */
+
+#endif /* __HW_GPIO_H__ */
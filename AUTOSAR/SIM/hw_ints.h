@@ -0,0 +1,45 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	hw_ints.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare interrupt assignments.			 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+/* 
+   Interrupt numbers of the TM4C123, only the subset used by the 
+   AUTOSAR modules is provided. Served by the simulated interrupt controller (Sim.h)
+*/
+#define INT_GPIOA               16          /* GPIO Port A */
+#define INT_GPIOB               17          /* GPIO Port B */
+#define INT_GPIOC               18          /* GPIO Port C */
+#define INT_GPIOD               19          /* GPIO Port D */
+#define INT_GPIOE               20          /* GPIO Port E */
+#define INT_TIMER0A             35          /* 16/32-Bit Timer 0A */
+#define INT_TIMER1A             37          /* 16/32-Bit Timer 1A */
+#define INT_GPIOF               46          /* GPIO Port F */
+
+/* Number of interrupt vectors */
+#define NUM_INTERRUPTS          155
+
+#endif /* __HW_INTS_H__ */
@@ -0,0 +1,50 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	hw_memmap.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare memory map.						 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+/* 
+   Peripheral base addresses of the TM4C123, only the subset used by the 
+   AUTOSAR modules is provided. Accesses are served by the simulated bus (Sim.h)
+*/
+#define GPIO_PORTA_BASE         0x40004000  /* GPIO Port A */
+#define GPIO_PORTB_BASE         0x40005000  /* GPIO Port B */
+#define GPIO_PORTC_BASE         0x40006000  /* GPIO Port C */
+#define GPIO_PORTD_BASE         0x40007000  /* GPIO Port D */
+#define GPIO_PORTE_BASE         0x40024000  /* GPIO Port E */
+#define GPIO_PORTF_BASE         0x40025000  /* GPIO Port F */
+#define GPIO_PORTA_AHB_BASE     0x40058000  /* GPIO Port A (high speed) */
+#define GPIO_PORTB_AHB_BASE     0x40059000  /* GPIO Port B (high speed) */
+#define GPIO_PORTC_AHB_BASE     0x4005A000  /* GPIO Port C (high speed) */
+#define GPIO_PORTD_AHB_BASE     0x4005B000  /* GPIO Port D (high speed) */
+#define GPIO_PORTE_AHB_BASE     0x4005C000  /* GPIO Port E (high speed) */
+#define GPIO_PORTF_AHB_BASE     0x4005D000  /* GPIO Port F (high speed) */
+#define TIMER0_BASE             0x40030000  /* Timer0 */
+#define TIMER1_BASE             0x40031000  /* Timer1 */
+#define UDMA_BASE               0x400FF000  /* uDMA Controller */
+#define SYSCTL_BASE             0x400FE000  /* System Control */
+
+#endif /* __HW_MEMMAP_H__ */
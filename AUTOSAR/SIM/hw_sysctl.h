@@ -0,0 +1,35 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	hw_sysctl.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare system control registers.		 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __HW_SYSCTL_H__
+#define __HW_SYSCTL_H__
+
+/* 
+   System control registers of the TM4C123, only the subset used by the 
+   AUTOSAR modules is provided. Accesses are served by the simulated bus (Sim.h)
+*/
+#define SYSCTL_GPIOHBCTL        0x400FE06C  /* GPIO High-Performance Bus Control */
+
+#endif /* __HW_SYSCTL_H__ */
@@ -0,0 +1,65 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	timer.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare timer driver.					 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __DRIVERLIB_TIMER_H__
+#define __DRIVERLIB_TIMER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Timer selection */
+#define TIMER_A                 0x000000FF  /* Timer A */
+
+/* Timer configuration */
+#define TIMER_CFG_PERIODIC      0x00000022  /* Full-width periodic timer */
+
+/* Timer interrupt sources */
+#define TIMER_TIMA_TIMEOUT      0x00000001  /* TimerA time out interrupt */
+#define TIMER_TIMA_DMA          0x00000020  /* TimerA uDMA complete interrupt */
+
+/* 
+   Subset of the TivaWare timer driver library, Timer0A and Timer1A are 
+   modelled by the simulation on the virtual time (Sim_Timer.c)
+*/
+extern void     TimerConfigure(uint32_t ui32Base, uint32_t ui32Config);
+extern void     TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value);
+extern void     TimerEnable(uint32_t ui32Base, uint32_t ui32Timer);
+extern void     TimerDisable(uint32_t ui32Base, uint32_t ui32Timer);
+extern void     TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void     TimerIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void     TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern uint32_t TimerIntStatus(uint32_t ui32Base, bool bMasked);
+extern uint32_t TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DRIVERLIB_TIMER_H__ */
@@ -0,0 +1,86 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	udma.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	Host (Linux)												 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Host stand-in of the TivaWare uDMA driver.					 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef __DRIVERLIB_UDMA_H__
+#define __DRIVERLIB_UDMA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Channel attributes */
+#define UDMA_ATTR_USEBURST      0x00000001
+#define UDMA_ATTR_ALTSELECT     0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK       0x00000008
+#define UDMA_ATTR_ALL           0x0000000F
+
+/* Transfer modes */
+#define UDMA_MODE_STOP          0x00000000
+#define UDMA_MODE_BASIC         0x00000001
+#define UDMA_MODE_AUTO          0x00000002
+#define UDMA_MODE_PINGPONG      0x00000003
+
+/* Channel control */
+#define UDMA_DST_INC_8          0x00000000
+#define UDMA_DST_INC_NONE       0xC0000000
+#define UDMA_SRC_INC_8          0x00000000
+#define UDMA_SRC_INC_NONE       0x0C000000
+#define UDMA_SIZE_8             0x00000000
+#define UDMA_ARB_1              0x00000000
+
+/* Primary / alternate control structure */
+#define UDMA_PRI_SELECT         0x00000000
+#define UDMA_ALT_SELECT         0x00000020
+
+/* Channel assignments (channel number in bits 7:0, encoding in bits 23:16) */
+#define UDMA_CH18_TIMER0A       0x00000012
+#define UDMA_CH20_TIMER1A       0x00000014
+
+/* 
+   Subset of the TivaWare uDMA driver library, modelled by the simulation (Sim_Udma.c)
+   on the virtual time, the destination is written through the simulated register bus.
+*/
+extern void     uDMAEnable(void);
+extern void     uDMAControlBaseSet(void *pControlTable);
+extern void     uDMAChannelAssign(uint32_t ui32Mapping);
+extern void     uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr);
+extern void     uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control);
+extern void     uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode,
+									   void *pvSrcAddr, void *pvDstAddr, uint32_t ui32TransferSize);
+extern void     uDMAChannelEnable(uint32_t ui32ChannelNum);
+extern void     uDMAChannelDisable(uint32_t ui32ChannelNum);
+extern bool     uDMAChannelIsEnabled(uint32_t ui32ChannelNum);
+extern uint32_t uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DRIVERLIB_UDMA_H__ */
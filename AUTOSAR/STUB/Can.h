@@ -0,0 +1,52 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Can.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : CAN driver stub, CanIf lower layer interface.					 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_CANDriver, AUTOSAR Release 4.3.1				 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef CAN_H
+#define CAN_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+#include "Can_GeneralTypes.h"
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/* 
+   Passes an L-PDU to the hardware transmit object Hth, CAN_BUSY if no mailbox
+   of the object is free. The L-SDU is copied before the call returns.
+*/
+extern Can_ReturnType Can_Write(Can_HwHandleType Hth, const Can_PduType* PduInfo);
+
+/* 
+   Requests a mode transition of the CAN controller Controller, the new mode
+   is reported through CanIf_ControllerModeIndication() once it is reached.
+*/
+extern Can_ReturnType Can_SetControllerMode(uint8 Controller, Can_StateTransitionType Transition);
+
+#endif /*CAN_H*/
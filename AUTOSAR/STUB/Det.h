@@ -30,7 +30,7 @@
 /*				    	Include Headers					         */
 /*****************************************************************/
 
-#include "Std_Types.h "
+#include "Std_Types.h"
 
 /*****************************************************************/
 /*				        Macros Definition       		         */
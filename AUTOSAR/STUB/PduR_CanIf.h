@@ -0,0 +1,46 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	PduR_CanIf.h												 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : PduR stub, CanIf upper layer interface.						 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_PDURouter, AUTOSAR Release 4.3.1				 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef PDUR_CANIF_H
+#define PDUR_CANIF_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/* Indication of a received I-PDU from CanIf */
+extern void PduR_CanIfRxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
+
+/* Confirmation of a transmitted I-PDU from CanIf */
+extern void PduR_CanIfTxConfirmation(PduIdType TxPduId, Std_ReturnType result);
+
+#endif /*PDUR_CANIF_H*/
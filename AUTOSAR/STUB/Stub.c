@@ -34,6 +34,8 @@ Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, u
   	GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE , GPIO_PIN_3);
 
 		GPIOPinWrite(GPIO_PORTF_BASE , GPIO_PIN_3 , GPIO_PIN_3);
+		
+		return E_OK;
 }
 
 
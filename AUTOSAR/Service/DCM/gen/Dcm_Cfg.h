@@ -0,0 +1,56 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Dcm_Cfg.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2021-5-16													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Dcm pre-compile configuration file							 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_DiagnosticCommunicationManager, AUTR 4.3.1	 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No													 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef DCM_CFG_H
+#define DCM_CFG_H
+
+/* Generated by tools/CfgGen/CfgGen.py from Ecu.json, changes are lost on the next generation */
+
+/* Development error detection and notification */
+#define DCM_DEV_ERROR_DETECT				STD_ON
+
+/* Configured diagnostic services */
+#define DCM_NUM_OF_SERVICES					(2u)
+
+/* Request and response buffers of the DSL, the longest configured request and response in bytes */
+#define DCM_DSL_RX_BUFFER_SIZE				(2u)
+#define DCM_DSL_TX_BUFFER_SIZE				(6u)
+
+/* Configured diagnostic sessions */
+#define DCM_NUM_OF_SESSIONS					(3u)
+
+/* Diagnostic sessions, the session control value and its bit in DcmDsdSidTabSessionLevelRef */
+#define DCM_SESSION_DEFAULT				(0x01u)
+#define DCM_SESSION_MASK_DEFAULT		(0x01u)
+#define DCM_SESSION_PROGRAMMING			(0x02u)
+#define DCM_SESSION_MASK_PROGRAMMING	(0x02u)
+#define DCM_SESSION_EXTENDED			(0x03u)
+#define DCM_SESSION_MASK_EXTENDED		(0x04u)
+
+/* Service IDs of the configured services */
+#define DCM_SID_DIAGNOSTIC_SESSION_CONTROL	(0x10u)
+#define DCM_SID_TESTER_PRESENT				(0x3Eu)
+
+#endif /* DCM_CFG_H */
@@ -0,0 +1,346 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Dcm_Lcfg.c													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2021-5-16													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Dcm link time configuration file								 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_DiagnosticCommunicationManager, AUTR 4.3.1	 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No													 **
+**                                                       					     **
+***********************************************************************************/
+
+/* Generated by tools/CfgGen/CfgGen.py from Ecu.json, changes are lost on the next generation */
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Dcm_Lcfg.h"
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/* Processing functions of the configured services */
+extern Std_ReturnType Dcm_DspDiagnosticSessionControl(Dcm_ExtendedOpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+extern Std_ReturnType Dcm_DspTesterPresent(Dcm_ExtendedOpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, Dcm_NegativeResponseCodeType* ErrorCode);
+
+/*****************************************************************/
+/*				        Configuration Objects      		         */
+/*****************************************************************/
+
+/* Service table sorted by service ID */
+const Dcm_DsdServiceType DcmDsdService[DCM_NUM_OF_SERVICES] =
+{
+	/* DIAGNOSTIC_SESSION_CONTROL */
+	{
+		DCM_SID_DIAGNOSTIC_SESSION_CONTROL,
+		TRUE,
+		(DCM_SESSION_MASK_DEFAULT | DCM_SESSION_MASK_PROGRAMMING | DCM_SESSION_MASK_EXTENDED),
+		0x01u,
+		2u,
+		2u,
+		Dcm_DspDiagnosticSessionControl
+	},
+	/* TESTER_PRESENT */
+	{
+		DCM_SID_TESTER_PRESENT,
+		TRUE,
+		(DCM_SESSION_MASK_DEFAULT | DCM_SESSION_MASK_PROGRAMMING | DCM_SESSION_MASK_EXTENDED),
+		0x01u,
+		2u,
+		2u,
+		Dcm_DspTesterPresent
+	}
+};
+
+/* 
+   Index of every service ID in the service table, a request is dispatched 
+   to its service in constant time instead of searching the service table
+*/
+const uint8 DcmDsdSidIndex[DCM_NUM_OF_SIDS] =
+{
+	/* 0x00 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x01 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x02 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x03 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x04 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x05 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x06 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x07 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x08 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x09 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x0A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x0B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x0C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x0D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x0E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x0F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x10 */	0u,
+	/* 0x11 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x12 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x13 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x14 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x15 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x16 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x17 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x18 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x19 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x1A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x1B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x1C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x1D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x1E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x1F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x20 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x21 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x22 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x23 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x24 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x25 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x26 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x27 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x28 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x29 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x2A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x2B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x2C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x2D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x2E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x2F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x30 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x31 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x32 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x33 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x34 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x35 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x36 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x37 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x38 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x39 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x3A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x3B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x3C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x3D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x3E */	1u,
+	/* 0x3F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x40 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x41 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x42 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x43 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x44 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x45 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x46 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x47 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x48 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x49 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x4A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x4B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x4C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x4D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x4E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x4F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x50 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x51 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x52 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x53 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x54 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x55 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x56 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x57 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x58 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x59 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x5A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x5B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x5C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x5D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x5E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x5F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x60 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x61 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x62 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x63 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x64 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x65 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x66 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x67 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x68 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x69 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x6A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x6B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x6C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x6D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x6E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x6F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x70 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x71 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x72 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x73 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x74 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x75 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x76 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x77 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x78 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x79 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x7A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x7B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x7C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x7D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x7E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x7F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x80 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x81 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x82 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x83 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x84 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x85 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x86 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x87 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x88 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x89 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x8A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x8B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x8C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x8D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x8E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x8F */	DCM_SID_NOT_SUPPORTED,
+	/* 0x90 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x91 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x92 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x93 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x94 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x95 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x96 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x97 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x98 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x99 */	DCM_SID_NOT_SUPPORTED,
+	/* 0x9A */	DCM_SID_NOT_SUPPORTED,
+	/* 0x9B */	DCM_SID_NOT_SUPPORTED,
+	/* 0x9C */	DCM_SID_NOT_SUPPORTED,
+	/* 0x9D */	DCM_SID_NOT_SUPPORTED,
+	/* 0x9E */	DCM_SID_NOT_SUPPORTED,
+	/* 0x9F */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA0 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA1 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA2 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA3 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA4 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA5 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA6 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA7 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA8 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xA9 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xAA */	DCM_SID_NOT_SUPPORTED,
+	/* 0xAB */	DCM_SID_NOT_SUPPORTED,
+	/* 0xAC */	DCM_SID_NOT_SUPPORTED,
+	/* 0xAD */	DCM_SID_NOT_SUPPORTED,
+	/* 0xAE */	DCM_SID_NOT_SUPPORTED,
+	/* 0xAF */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB0 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB1 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB2 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB3 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB4 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB5 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB6 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB7 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB8 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xB9 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xBA */	DCM_SID_NOT_SUPPORTED,
+	/* 0xBB */	DCM_SID_NOT_SUPPORTED,
+	/* 0xBC */	DCM_SID_NOT_SUPPORTED,
+	/* 0xBD */	DCM_SID_NOT_SUPPORTED,
+	/* 0xBE */	DCM_SID_NOT_SUPPORTED,
+	/* 0xBF */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC0 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC1 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC2 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC3 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC4 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC5 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC6 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC7 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC8 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xC9 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xCA */	DCM_SID_NOT_SUPPORTED,
+	/* 0xCB */	DCM_SID_NOT_SUPPORTED,
+	/* 0xCC */	DCM_SID_NOT_SUPPORTED,
+	/* 0xCD */	DCM_SID_NOT_SUPPORTED,
+	/* 0xCE */	DCM_SID_NOT_SUPPORTED,
+	/* 0xCF */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD0 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD1 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD2 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD3 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD4 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD5 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD6 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD7 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD8 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xD9 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xDA */	DCM_SID_NOT_SUPPORTED,
+	/* 0xDB */	DCM_SID_NOT_SUPPORTED,
+	/* 0xDC */	DCM_SID_NOT_SUPPORTED,
+	/* 0xDD */	DCM_SID_NOT_SUPPORTED,
+	/* 0xDE */	DCM_SID_NOT_SUPPORTED,
+	/* 0xDF */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE0 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE1 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE2 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE3 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE4 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE5 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE6 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE7 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE8 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xE9 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xEA */	DCM_SID_NOT_SUPPORTED,
+	/* 0xEB */	DCM_SID_NOT_SUPPORTED,
+	/* 0xEC */	DCM_SID_NOT_SUPPORTED,
+	/* 0xED */	DCM_SID_NOT_SUPPORTED,
+	/* 0xEE */	DCM_SID_NOT_SUPPORTED,
+	/* 0xEF */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF0 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF1 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF2 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF3 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF4 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF5 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF6 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF7 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF8 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xF9 */	DCM_SID_NOT_SUPPORTED,
+	/* 0xFA */	DCM_SID_NOT_SUPPORTED,
+	/* 0xFB */	DCM_SID_NOT_SUPPORTED,
+	/* 0xFC */	DCM_SID_NOT_SUPPORTED,
+	/* 0xFD */	DCM_SID_NOT_SUPPORTED,
+	/* 0xFE */	DCM_SID_NOT_SUPPORTED,
+	/* 0xFF */	DCM_SID_NOT_SUPPORTED
+};
+
+/* Session control value of every session, entry n is the session of bit n of DcmDsdSidTabSessionLevelRef */
+const uint8 DcmDspSessionId[DCM_NUM_OF_SESSIONS] =
+{
+	DCM_SESSION_DEFAULT,
+	DCM_SESSION_PROGRAMMING,
+	DCM_SESSION_EXTENDED
+};
+
+/* Request and response buffers of the DSL */
+uint8 DcmDslRxBuffer[DCM_DSL_RX_BUFFER_SIZE];
+uint8 DcmDslTxBuffer[DCM_DSL_TX_BUFFER_SIZE];
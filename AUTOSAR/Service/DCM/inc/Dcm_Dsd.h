@@ -23,7 +23,36 @@
 **	MAY BE CHANGED BY USER : No                          						 **
 **                                                       					     **
 ***********************************************************************************/
+#ifndef DCM_DSD_H
+#define DCM_DSD_H
 
 /***********************************************************************************/
 /*				    			Include Headers			         				   */
-/***********************************************************************************/
\ No newline at end of file
+/***********************************************************************************/
+
+#include "Dcm_Lcfg.h"
+
+/***********************************************************************************/
+/*				    			Macros Definition			       				   */
+/***********************************************************************************/
+
+/* First byte of a negative response, followed by the service ID and the NRC */
+#define DCM_NEGATIVE_RESPONSE_SID			(0x7Fu)
+
+/* Added to the service ID of a request for its positive response */
+#define DCM_POSITIVE_RESPONSE_OFFSET		(0x40u)
+
+/* suppressPosRspMsgIndicationBit of the sub-function byte */
+#define DCM_SUPPRESS_POS_RSP_BIT			(0x80u)
+
+/***********************************************************************************/
+/*				    			Functions Prototype			       				   */
+/***********************************************************************************/
+
+/* The DSD keeps no state between two requests */
+void Dcm_DsD_Init(void);
+
+/* Processes the request in DcmDslRxBuffer and builds its response in DcmDslTxBuffer */
+Dcm_MsgLenType DcmDsdProcessRequest(Dcm_MsgLenType RequestLength);
+
+#endif /* DCM_DSD_H */
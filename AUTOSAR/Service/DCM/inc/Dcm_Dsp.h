@@ -23,7 +23,52 @@
 **	MAY BE CHANGED BY USER : No                          						 **
 **                                                       					     **
 ***********************************************************************************/
+#ifndef DCM_DSP_H
+#define DCM_DSP_H
 
 /***********************************************************************************/
 /*				    			Include Headers			         				   */
-/***********************************************************************************/
\ No newline at end of file
+/***********************************************************************************/
+
+#include "Dcm_Lcfg.h"
+
+/***********************************************************************************/
+/*				    			Macros Definition			       				   */
+/***********************************************************************************/
+
+/* Security levels of DcmDsdSidTabSecurityLevelRef, bit 0 is the locked level */
+#define DCM_SEC_LEVEL_MASK_LOCKED			(0x01u)
+
+/* Server timing in ms reported by the DiagnosticSessionControl response */
+#define DCM_DSP_P2_SERVER_MAX_MS			(50u)
+#define DCM_DSP_P2STAR_SERVER_MAX_MS		(5000u)
+
+/***********************************************************************************/
+/*				    			Functions Prototype			       				   */
+/***********************************************************************************/
+
+/* Starts the DSP in the first configured session with security locked */
+void Dcm_Dsp_Init(void);
+
+/* Bit of the active session in DcmDsdSidTabSessionLevelRef */
+uint8 DcmDspGetSessionMask(void);
+
+/* Bit of the active security level in DcmDsdSidTabSecurityLevelRef */
+uint8 DcmDspGetSecurityMask(void);
+
+/* Processing functions of the services, called by the DSD through DcmDsdService */
+Std_ReturnType Dcm_DspDiagnosticSessionControl
+(
+	Dcm_ExtendedOpStatusType		OpStatus,
+	Dcm_MsgContextType*				pMsgContext,
+	Dcm_NegativeResponseCodeType*	ErrorCode
+);
+
+Std_ReturnType Dcm_DspTesterPresent
+(
+	Dcm_ExtendedOpStatusType		OpStatus,
+	Dcm_MsgContextType*				pMsgContext,
+	Dcm_NegativeResponseCodeType*	ErrorCode
+);
+
+#endif /* DCM_DSP_H */
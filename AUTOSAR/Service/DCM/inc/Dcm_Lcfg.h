@@ -0,0 +1,100 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Dcm_Lcfg.h													 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2021-5-16													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Dcm link time configuration types.							 **
+**                                                                               **
+**	SPECIFICATION(S) : AUTOSAR_SWS_DiagnosticCommunicationManager, AUTR 4.3.1	 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef DCM_LCFG_H
+#define DCM_LCFG_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+#include "Dcm_Types.h"
+#include "Dcm_Cfg.h"
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/* Entry of the SID index table for a service ID which is not supported */
+#define DCM_SID_NOT_SUPPORTED				(0xFFu)
+
+/* Number of entries of the SID index table, one per service ID */
+#define DCM_NUM_OF_SIDS						(256u)
+
+/*****************************************************************/
+/*				        Types Definition       		     	     */
+/*****************************************************************/
+
+/* Type defenition of the processing function of a diagnostic service (DcmDsdSidTabFnc) */
+typedef Std_ReturnType (*Dcm_DsdServiceFctType)
+(
+	Dcm_ExtendedOpStatusType		OpStatus,
+	Dcm_MsgContextType*				pMsgContext,
+	Dcm_NegativeResponseCodeType*	ErrorCode
+);
+
+/* Type defenition of one diagnostic service of the service table, DcmDsdService */
+typedef struct 
+{
+	/* Service ID of the request */
+	uint8					DcmDsdSidTabServiceId;
+	
+	/* The service has a sub-function, its suppressPosRspMsgIndicationBit is evaluated */
+	boolean					DcmDsdSidTabSubfuncAvail;
+	
+	/* Sessions the service is allowed in, bit n set for the session DCM_SESSION_MASK_x of n */
+	uint8					DcmDsdSidTabSessionLevelRef;
+	
+	/* Security levels the service is allowed in, bit 0 for the locked level */
+	uint8					DcmDsdSidTabSecurityLevelRef;
+	
+	/* Shortest and longest accepted request, including the service ID */
+	Dcm_MsgLenType			DcmDsdSidTabMinLength;
+	Dcm_MsgLenType			DcmDsdSidTabMaxLength;
+	
+	/* Processing function of the service */
+	Dcm_DsdServiceFctType	DcmDsdSidTabFnc;
+}Dcm_DsdServiceType;
+
+/*****************************************************************/
+/*				        Configuration Objects      		         */
+/*****************************************************************/
+
+/* Service table sorted by service ID */
+extern const Dcm_DsdServiceType DcmDsdService[DCM_NUM_OF_SERVICES];
+
+/* Index of every service ID in the service table, DCM_SID_NOT_SUPPORTED for a service which is not configured */
+extern const uint8 DcmDsdSidIndex[DCM_NUM_OF_SIDS];
+
+/* Session control value of every session, the first one is active after Dcm_Dsp_Init() */
+extern const uint8 DcmDspSessionId[DCM_NUM_OF_SESSIONS];
+
+/* Request and response buffers of the DSL, sized for the longest configured request and response */
+extern uint8 DcmDslRxBuffer[DCM_DSL_RX_BUFFER_SIZE];
+extern uint8 DcmDslTxBuffer[DCM_DSL_TX_BUFFER_SIZE];
+
+#endif /* DCM_LCFG_H */
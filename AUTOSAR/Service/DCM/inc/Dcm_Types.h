@@ -23,6 +23,11 @@
 **	MAY BE CHANGED BY USER : No                          						 **
 **                                                       					     **
 ***********************************************************************************/
+#ifndef DCM_TYPES_H
+#define DCM_TYPES_H
+
+#include "Std_Types.h"
+#include "ComStack_Types.h"
 
 typedef uint8 Dcm_StatusType;
 #define DCM_E_OK							((Dcm_StatusType) 0x00)
@@ -127,19 +132,16 @@ typedef struct
 	
 	Dcm_IdContextType	idContext;
 	
-	PduIdType    		dcmRxPduId:;
+	PduIdType    		dcmRxPduId;
 }Dcm_MsgContextType;
 
+typedef uint8 Dcm_NegativeResponseCodeType;
+#define DCM_E_SERVICENOTSUPPORTED					((Dcm_NegativeResponseCodeType) 0x11)
+#define DCM_E_SUBFUNCTIONNOTSUPPORTED				((Dcm_NegativeResponseCodeType) 0x12)
+#define DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT	((Dcm_NegativeResponseCodeType) 0x13)
+#define DCM_E_RESPONSETOOLONG						((Dcm_NegativeResponseCodeType) 0x14)
+#define DCM_E_CONDITIONSNOTCORRECT					((Dcm_NegativeResponseCodeType) 0x22)
+#define DCM_E_SECURITYACCESSDENIED					((Dcm_NegativeResponseCodeType) 0x33)
+#define DCM_E_SERVICENOTSUPPORTEDINACTIVESESSION	((Dcm_NegativeResponseCodeType) 0x7F)
 
-
-
-
-
-
-
-
-
-
-
-
-
+#endif /* DCM_TYPES_H */
@@ -26,4 +26,162 @@
 
 /***********************************************************************************/
 /*				    			Include Headers			         				   */
-/***********************************************************************************/
\ No newline at end of file
+/***********************************************************************************/
+
+#include "Dcm_Dsd.h"
+#include "Dcm_Dsp.h"
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+/**********************************************************************************
+**	Service name: Dcm_DsD_Init													 **
+**																				 **
+**	Syntax:	      void Dcm_DsD_Init( void )										 **
+**																				 **
+**  Description : This API														 **
+**				  -Initializes the DSD, which keeps no state between two		 **
+**				   requests														 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): NA															 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: NA															 **
+**																				 **
+***********************************************************************************/
+void Dcm_DsD_Init( void )
+{
+	
+}
+
+/**********************************************************************************
+**	Service name: DcmDsdProcessRequest											 **
+**																				 **
+**	Syntax:	      Dcm_MsgLenType DcmDsdProcessRequest							 **
+**				  (																 **
+**				  	const Dcm_MsgLenType RequestLength							 **
+**				   )															 **
+**																				 **
+**  Description : This API														 **
+**				  -Looks the service ID of the request in DcmDslRxBuffer up		 **
+**				   in DcmDsdSidIndex, one table read for any service ID			 **
+**				  -Checks the service against the active session, the			 **
+**				   active security level and its request length, in this		 **
+**				   order, and answers the first failed check with its NRC		 **
+**				  -Calls the processing function of the service and builds		 **
+**				   the positive or negative response in DcmDslTxBuffer			 **
+**				  -A set suppressPosRspMsgIndicationBit drops the positive		 **
+**				   response, negative responses are always sent					 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): RequestLength - Bytes of the request, service ID included	 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: Bytes of the response in DcmDslTxBuffer, 0 for no response	 **
+**																				 **
+***********************************************************************************/
+Dcm_MsgLenType DcmDsdProcessRequest(const Dcm_MsgLenType RequestLength)
+{
+	const Dcm_DsdServiceType*		Service;
+	Dcm_MsgContextType				MsgContext;
+	Dcm_NegativeResponseCodeType	ErrorCode		= DCM_E_CONDITIONSNOTCORRECT;
+	Std_ReturnType					Result			= E_NOT_OK;
+	Dcm_MsgLenType					ResponseLength	= 0u;
+	uint8							Sid				= DcmDslRxBuffer[0u];
+	uint8							Index;
+	
+	/* An empty request or one longer than the Rx buffer gets no response */
+	if((0u != RequestLength) && (RequestLength <= DCM_DSL_RX_BUFFER_SIZE))
+	{
+		/* Constant time dispatch, whatever the number of services and the service ID */
+		Index = DcmDsdSidIndex[Sid];
+		
+		if(DCM_SID_NOT_SUPPORTED == Index)
+		{
+			ErrorCode = DCM_E_SERVICENOTSUPPORTED;
+		}
+		else
+		{
+			Service = &DcmDsdService[Index];
+			
+			if(0u == (Service->DcmDsdSidTabSessionLevelRef & DcmDspGetSessionMask()))
+			{
+				ErrorCode = DCM_E_SERVICENOTSUPPORTEDINACTIVESESSION;
+			}
+			else if(0u == (Service->DcmDsdSidTabSecurityLevelRef & DcmDspGetSecurityMask()))
+			{
+				ErrorCode = DCM_E_SECURITYACCESSDENIED;
+			}
+			else if((RequestLength < Service->DcmDsdSidTabMinLength) || 
+					(RequestLength > Service->DcmDsdSidTabMaxLength))
+			{
+				ErrorCode = DCM_E_INCORRECTMESSAGELENGTHORINVALIDFORMAT;
+			}
+			else
+			{
+				/* The service sees the request and response without their service ID */
+				MsgContext.reqData							= &DcmDslRxBuffer[1u];
+				MsgContext.reqDataLen						= RequestLength - 1u;
+				MsgContext.resData							= &DcmDslTxBuffer[1u];
+				MsgContext.resDataLen						= 0u;
+				MsgContext.resMaxDataLen					= DCM_DSL_TX_BUFFER_SIZE - 1u;
+				MsgContext.msgAddInfo.reqType				= 0u;
+				MsgContext.msgAddInfo.suppressPosResponse	= 0u;
+				MsgContext.idContext						= Sid;
+				MsgContext.dcmRxPduId						= 0u;
+				
+				/* The sub-function reaches the service without the suppress bit */
+				if((TRUE == Service->DcmDsdSidTabSubfuncAvail) && 
+				   (0u != (MsgContext.reqData[0u] & DCM_SUPPRESS_POS_RSP_BIT)))
+				{
+					MsgContext.msgAddInfo.suppressPosResponse = 1u;
+					MsgContext.reqData[0u] &= (uint8)(~DCM_SUPPRESS_POS_RSP_BIT);
+				}
+				
+				/* A service which fails without an NRC is answered with conditionsNotCorrect */
+				Result = Service->DcmDsdSidTabFnc(DCM_INITIAL, &MsgContext, &ErrorCode);
+			}
+		}
+		
+		if(E_OK != Result)
+		{
+			DcmDslTxBuffer[0u] = DCM_NEGATIVE_RESPONSE_SID;
+			DcmDslTxBuffer[1u] = Sid;
+			DcmDslTxBuffer[2u] = ErrorCode;
+			
+			ResponseLength = 3u;
+		}
+		else if(0u == MsgContext.msgAddInfo.suppressPosResponse)
+		{
+			DcmDslTxBuffer[0u] = (uint8)(Sid + DCM_POSITIVE_RESPONSE_OFFSET);
+			
+			ResponseLength = MsgContext.resDataLen + 1u;
+		}
+		/* (MISRA-C:2004 Rule 14.10 (required)) 
+		All if … else if constructs shall be terminated with an else clause. */
+		else
+		{
+			
+		}
+	}
+	
+	return (ResponseLength);
+}
@@ -24,6 +24,260 @@
 **                                                       					     **
 ***********************************************************************************/
 
+
 /***********************************************************************************/
 /*				    			Include Headers			         				   */
-/***********************************************************************************/
\ No newline at end of file
+/***********************************************************************************/
+
+#include "Dcm_Dsp.h"
+
+/*******************************************************************************/
+/*                      Private Macro Definitions 			                   */
+/*******************************************************************************/
+
+/* Sub-function of TesterPresent, zeroSubFunction */
+#define DCM_DSP_TESTER_PRESENT_ZERO			(0x00u)
+
+/* Bytes of the DiagnosticSessionControl response after its service ID */
+#define DCM_DSP_SESSION_RESPONSE_LENGTH		(5u)
+
+/***********************************************************************************/
+/*				    			Static Variables			       				   */
+/***********************************************************************************/
+
+/* Index of the active session in DcmDspSessionId, bit of the session in DcmDsdSidTabSessionLevelRef */
+static uint8 DcmDspSessionIndex = 0u;
+
+/***********************************************************************************/
+/*				    		Global Function Definitions	         				   */
+/***********************************************************************************/
+
+/**********************************************************************************
+**	Service name: Dcm_Dsp_Init													 **
+**																				 **
+**	Syntax:	      void Dcm_Dsp_Init( void )										 **
+**																				 **
+**  Description : This API														 **
+**				  -Starts the DSP in the first configured session, the			 **
+**				   default session, with security locked						 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): NA															 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: NA															 **
+**																				 **
+***********************************************************************************/
+void Dcm_Dsp_Init( void )
+{
+	DcmDspSessionIndex = 0u;
+}
+
+/**********************************************************************************
+**	Service name: DcmDspGetSessionMask											 **
+**																				 **
+**	Syntax:	      uint8 DcmDspGetSessionMask( void )							 **
+**																				 **
+**  Description : This API														 **
+**				  -Returns the bit of the active session in						 **
+**				   DcmDsdSidTabSessionLevelRef									 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): NA															 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: Bit of the active session										 **
+**																				 **
+***********************************************************************************/
+uint8 DcmDspGetSessionMask( void )
+{
+	return ((uint8)(1u << DcmDspSessionIndex));
+}
+
+/**********************************************************************************
+**	Service name: DcmDspGetSecurityMask											 **
+**																				 **
+**	Syntax:	      uint8 DcmDspGetSecurityMask( void )							 **
+**																				 **
+**  Description : This API														 **
+**				  -Returns the bit of the active security level in				 **
+**				   DcmDsdSidTabSecurityLevelRef, always the locked level		 **
+**				   as SecurityAccess is not supported							 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Reentrant														 **
+**																				 **
+**	Parameters (in): NA															 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   NA														 **
+**																				 **
+**	Return value: Bit of the active security level								 **
+**																				 **
+***********************************************************************************/
+uint8 DcmDspGetSecurityMask( void )
+{
+	return (DCM_SEC_LEVEL_MASK_LOCKED);
+}
+
+/**********************************************************************************
+**	Service name: Dcm_DspDiagnosticSessionControl								 **
+**																				 **
+**	Syntax:	      Std_ReturnType Dcm_DspDiagnosticSessionControl				 **
+**				  (																 **
+**				  	Dcm_ExtendedOpStatusType OpStatus,							 **
+**				  	Dcm_MsgContextType* pMsgContext,							 **
+**				  	Dcm_NegativeResponseCodeType* ErrorCode						 **
+**				   )															 **
+**																				 **
+**  Description : This API														 **
+**				  -Processes DiagnosticSessionControl (0x10)					 **
+**				  -Changes to the configured session of the sub-function		 **
+**				   and answers it with the P2 and P2* server timing				 **
+**				  -Answers a session which is not configured with				 **
+**				   subFunctionNotSupported										 **
+**				  -Answers responseTooLong if the response buffer cannot		 **
+**				   take the session and the timing								 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): OpStatus    - DCM_INITIAL, the services are synchronous	 **
+**					 pMsgContext - Request and response of the service			 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   ErrorCode - NRC of a negative response					 **
+**																				 **
+**	Return value: E_OK for a positive response, E_NOT_OK for a negative one		 **
+**																				 **
+***********************************************************************************/
+Std_ReturnType Dcm_DspDiagnosticSessionControl
+(
+	Dcm_ExtendedOpStatusType		OpStatus,
+	Dcm_MsgContextType*				pMsgContext,
+	Dcm_NegativeResponseCodeType*	ErrorCode
+)
+{
+	Std_ReturnType RetVal	= E_NOT_OK;
+	uint8		   Session	= pMsgContext->reqData[0u];
+	uint8		   Found	= DCM_NUM_OF_SESSIONS;
+	uint8		   Index;
+	
+	(void)OpStatus;
+	
+	for(Index = 0u; Index < DCM_NUM_OF_SESSIONS; Index++)
+	{
+		if(Session == DcmDspSessionId[Index])
+		{
+			Found = Index;
+		}
+	}
+	
+	if(DCM_NUM_OF_SESSIONS == Found)
+	{
+		*ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+	}
+	/* Checked before the session changes, a request which cannot be answered changes nothing */
+	else if(pMsgContext->resMaxDataLen < DCM_DSP_SESSION_RESPONSE_LENGTH)
+	{
+		*ErrorCode = DCM_E_RESPONSETOOLONG;
+	}
+	else
+	{
+		DcmDspSessionIndex = Found;
+		
+		/* Session echo, P2 in ms and P2* in units of 10 ms, most significant byte first */
+		pMsgContext->resData[0u] = Session;
+		pMsgContext->resData[1u] = (uint8)(DCM_DSP_P2_SERVER_MAX_MS >> 8u);
+		pMsgContext->resData[2u] = (uint8)(DCM_DSP_P2_SERVER_MAX_MS);
+		pMsgContext->resData[3u] = (uint8)((DCM_DSP_P2STAR_SERVER_MAX_MS / 10u) >> 8u);
+		pMsgContext->resData[4u] = (uint8)(DCM_DSP_P2STAR_SERVER_MAX_MS / 10u);
+		
+		pMsgContext->resDataLen = DCM_DSP_SESSION_RESPONSE_LENGTH;
+		
+		RetVal = E_OK;
+	}
+	
+	return (RetVal);
+}
+
+/**********************************************************************************
+**	Service name: Dcm_DspTesterPresent											 **
+**																				 **
+**	Syntax:	      Std_ReturnType Dcm_DspTesterPresent							 **
+**				  (																 **
+**				  	Dcm_ExtendedOpStatusType OpStatus,							 **
+**				  	Dcm_MsgContextType* pMsgContext,							 **
+**				  	Dcm_NegativeResponseCodeType* ErrorCode						 **
+**				   )															 **
+**																				 **
+**  Description : This API														 **
+**				  -Processes TesterPresent (0x3E), which keeps the active		 **
+**				   session														 **
+**				  -Only the zeroSubFunction is supported						 **
+**																				 **
+**	Service ID:   NA															 **
+**																				 **
+**	Sync/Async:	  Synchronous													 **
+**																				 **
+**  Reentrancy:   Non Reentrant													 **
+**																				 **
+**	Parameters (in): OpStatus    - DCM_INITIAL, the services are synchronous	 **
+**					 pMsgContext - Request and response of the service			 **
+**																				 **
+**	Parameters (inout): NA														 **
+**																				 **
+**	Parameters (out):   ErrorCode - NRC of a negative response					 **
+**																				 **
+**	Return value: E_OK for a positive response, E_NOT_OK for a negative one		 **
+**																				 **
+***********************************************************************************/
+Std_ReturnType Dcm_DspTesterPresent
+(
+	Dcm_ExtendedOpStatusType		OpStatus,
+	Dcm_MsgContextType*				pMsgContext,
+	Dcm_NegativeResponseCodeType*	ErrorCode
+)
+{
+	Std_ReturnType RetVal = E_NOT_OK;
+	
+	(void)OpStatus;
+	
+	if(DCM_DSP_TESTER_PRESENT_ZERO == pMsgContext->reqData[0u])
+	{
+		pMsgContext->resData[0u] = DCM_DSP_TESTER_PRESENT_ZERO;
+		pMsgContext->resDataLen	 = 1u;
+		
+		RetVal = E_OK;
+	}
+	else
+	{
+		*ErrorCode = DCM_E_SUBFUNCTIONNOTSUPPORTED;
+	}
+	
+	return (RetVal);
+}
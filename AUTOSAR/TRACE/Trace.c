@@ -0,0 +1,84 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Trace.c														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Register write trace ring.									 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+#include "Trace.h"
+
+#ifdef SIM_REGISTER_ACCESS
+#include <stdio.h>
+#endif /* SIM_REGISTER_ACCESS */
+
+/*****************************************************************/
+/*				        Global Variables        		         */
+/*****************************************************************/
+
+/* Header valid from start-up, so a dump taken before Trace_Reset can be converted */
+Trace_BufferType Trace_Buffer =
+{
+	TRACE_MAGIC,
+	TRACE_VERSION,
+	TRACE_BUFFER_SIZE,
+	TRACE_CLOCK_HZ,
+	0u,
+	{ { 0u, 0u, 0u } }
+};
+
+/*****************************************************************/
+/*				        Functions Definition       		         */
+/*****************************************************************/
+
+void Trace_Reset(void)
+{
+	Trace_Buffer.Magic	 = TRACE_MAGIC;
+	Trace_Buffer.Version = TRACE_VERSION;
+	Trace_Buffer.Size	 = TRACE_BUFFER_SIZE;
+	Trace_Buffer.ClockHz = TRACE_CLOCK_HZ;
+	Trace_Buffer.Index	 = 0u;
+}
+
+#ifdef SIM_REGISTER_ACCESS
+
+Std_ReturnType Trace_Save(const char* FileName)
+{
+	Std_ReturnType RetVal = E_NOT_OK;
+	FILE* File = fopen(FileName, "wb");
+	
+	if(NULL_PTR != File)
+	{
+		if(1u == fwrite((const void*)&Trace_Buffer, sizeof(Trace_Buffer), 1u, File))
+		{
+			RetVal = E_OK;
+		}
+		
+		(void)fclose(File);
+	}
+	
+	return (RetVal);
+}
+
+#endif /* SIM_REGISTER_ACCESS */
@@ -0,0 +1,185 @@
+/**********************************************************************************
+***********************************************************************************
+**														  						 **		
+**	FILENAME	:	Trace.h														 **
+**	                                                      						 **
+**	VERSION		: 	1.0.0														 **
+**                                                        						 **
+**	DATE		:	2026-10-18													 **
+**                                                        						 **
+**	PLATFORM	:	TIVA C														 **
+**																				 **
+**  VARIANT  	: 	NA                                                           **
+**                                                        						 **
+**	AUTHOR		:  	MohamedSayed												 **
+**                                                        						 **
+**	VENDOR		: 	NA				                     						 **
+**                                                        						 **
+**	                                                      						 **
+**	DESCRIPTION : Register write trace ring.									 **
+**                                                                               **
+**	SPECIFICATION(S) : NA														 **
+**                                                       						 **
+**	MAY BE CHANGED BY USER : No                            						 **
+**                                                       					     **
+***********************************************************************************/
+#ifndef TRACE_H
+#define TRACE_H
+
+/*****************************************************************/
+/*				    	Include Headers					         */
+/*****************************************************************/
+#include <stdint.h>
+#include "Std_Types.h"
+
+#ifdef SIM_REGISTER_ACCESS
+#include "Sim.h"
+#endif /* SIM_REGISTER_ACCESS */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*****************************************************************/
+/*				        Macros Definition       		         */
+/*****************************************************************/
+
+/* Records kept in the ring, the oldest are overwritten, shall be a power of two */
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE		(1024u)
+#endif /* TRACE_BUFFER_SIZE */
+
+/* Frequency of the timestamp counter, used by the converter to scale the time */
+#ifndef TRACE_CLOCK_HZ
+#define TRACE_CLOCK_HZ			(80000000u)
+#endif /* TRACE_CLOCK_HZ */
+
+#if ((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1u)) != 0u)
+#error "TRACE_BUFFER_SIZE shall be a power of two."
+#endif /* TRACE_BUFFER_SIZE */
+
+/* Identification of a trace dump ("RTRC") and of its layout, version 2 keeps the whole written value */
+#define TRACE_MAGIC				(0x43525452u)
+#define TRACE_VERSION			(2u)
+
+/* Free running timestamp, the virtual clock on the host and DWT_CYCCNT on target */
+#ifdef SIM_REGISTER_ACCESS
+#define TRACE_TIMESTAMP()		((uint32_t)Sim_GetTime())
+#else
+#define TRACE_TIMESTAMP()		(*((volatile uint32_t *)0xE0001004u))
+#endif /* SIM_REGISTER_ACCESS */
+
+/* Claims the next record, interrupt safe (LDREX / STREX on the Cortex-M4) */
+#if defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+#define TRACE_CLAIM()			TraceClaimExclusive()
+#elif defined(__GNUC__) || defined(__clang__)
+#define TRACE_CLAIM()			__atomic_fetch_add(&Trace_Buffer.Index, 1u, __ATOMIC_RELAXED)
+#else
+#define TRACE_CLAIM()			(Trace_Buffer.Index++)
+#endif
+
+/*****************************************************************/
+/*				        Types Definition        		         */
+/*****************************************************************/
+
+/* 
+   The trace is dumped as a raw image of Trace_Buffer (by the debugger on target, 
+   Trace_Save on the host), fixed width types keep the layout the same on both.
+   
+   Only the writes of the register macros (SET_PORT, SET_BIT, ...) are recorded.
+   Registers set up through the TivaWare driver library (the uDMA and timer of
+   the pattern engine) and the samples the uDMA moves to GPIODATA on its own
+   are not in the trace.
+*/
+
+/* Type definition of one recorded register write (12 bytes) */
+typedef struct 
+{
+	/* TRACE_TIMESTAMP() of the write */
+	uint32_t	Timestamp;
+	
+	/* Written register and the whole 32-bit value */
+	uint32_t	Address;
+	uint32_t	Value;
+}Trace_RecordType;
+
+/* Type definition of the trace ring and its header */
+typedef struct 
+{
+	/* TRACE_MAGIC and TRACE_VERSION */
+	uint32_t			Magic;
+	uint32_t			Version;
+	
+	/* TRACE_BUFFER_SIZE and TRACE_CLOCK_HZ of the build */
+	uint32_t			Size;
+	uint32_t			ClockHz;
+	
+	/* Free running number of records written, the next one goes to Index % Size */
+	volatile uint32_t	Index;
+	
+	/* Recorded writes */
+	Trace_RecordType	Records[TRACE_BUFFER_SIZE];
+}Trace_BufferType;
+
+/*****************************************************************/
+/*				        Global Variables        		         */
+/*****************************************************************/
+
+/* The trace ring, dump sizeof(Trace_Buffer) bytes from its address to get a trace file */
+extern Trace_BufferType Trace_Buffer;
+
+/*****************************************************************/
+/*				        Functions Prototype        		         */
+/*****************************************************************/
+
+/* Drops all records */
+extern void Trace_Reset(void);
+
+#ifdef SIM_REGISTER_ACCESS
+/* Writes the trace ring to a file, returns E_NOT_OK if the file can't be written */
+extern Std_ReturnType Trace_Save(const char* FileName);
+#endif /* SIM_REGISTER_ACCESS */
+
+#if defined(__ARMCC_VERSION) && (__ARMCC_VERSION < 6000000)
+/* Atomic increment of the record index with the exclusive access intrinsics */
+LOCAL_INLINE uint32_t TraceClaimExclusive(void)
+{
+	uint32_t Index;
+	
+	do
+	{
+		Index = __ldrex(&Trace_Buffer.Index);
+	}
+	while(0u != __strex((Index + 1u), &Trace_Buffer.Index));
+	
+	return (Index);
+}
+#endif /* __ARMCC_VERSION */
+
+/* Records one register write, a claim, a timestamp load and three stores */
+LOCAL_INLINE void Trace_Record(const uint32 Address, const uint32 Value)
+{
+	Trace_RecordType* Record = &Trace_Buffer.Records[TRACE_CLAIM() & (TRACE_BUFFER_SIZE - 1u)];
+	
+	Record->Timestamp = TRACE_TIMESTAMP();
+	Record->Address	  = (uint32_t)Address;
+	Record->Value	  = (uint32_t)Value;
+}
+
+/* Writes a register and records the write, used by the register macros if REGISTER_TRACE is defined */
+LOCAL_INLINE void Trace_WriteRegister(const uint32 Address, const uint32 Value)
+{
+#ifdef SIM_REGISTER_ACCESS
+	Sim_WriteRegister(Address, Value);
+#else
+	*((volatile uint32_t *)Address) = (uint32_t)Value;
+#endif /* SIM_REGISTER_ACCESS */
+	
+	Trace_Record(Address, Value);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* TRACE_H */
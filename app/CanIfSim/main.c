@@ -0,0 +1,991 @@
+/*
+	Host benchmark of CanIf_Transmit() and CanIf_RxIndication() against a
+	stub CAN driver.
+
+	Can_Write() below only counts the requests and keeps the last L-PDU, the
+	numbers are the cost of the CanIf path (DET checks, PDU to HTH mapping,
+	padding) on the host, not of a CAN controller. Det_ReportError() is
+	also stubbed here, the runs must not report any development error.
+	Can_SetControllerMode() indicates the requested mode before returning,
+	CanIf_Init() leaves the controllers stopped and every run starts CAN0.
+
+	With CANIF_PUBLIC_TX_BUFFERING on, CanIf_Transmit() masks the interrupts
+	around Can_Write(). The simulated IntMasterEnable() scans every vector
+	for pending requests, which dominates the host time per call. On the
+	target the pair is two CPSID / CPSIE instructions.
+
+	With CANIF_RX_DEFERRED_PROCESSING on, CanIf_RxIndication() only queues
+	the frame and the upper layer is notified by CanIf_MainFunctionRx(), the
+	Rx runs time both halves. With CANIF_RX_ISR_MEASUREMENT on, the timestamp
+	register is read through Sim_ReadRegister() below, which returns the host
+	clock in ns instead of DWT_CYCCNT cycles.
+
+	Build and run from this folder:
+
+	gcc -O2 -DSIM_REGISTER_ACCESS                                          \
+		-I../../AUTOSAR/SIM -I../../AUTOSAR/BSW/GeneralTypes               \
+		-I../../AUTOSAR/BSW/ECUAL/CanIf/inc -I../../AUTOSAR/BSW/ECUAL/CanIf/gen \
+		-I../../AUTOSAR/BSW/ECUAL/CanIf/integration -I../../AUTOSAR/STUB   \
+		main.c ../../AUTOSAR/BSW/ECUAL/CanIf/src/CanIf.c                   \
+		../../AUTOSAR/BSW/ECUAL/CanIf/gen/CanIf_Cfg.c ../../AUTOSAR/SIM/Sim_Int.c \
+		-o CanIfSim && ./CanIfSim
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/time.h>
+#include "CanIf.h"
+#include "Can.h"
+#include "CanIf_Cbk.h"
+#include "PduR_CanIf.h"
+
+#define BENCH_LOOPS		(2000000u)
+
+/* Rx L-PDUs of the generated table in BenchRx500() */
+#define BENCH_RX_PDUS	(500u)
+
+/* Development errors reported by CanIf */
+static uint32 DetErrorCount;
+
+/* Requests seen by the stub driver and the last L-PDU it was given */
+static uint32 CanWriteCount;
+static Can_HwHandleType LastHth;
+static Can_PduType LastPdu;
+static uint8 LastSdu[8];
+
+/* All hardware objects are busy while set, Can_Write() returns CAN_BUSY */
+static boolean CanMailboxesBusy;
+
+/* CAN IDs accepted by the stub driver, in order */
+static Can_IdType SentIds[8];
+static uint32 SentCount;
+
+Can_ReturnType Can_Write(Can_HwHandleType Hth, const Can_PduType* PduInfo)
+{
+	CanWriteCount++;
+	
+	if(CanMailboxesBusy == TRUE)
+	{
+		return (CAN_BUSY);
+	}
+	
+	SentIds[SentCount % 8u] = PduInfo->id;
+	SentCount++;
+	
+	LastHth = Hth;
+	LastPdu = *PduInfo;
+	
+	/* The driver copies the L-SDU into the mailbox before returning */
+	memcpy(LastSdu, PduInfo->sdu, PduInfo->length);
+	
+	return (CAN_OK);
+}
+
+/* Start requests seen by the stub driver, it indicates the new mode before returning */
+static uint32 CanStartCount;
+
+Can_ReturnType Can_SetControllerMode(uint8 Controller, Can_StateTransitionType Transition)
+{
+	Can_ControllerStateType Mode = CAN_CS_STOPPED;
+	
+	if(Transition == CAN_T_START)
+	{
+		CanStartCount++;
+		Mode = CAN_CS_STARTED;
+	}
+	else if(Transition == CAN_T_SLEEP)
+	{
+		Mode = CAN_CS_SLEEP;
+	}
+	
+	CanIf_ControllerModeIndication(Controller, Mode);
+	
+	return (CAN_OK);
+}
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+	(void)ModuleId;
+	(void)InstanceId;
+	(void)ApiId;
+	(void)ErrorId;
+	
+	DetErrorCount++;
+	
+	return (E_OK);
+}
+
+/* Rx indications seen by the upper layer and the last indicated L-PDU */
+static uint32 RxIndicationCount;
+static PduIdType LastRxPduId;
+
+void PduR_CanIfRxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr)
+{
+	(void)PduInfoPtr;
+	
+	RxIndicationCount++;
+	LastRxPduId = RxPduId;
+}
+
+void PduR_CanIfTxConfirmation(PduIdType TxPduId, Std_ReturnType result)
+{
+	(void)TxPduId;
+	(void)result;
+}
+
+/* CanIf_Init() leaves the controllers stopped, the runs send on CAN0 */
+static void InitStarted(void)
+{
+	CanIf_Init(&CanIf_Config);
+	
+	(void)CanIf_SetControllerMode(CanIfConf_CanIfCtrlCfg_CAN0, CAN_CS_STARTED);
+}
+
+static double NowNs(void)
+{
+	struct timespec Ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	
+	return ((double)Ts.tv_sec * 1e9) + (double)Ts.tv_nsec;
+}
+
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+uint32 Sim_ReadRegister(uint32 Address)
+{
+	(void)Address;
+	
+	return ((uint32)NowNs());
+}
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+
+static void Bench(const char* Name, PduIdType TxPduId, PduLengthType SduLength)
+{
+	static uint8 Sdu[16] = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u };
+	PduInfoType PduInfo;
+	uint32 Loop;
+	uint32 Failed = 0u;
+	double Start;
+	double Ns;
+	
+	PduInfo.SduDataPtr = Sdu;
+	PduInfo.MetaDataPtr = NULL_PTR;
+	PduInfo.SduLength = SduLength;
+	
+	CanWriteCount = 0u;
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		if(E_OK != CanIf_Transmit(TxPduId, &PduInfo))
+		{
+			Failed++;
+		}
+	}
+	
+	Ns = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	printf("%-34s %6.1f ns/call %7.2f Mcalls/s  hth %u id 0x%03X dlc %u  last byte 0x%02X%s\n",
+		   Name, Ns, 1e3 / Ns, (unsigned)LastHth, (unsigned)LastPdu.id, (unsigned)LastPdu.length,
+		   (unsigned)LastSdu[LastPdu.length - 1u],
+		   ((Failed != 0u) || (CanWriteCount != BENCH_LOOPS)) ? "  FAILED" : "");
+}
+
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+/*
+	Fills the Tx buffer of HTH_CONTROL while the mailboxes are busy, raises the
+	buffered dynamic L-PDU above the others and drains the buffer through
+	CanIf_TxConfirmation(). The frames have to leave in CAN ID order.
+*/
+static void PriorityOrder(void)
+{
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	Std_ReturnType Full;
+	uint32 Index;
+	
+	SentCount = 0u;
+	CanMailboxesBusy = TRUE;
+	
+	CanIf_SetDynamicTxId(CanIfConf_CanIfTxPduCfg_NODE_STATUS, 0x310u);
+	
+	(void)CanIf_Transmit(CanIfConf_CanIfTxPduCfg_NODE_STATUS, &PduInfo);
+	PduInfo.SduLength = 4u;
+	(void)CanIf_Transmit(CanIfConf_CanIfTxPduCfg_BRAKE_CMD,   &PduInfo);
+	PduInfo.SduLength = 8u;
+	(void)CanIf_Transmit(CanIfConf_CanIfTxPduCfg_ENGINE_CMD,  &PduInfo);
+	
+	/* The buffer of HTH_CONTROL holds 3 L-PDUs, a repeated request only refreshes the data */
+	Full = CanIf_Transmit(CanIfConf_CanIfTxPduCfg_ENGINE_CMD, &PduInfo);
+	
+	/* The buffered NODE_STATUS becomes the highest priority frame */
+	CanIf_SetDynamicTxId(CanIfConf_CanIfTxPduCfg_NODE_STATUS, 0x050u);
+	
+	CanMailboxesBusy = FALSE;
+	
+	for(Index = 0u; Index < 4u; Index++)
+	{
+		CanIf_TxConfirmation(CanIfConf_CanIfTxPduCfg_ENGINE_CMD);
+	}
+	
+	printf("buffered frames sent in order:");
+	for(Index = 0u; Index < SentCount; Index++)
+	{
+		printf(" 0x%03X", (unsigned)SentIds[Index]);
+	}
+	printf("  %s\n", ((Full == E_OK) && (SentCount == 3u) && (SentIds[0] == 0x050u) &&
+						(SentIds[1] == 0x100u) && (SentIds[2] == 0x120u)) ? "PASS" : "FAIL");
+}
+
+/* Cost of a request which finds the mailboxes busy plus the buffered send from the Tx confirmation */
+static void BenchBuffered(void)
+{
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	PduIdType Pdus[3] = { CanIfConf_CanIfTxPduCfg_NODE_STATUS, CanIfConf_CanIfTxPduCfg_BRAKE_CMD,
+						  CanIfConf_CanIfTxPduCfg_ENGINE_CMD };
+	uint32 Loop;
+	uint32 Index;
+	double Start;
+	double Ns;
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < (BENCH_LOOPS / 3u); Loop++)
+	{
+		CanMailboxesBusy = TRUE;
+		
+		for(Index = 0u; Index < 3u; Index++)
+		{
+			PduInfo.SduLength = (Index == 1u) ? 4u : 8u;
+			(void)CanIf_Transmit(Pdus[Index], &PduInfo);
+		}
+		
+		CanMailboxesBusy = FALSE;
+		
+		for(Index = 0u; Index < 3u; Index++)
+		{
+			CanIf_TxConfirmation(CanIfConf_CanIfTxPduCfg_ENGINE_CMD);
+		}
+	}
+	
+	Ns = (NowNs() - Start) / (double)((BENCH_LOOPS / 3u) * 3u);
+	
+	printf("%-34s %6.1f ns/frame (busy Can_Write, buffer insert, confirmation, buffered send)\n",
+		   "HTH_CONTROL buffered", Ns);
+}
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+
+/* Received frames of the generated configuration and the Rx L-PDU they have to reach */
+static void RxLookup(void)
+{
+	static const struct
+	{
+		Can_IdType CanId;
+		Can_HwHandleType Hoh;
+		PduIdType RxPduId;
+	}Frames[] =
+	{
+		{ 0x200u, 0u, CanIfConf_CanIfRxPduCfg_ENGINE_STATUS },
+		{ 0x210u, 0u, CanIfConf_CanIfRxPduCfg_WHEEL_SPEED },
+		{ 0x400u, 0u, CanIfConf_CanIfRxPduCfg_BODY_NODES },
+		{ 0x40Fu, 0u, CanIfConf_CanIfRxPduCfg_BODY_NODES },
+		{ (0x18FEF100u | CAN_ID_TYPE_EXTENDED), 0u, CanIfConf_CanIfRxPduCfg_VEHICLE_CFG },
+		{ (0x18FEF1A5u | CAN_ID_TYPE_EXTENDED | CAN_ID_TYPE_FD), 0u, CanIfConf_CanIfRxPduCfg_CRUISE_CTRL_ANY },
+		{ 0x7DFu, 1u, CanIfConf_CanIfRxPduCfg_DIAG_REQ_FUNC },
+		{ 0x7E0u, 1u, CanIfConf_CanIfRxPduCfg_DIAG_REQ_PHYS },
+		
+		/* Not configured, dropped by the software filter */
+		{ 0x410u, 0u, 0xFFFFu },
+		{ 0x200u, 1u, 0xFFFFu },
+		{ (0x200u | CAN_ID_TYPE_EXTENDED), 0u, 0xFFFFu },
+		{ (0x18FEF200u | CAN_ID_TYPE_EXTENDED), 0u, 0xFFFFu }
+	};
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	Can_HwType Mailbox;
+	uint32 Index;
+	uint32 Failed = 0u;
+	uint32 Count;
+	
+	for(Index = 0u; Index < (sizeof(Frames) / sizeof(Frames[0])); Index++)
+	{
+		Mailbox.CanId = Frames[Index].CanId;
+		Mailbox.Hoh = Frames[Index].Hoh;
+		Mailbox.ControllerId = CanIfConf_CanIfCtrlCfg_CAN0;
+		
+		Count = RxIndicationCount;
+		LastRxPduId = 0xFFFFu;
+		
+		CanIf_RxIndication(&Mailbox, &PduInfo);
+		
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+		CanIf_MainFunctionRx();
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+		
+		/* WHEEL_SPEED has no upper layer, it is only read through CanIf */
+		if((Frames[Index].RxPduId != CanIfConf_CanIfRxPduCfg_WHEEL_SPEED) && (LastRxPduId != Frames[Index].RxPduId))
+		{
+			Failed++;
+		}
+		if((Frames[Index].RxPduId == CanIfConf_CanIfRxPduCfg_WHEEL_SPEED) && (RxIndicationCount != Count))
+		{
+			Failed++;
+		}
+	}
+	
+	printf("Rx CAN ID lookup, ids, ranges and masks  %s\n", (Failed == 0u) ? "PASS" : "FAIL");
+}
+
+/*
+	Resolves frames against a table of BENCH_RX_PDUS L-PDUs on one HRH, built here
+	the way the generator would emit it. Half of the L-PDUs are standard CAN IDs,
+	half extended, every fourth frame is not configured.
+*/
+static void BenchRx500(void)
+{
+	static CanIfRxPduCfgType RxPduCfg[BENCH_RX_PDUS];
+	static CanIfRxIdEntryType RxIdCfg[BENCH_RX_PDUS];
+	static CanIfHrhCfgType HrhCfg[1];
+	static uint16 HohToHrh[CANIF_NUM_OF_HOHS];
+	static CanIfInitCfgType InitCfg;
+	static CanIf_ConfigType Config;
+	static Can_IdType FrameIds[1024];
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	Can_HwType Mailbox;
+	uint32 Index;
+	uint32 Loop;
+	uint32 Steps;
+	double Start;
+	double Ns;
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+	uint32 Batch;
+	double IsrNs = 0.0;
+	double Mid;
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	
+	for(Index = 0u; Index < BENCH_RX_PDUS; Index++)
+	{
+		/* Standard IDs 0x000, 0x004 .. then extended IDs 0x18F00000, 0x18F00100 .. */
+		RxIdCfg[Index].CanIdLower = (Index < (BENCH_RX_PDUS / 2u)) ? (Can_IdType)(Index * 4u) :
+									(Can_IdType)(CAN_ID_TYPE_EXTENDED | (0x18F00000u + ((Index - (BENCH_RX_PDUS / 2u)) << 8u)));
+		RxIdCfg[Index].CanIdUpper = RxIdCfg[Index].CanIdLower;
+		RxIdCfg[Index].RxPduId = (PduIdType)Index;
+		
+		RxPduCfg[Index].CanIfRxPduCanId = RxIdCfg[Index].CanIdLower;
+		RxPduCfg[Index].CanIfRxPduUlId = (PduIdType)Index;
+		RxPduCfg[Index].CanIfRxPduHrhIdRef = 0u;
+		RxPduCfg[Index].CanIfRxPduDlc = 8u;
+		RxPduCfg[Index].CanIfRxPduReadNotifyStatus = FALSE;
+		RxPduCfg[Index].CanIfRxPduReadData = FALSE;
+		RxPduCfg[Index].CanIfRxPduDataOffset = 0u;
+		RxPduCfg[Index].CanIfRxPduUserRxIndicationUL = PduR_CanIfRxIndication;
+	}
+	
+	HrhCfg[0].CanIfHrhIdSymRef = 0u;
+	HrhCfg[0].CanIfHrhCanCtrlIdRef = CanIfConf_CanIfCtrlCfg_CAN0;
+	HrhCfg[0].CanIfHrhRxIdFirst = 0u;
+	HrhCfg[0].CanIfHrhRxIdCount = BENCH_RX_PDUS;
+	
+	for(Index = 0u; Index < CANIF_NUM_OF_HOHS; Index++)
+	{
+		HohToHrh[Index] = CANIF_INVALID_HRH;
+	}
+	HohToHrh[0] = 0u;
+	
+	InitCfg = *CanIf_Config.CanIfInitCfgObj;
+	InitCfg.CanIfRxPduCfgObj = RxPduCfg;
+	InitCfg.CanIfRxIdObj = RxIdCfg;
+	InitCfg.CanIfHrhCfgObj = HrhCfg;
+	InitCfg.CanIfHohToHrh = HohToHrh;
+	Config.CanIfInitCfgObj = &InitCfg;
+	
+	CanIf_Init(&Config);
+	
+	/* Pseudo random frames, three of four hit an L-PDU */
+	for(Index = 0u; Index < 1024u; Index++)
+	{
+		Loop = (Index * 2654435761u) % BENCH_RX_PDUS;
+		FrameIds[Index] = RxIdCfg[Loop].CanIdLower + (((Index % 4u) == 3u) ? 1u : 0u);
+	}
+	
+	Mailbox.Hoh = 0u;
+	Mailbox.ControllerId = CanIfConf_CanIfCtrlCfg_CAN0;
+	
+	RxIndicationCount = 0u;
+	
+	Start = NowNs();
+	
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+	/* A burst fills the queue, the main function drains it in budget sized steps */
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop += CANIF_RX_QUEUE_SIZE)
+	{
+		Mid = NowNs();
+		
+		for(Batch = 0u; Batch < CANIF_RX_QUEUE_SIZE; Batch++)
+		{
+			Mailbox.CanId = FrameIds[(Loop + Batch) % 1024u];
+			
+			CanIf_RxIndication(&Mailbox, &PduInfo);
+		}
+		
+		IsrNs += NowNs() - Mid;
+		
+		for(Batch = 0u; Batch < CANIF_RX_QUEUE_SIZE; Batch += CANIF_RX_MAIN_FUNCTION_BUDGET)
+		{
+			CanIf_MainFunctionRx();
+		}
+	}
+	
+	IsrNs /= (double)BENCH_LOOPS;
+#else
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		Mailbox.CanId = FrameIds[Loop % 1024u];
+		
+		CanIf_RxIndication(&Mailbox, &PduInfo);
+	}
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	
+	Ns = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	/* Binary search steps over BENCH_RX_PDUS entries, ceil(log2(n + 1)) */
+	for(Steps = 0u; (1u << Steps) < (BENCH_RX_PDUS + 1u); Steps++)
+	{
+	}
+	
+	printf("%-34s %6.1f ns/frame %6.2f Mframes/s  %u search steps worst case  %s\n",
+		   "CanIf_RxIndication, 500 L-PDUs", Ns, 1e3 / Ns, (unsigned)Steps,
+		   (RxIndicationCount == ((BENCH_LOOPS / 4u) * 3u)) ? "" : "  FAILED");
+	
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+	printf("%-34s %6.1f ns/frame in CanIf_RxIndication, %.1f ns/frame in CanIf_MainFunctionRx\n",
+		   "  deferred", IsrNs, Ns - IsrNs);
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	
+#if (CANIF_RX_ISR_MEASUREMENT == STD_ON)
+	{
+		CanIf_RxStatisticsType Statistics;
+		
+		CanIf_GetRxStatistics(&Statistics);
+		
+		printf("%-34s %6u ns max, measured inside CanIf_RxIndication\n",
+			   "  CANIF_RX_ISR_MEASUREMENT", (unsigned)Statistics.IsrTimeMax);
+	}
+#endif /* CANIF_RX_ISR_MEASUREMENT */
+	
+	InitStarted();
+}
+
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+/* Frames reach the upper layer only from CanIf_MainFunctionRx(), in order and within the budget */
+static void RxDeferred(void)
+{
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	CanIf_RxStatisticsType Statistics;
+	Can_HwType Mailbox;
+	uint32 Index;
+	uint32 Failed = 0u;
+	
+	InitStarted();
+	
+	Mailbox.Hoh = 0u;
+	Mailbox.ControllerId = CanIfConf_CanIfCtrlCfg_CAN0;
+	
+	RxIndicationCount = 0u;
+	
+	/* Two frames more than the queue holds, the last two are lost */
+	for(Index = 0u; Index < (CANIF_RX_QUEUE_SIZE + 2u); Index++)
+	{
+		Mailbox.CanId = ((Index % 2u) == 0u) ? 0x200u : 0x400u;
+		
+		CanIf_RxIndication(&Mailbox, &PduInfo);
+	}
+	
+	if(RxIndicationCount != 0u)
+	{
+		Failed++;
+	}
+	
+	CanIf_MainFunctionRx();
+	
+	if((RxIndicationCount != CANIF_RX_MAIN_FUNCTION_BUDGET) || (LastRxPduId != CanIfConf_CanIfRxPduCfg_BODY_NODES))
+	{
+		Failed++;
+	}
+	
+	for(Index = 0u; Index < CANIF_RX_QUEUE_SIZE; Index++)
+	{
+		CanIf_MainFunctionRx();
+	}
+	
+	CanIf_GetRxStatistics(&Statistics);
+	
+	if((RxIndicationCount != CANIF_RX_QUEUE_SIZE) || (Statistics.QueueOverflows != 2u) ||
+	   (Statistics.QueueHighWatermark != CANIF_RX_QUEUE_SIZE))
+	{
+		Failed++;
+	}
+	
+	printf("Rx deferred to CanIf_MainFunctionRx, budget and overflow  %s\n", (Failed == 0u) ? "PASS" : "FAIL");
+	
+	InitStarted();
+}
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+
+#if ((CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON) && (CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON))
+/* Notification status bits are set by the callbacks and cleared by the first read only */
+static void NotifStatus(void)
+{
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	Can_HwType Mailbox = { 0x210u, 0u, CanIfConf_CanIfCtrlCfg_CAN0 };
+	uint32 Failed = 0u;
+	uint32 Loop;
+	uint32 Bits = 0u;
+	double Start;
+	double SingleNs;
+	double GroupNs;
+	
+	InitStarted();
+	
+	CanIf_TxConfirmation(CanIfConf_CanIfTxPduCfg_ENGINE_CMD);
+	CanIf_TxConfirmation(CanIfConf_CanIfTxPduCfg_BRAKE_CMD);
+	
+	/* DIAG_RESP has no notification status, its bit stays clear */
+	CanIf_TxConfirmation(CanIfConf_CanIfTxPduCfg_DIAG_RESP);
+	
+	if((CanIf_ReadTxNotifStatus(CanIfConf_CanIfTxPduCfg_ENGINE_CMD) != CANIF_TX_RX_NOTIFICATION) ||
+	   (CanIf_ReadTxNotifStatus(CanIfConf_CanIfTxPduCfg_ENGINE_CMD) != CANIF_NO_NOTIFICATION))
+	{
+		Failed++;
+	}
+	
+	if((CanIf_ReadTxNotifStatusGroup(0u) != (1u << CanIfConf_CanIfTxPduCfg_BRAKE_CMD)) ||
+	   (CanIf_ReadTxNotifStatusGroup(0u) != 0u))
+	{
+		Failed++;
+	}
+	
+	CanIf_RxIndication(&Mailbox, &PduInfo);
+	
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+	CanIf_MainFunctionRx();
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	
+	if((CanIf_ReadRxNotifStatusGroup(0u) != (1u << CanIfConf_CanIfRxPduCfg_WHEEL_SPEED)) ||
+	   (CanIf_ReadRxNotifStatusGroup(0u) != 0u))
+	{
+		Failed++;
+	}
+	
+	printf("Tx / Rx notification status bits  %s\n", (Failed == 0u) ? "PASS" : "FAIL");
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		Bits += (uint32)CanIf_ReadTxNotifStatus((PduIdType)(Loop & 1u));
+	}
+	
+	SingleNs = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		Bits += CanIf_ReadTxNotifStatusGroup(0u);
+	}
+	
+	GroupNs = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	printf("%-34s %6.1f ns/call, CanIf_ReadTxNotifStatusGroup %.1f ns/call for 32 L-PDUs%s\n",
+		   "CanIf_ReadTxNotifStatus", SingleNs, GroupNs, (Bits == 0u) ? "" : "  FAILED");
+}
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API && CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+#if (CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+/* Frames stored by the timer signal, which preempts the reader like the receive interrupt on target */
+static volatile sig_atomic_t RxDataFrames;
+
+static void RxDataSignal(int Signal)
+{
+	static uint8 Sdu[8];
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	Can_HwType Mailbox = { 0x210u, 0u, CanIfConf_CanIfCtrlCfg_CAN0 };
+	uint32 Frame;
+	
+	(void)Signal;
+	
+	/* Three frames in a row, so a reader inside its copy sees its bank overwritten */
+	for(Frame = 0u; Frame < 3u; Frame++)
+	{
+		memset(Sdu, (int)(RxDataFrames & 0xFF), sizeof(Sdu));
+		
+		CanIf_RxIndication(&Mailbox, &PduInfo);
+		
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+		CanIf_MainFunctionRx();
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+		
+		RxDataFrames++;
+	}
+}
+
+/* CanIf_ReadRxPduData() returns the latest frame and never a mix of two frames */
+static void RxPduData(void)
+{
+	uint8 Sdu[8];
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 0u };
+	struct itimerval Timer = { { 0, 50 }, { 0, 50 } };
+	struct itimerval Stop = { { 0, 0 }, { 0, 0 } };
+	Can_HwType Mailbox = { 0x210u, 0u, CanIfConf_CanIfCtrlCfg_CAN0 };
+	uint32 Failed = 0u;
+	uint32 Reads = 0u;
+	uint32 Torn = 0u;
+	uint32 Index;
+	uint32 Loop;
+	double Start;
+	double Ns;
+	
+	InitStarted();
+	
+	if(CanIf_ReadRxPduData(CanIfConf_CanIfRxPduCfg_WHEEL_SPEED, &PduInfo) != E_NOT_OK)
+	{
+		Failed++;
+	}
+	
+	for(Index = 0u; Index < 8u; Index++)
+	{
+		Sdu[Index] = (uint8)(0xA0u + Index);
+	}
+	
+	PduInfo.SduLength = 8u;
+	
+	CanIf_RxIndication(&Mailbox, &PduInfo);
+	
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+	CanIf_MainFunctionRx();
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	
+	memset(Sdu, 0, sizeof(Sdu));
+	PduInfo.SduLength = 0u;
+	
+	if((CanIf_ReadRxPduData(CanIfConf_CanIfRxPduCfg_WHEEL_SPEED, &PduInfo) != E_OK) ||
+	   (PduInfo.SduLength != 8u) || (Sdu[0] != 0xA0u) || (Sdu[7] != 0xA7u))
+	{
+		Failed++;
+	}
+	
+	printf("CanIf_ReadRxPduData latest frame  %s\n", (Failed == 0u) ? "PASS" : "FAIL");
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		(void)CanIf_ReadRxPduData(CanIfConf_CanIfRxPduCfg_WHEEL_SPEED, &PduInfo);
+	}
+	
+	Ns = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	/* Frames keep arriving from the signal while the reader polls, the first replaces the A0 .. A7 frame */
+	RxDataSignal(SIGALRM);
+	
+	signal(SIGALRM, RxDataSignal);
+	setitimer(ITIMER_REAL, &Timer, NULL);
+	
+	Start = NowNs();
+	
+	while((NowNs() - Start) < 500e6)
+	{
+		(void)CanIf_ReadRxPduData(CanIfConf_CanIfRxPduCfg_WHEEL_SPEED, &PduInfo);
+		
+		for(Index = 1u; Index < 8u; Index++)
+		{
+			if(Sdu[Index] != Sdu[0])
+			{
+				Torn++;
+				break;
+			}
+		}
+		
+		Reads++;
+	}
+	
+	setitimer(ITIMER_REAL, &Stop, NULL);
+	signal(SIGALRM, SIG_DFL);
+	
+	printf("%-34s %6.1f ns/call, %u reads against %u frames from a signal, %u torn  %s\n",
+		   "CanIf_ReadRxPduData", Ns, (unsigned)Reads, (unsigned)RxDataFrames, (unsigned)Torn,
+		   (Torn == 0u) ? "PASS" : "FAIL");
+	
+	InitStarted();
+}
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+/* Sends one frame of a Tx L-PDU and returns the CAN ID the stub driver got */
+static Can_IdType SentCanId(PduIdType TxPduId)
+{
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 2u };
+	
+	LastPdu.id = 0xFFFFFFFFu;
+	(void)CanIf_Transmit(TxPduId, &PduInfo);
+	
+	return (LastPdu.id);
+}
+
+/*
+	Static L-PDUs and lists with a bad entry are rejected without a change,
+	a valid list is applied in one critical section, the last entry wins.
+*/
+static void DynamicTxIds(void)
+{
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	PduIdType BadPdus[2] = { CanIfConf_CanIfTxPduCfg_NODE_STATUS, CanIfConf_CanIfTxPduCfg_BRAKE_CMD };
+	uint32 DetErrors = DetErrorCount;
+#endif /* CANIF_DEV_ERROR_DETECT */
+	PduIdType Pdus[2] = { CanIfConf_CanIfTxPduCfg_NODE_STATUS, CanIfConf_CanIfTxPduCfg_NODE_STATUS };
+	Can_IdType CanIds[2] = { 0x320u, 0x330u };
+	uint32 Failed = 0u;
+	uint32 Loop;
+	double Start;
+	double SingleNs;
+	double ListNs;
+	
+	InitStarted();
+	
+	/* CanIf_Init() restores the configured CAN ID */
+	if(SentCanId(CanIfConf_CanIfTxPduCfg_NODE_STATUS) != 0x300u)
+	{
+		Failed++;
+	}
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* Only rejected with the DET checks on */
+	CanIf_SetDynamicTxId(CanIfConf_CanIfTxPduCfg_BRAKE_CMD, 0x121u);
+	CanIf_SetDynamicTxIdList(BadPdus, CanIds, 2u);
+	
+	if((SentCanId(CanIfConf_CanIfTxPduCfg_BRAKE_CMD) != 0x120u) ||
+	   (SentCanId(CanIfConf_CanIfTxPduCfg_NODE_STATUS) != 0x300u) ||
+	   (DetErrorCount != (DetErrors + 2u)))
+	{
+		Failed++;
+	}
+#endif /* CANIF_DEV_ERROR_DETECT */
+	
+	CanIf_SetDynamicTxIdList(Pdus, CanIds, 2u);
+	
+	if(SentCanId(CanIfConf_CanIfTxPduCfg_NODE_STATUS) != 0x330u)
+	{
+		Failed++;
+	}
+	
+#if (CANIF_DEV_ERROR_DETECT == STD_ON)
+	/* The two rejected requests above are expected */
+	DetErrorCount = DetErrors;
+#endif /* CANIF_DEV_ERROR_DETECT */
+	
+	printf("dynamic Tx CAN IDs in RAM          %s\n", (Failed == 0u) ? "PASS" : "FAIL");
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		CanIf_SetDynamicTxId(CanIfConf_CanIfTxPduCfg_NODE_STATUS, (Can_IdType)(0x300u + (Loop & 0xFFu)));
+	}
+	
+	SingleNs = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		CanIf_SetDynamicTxIdList(Pdus, CanIds, 2u);
+	}
+	
+	ListNs = (NowNs() - Start) / (double)(BENCH_LOOPS * 2u);
+	
+	printf("%-34s %6.1f ns/call, CanIf_SetDynamicTxIdList %.1f ns/entry\n",
+		   "CanIf_SetDynamicTxId", SingleNs, ListNs);
+	
+	InitStarted();
+}
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+
+#if ((CANIF_BUSOFF_RECOVERY == STD_ON) && (CANIF_PUBLIC_TX_BUFFERING == STD_ON))
+/* CanIf_MainFunctionBusOff() calls until the next start request of the recovery */
+static uint32 TicksToRestart(void)
+{
+	uint32 Starts = CanStartCount;
+	uint32 Ticks = 0u;
+	
+	while((CanStartCount == Starts) && (Ticks < 100000u))
+	{
+		CanIf_MainFunctionBusOff();
+		Ticks++;
+	}
+	
+	return (Ticks);
+}
+
+/*
+	CAN0 retains its Tx buffers over a bus-off and restarts after 10 ms for five
+	attempts, then every 1000 ms, with a 5 ms CanIf_MainFunctionBusOff(). The bus
+	stays off until the sixth attempt, the retained frames leave after the
+	restarts and the recovery ends with the first Tx confirmation.
+*/
+static void BusOff(void)
+{
+	static uint8 Sdu[8] = { 0u };
+	PduInfoType PduInfo = { Sdu, NULL_PTR, 8u };
+	CanIf_BusOffStatisticsType Statistics;
+	Can_ControllerStateType Mode;
+	uint32 Ticks[6];
+	uint32 Failed = 0u;
+	uint32 Writes;
+	uint32 Index;
+	uint32 Loop;
+	double Start;
+	double Ns;
+	
+	InitStarted();
+	
+	SentCount = 0u;
+	CanStartCount = 0u;
+	
+	CanIf_ControllerBusOff(CanIfConf_CanIfCtrlCfg_CAN0);
+	
+	(void)CanIf_GetControllerMode(CanIfConf_CanIfCtrlCfg_CAN0, &Mode);
+	
+	/* Nothing reaches the driver, the requests wait in the Tx buffer */
+	Writes = CanWriteCount;
+	
+	if((Mode != CAN_CS_STOPPED) ||
+	   (CanIf_Transmit(CanIfConf_CanIfTxPduCfg_ENGINE_CMD, &PduInfo) != E_OK) ||
+	   (CanIf_Transmit(CanIfConf_CanIfTxPduCfg_DIAG_RESP, &PduInfo) != E_OK) ||
+	   (CanWriteCount != Writes))
+	{
+		Failed++;
+	}
+	
+	for(Index = 0u; Index < 6u; Index++)
+	{
+		Ticks[Index] = TicksToRestart();
+		
+		/* The frame given to the driver is lost with the next bus-off */
+		if(Index < 5u)
+		{
+			CanIf_ControllerBusOff(CanIfConf_CanIfCtrlCfg_CAN0);
+		}
+	}
+	
+	/* The retained frames of both HTHs left on the first restart */
+	if((Ticks[0] != 2u) || (Ticks[4] != 2u) || (Ticks[5] != 200u) || (SentCount != 2u))
+	{
+		Failed++;
+	}
+	
+	CanIf_TxConfirmation(CanIfConf_CanIfTxPduCfg_ENGINE_CMD);
+	
+	CanIf_GetBusOffStatistics(CanIfConf_CanIfCtrlCfg_CAN0, &Statistics);
+	
+	if((Statistics.BusOffCount != 1u) || (Statistics.RestartAttempts != 6u) ||
+	   (Statistics.RecoveryTimeLast != (((5u * 2u) + 200u) * CANIF_BUSOFF_MAIN_FUNCTION_PERIOD_MS)) ||
+	   (Statistics.RecoveryTimeMax != Statistics.RecoveryTimeLast) || (Statistics.FlushedTxPdus != 0u))
+	{
+		Failed++;
+	}
+	
+	/* A stop requested by the upper layer drops the pending frames */
+	CanMailboxesBusy = TRUE;
+	(void)CanIf_Transmit(CanIfConf_CanIfTxPduCfg_ENGINE_CMD, &PduInfo);
+	CanMailboxesBusy = FALSE;
+	
+	(void)CanIf_SetControllerMode(CanIfConf_CanIfCtrlCfg_CAN0, CAN_CS_STOPPED);
+	
+	if(CanIf_Transmit(CanIfConf_CanIfTxPduCfg_ENGINE_CMD, &PduInfo) != E_NOT_OK)
+	{
+		Failed++;
+	}
+	
+	Writes = SentCount;
+	
+	(void)CanIf_SetControllerMode(CanIfConf_CanIfCtrlCfg_CAN0, CAN_CS_STARTED);
+	
+	if(SentCount != Writes)
+	{
+		Failed++;
+	}
+	
+	printf("bus-off recovery %u+%u+%u+%u+%u+%u ticks, %u ms  %s\n",
+		   (unsigned)Ticks[0], (unsigned)Ticks[1], (unsigned)Ticks[2], (unsigned)Ticks[3],
+		   (unsigned)Ticks[4], (unsigned)Ticks[5], (unsigned)Statistics.RecoveryTimeLast,
+		   (Failed == 0u) ? "PASS" : "FAIL");
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		CanIf_MainFunctionBusOff();
+	}
+	
+	Ns = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	printf("%-34s %6.1f ns/call, no controller in bus-off\n", "CanIf_MainFunctionBusOff", Ns);
+	
+	InitStarted();
+}
+#endif /* CANIF_BUSOFF_RECOVERY && CANIF_PUBLIC_TX_BUFFERING */
+
+int main(void)
+{
+	InitStarted();
+	
+	Bench("ENGINE_CMD, 8 of 8 bytes",          CanIfConf_CanIfTxPduCfg_ENGINE_CMD,  8u);
+	Bench("BRAKE_CMD, 2 of 4 bytes (padded)",  CanIfConf_CanIfTxPduCfg_BRAKE_CMD,   2u);
+	
+	CanIf_SetDynamicTxId(CanIfConf_CanIfTxPduCfg_NODE_STATUS, 0x310u);
+	Bench("NODE_STATUS, 5 of 2 bytes (trunc)", CanIfConf_CanIfTxPduCfg_NODE_STATUS, 5u);
+	
+	Bench("DIAG_RESP, 8 of 8 bytes",           CanIfConf_CanIfTxPduCfg_DIAG_RESP,   8u);
+	
+	RxLookup();
+	
+#if (CANIF_RX_DEFERRED_PROCESSING == STD_ON)
+	RxDeferred();
+#endif /* CANIF_RX_DEFERRED_PROCESSING */
+	
+	BenchRx500();
+	
+#if ((CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API == STD_ON) && (CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API == STD_ON))
+	NotifStatus();
+#endif /* CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API && CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API */
+
+#if (CANIF_PUBLIC_READRXPDU_DATA_API == STD_ON)
+	RxPduData();
+#endif /* CANIF_PUBLIC_READRXPDU_DATA_API */
+	
+#if (CANIF_PUBLIC_SETDYNAMICTXID_API == STD_ON)
+	DynamicTxIds();
+#endif /* CANIF_PUBLIC_SETDYNAMICTXID_API */
+	
+#if (CANIF_PUBLIC_TX_BUFFERING == STD_ON)
+	PriorityOrder();
+	
+	BenchBuffered();
+#endif /* CANIF_PUBLIC_TX_BUFFERING */
+	
+#if ((CANIF_BUSOFF_RECOVERY == STD_ON) && (CANIF_PUBLIC_TX_BUFFERING == STD_ON))
+	BusOff();
+#endif /* CANIF_BUSOFF_RECOVERY && CANIF_PUBLIC_TX_BUFFERING */
+	
+	printf("development errors during the runs: %u\n", (unsigned)DetErrorCount);
+	
+	return 0;
+}
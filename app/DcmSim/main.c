@@ -0,0 +1,172 @@
+/*
+	Host test and benchmark of the Dcm request dispatch.
+
+	Links the generated Dcm configuration with the DSD and the DSP, so a
+	service of the generated table without a processing function fails
+	the build. The requests are written into DcmDslRxBuffer and processed
+	by DcmDsdProcessRequest(), the way the DSL hands over a received
+	request, and the responses are compared byte by byte.
+
+	Ecu.json configures DiagnosticSessionControl and TesterPresent, every
+	other service ID is answered serviceNotSupported by the SID index table
+	without reaching a processing function. SecurityAccess is not
+	configured, the security level stays locked.
+
+	The DSL only hands over requests which fit DcmDslRxBuffer, the cases
+	are at most DCM_DSL_RX_BUFFER_SIZE bytes long.
+
+	Build and run from this folder:
+
+	gcc -O2 -Wall -I../../AUTOSAR/BSW/GeneralTypes                          \
+		-I../../AUTOSAR/Service/DCM/inc -I../../AUTOSAR/Service/DCM/gen    \
+		main.c ../../AUTOSAR/Service/DCM/src/Dcm_Dsd.c                      \
+		../../AUTOSAR/Service/DCM/src/Dcm_Dsp.c                             \
+		../../AUTOSAR/Service/DCM/gen/Dcm_Lcfg.c -o DcmSim && ./DcmSim
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Dcm_Dsd.h"
+#include "Dcm_Dsp.h"
+
+#define BENCH_LOOPS		(2000000u)
+
+/* A request and the response it shall get, no response if ResponseLength is 0 */
+typedef struct
+{
+	const char* Name;
+	uint8		Request[8];
+	uint8		RequestLength;
+	uint8		Response[8];
+	uint8		ResponseLength;
+}DcmSimCaseType;
+
+/* In order, the session changes carry over to the next cases */
+static const DcmSimCaseType Cases[] =
+{
+	{ "TesterPresent",                        { 0x3Eu, 0x00u }, 2u,               { 0x7Eu, 0x00u }, 2u },
+	{ "TesterPresent, suppressed",            { 0x3Eu, 0x80u }, 2u,               { 0u }, 0u },
+	{ "TesterPresent, bad sub-function",      { 0x3Eu, 0x01u }, 2u,               { 0x7Fu, 0x3Eu, 0x12u }, 3u },
+	{ "TesterPresent, too short",             { 0x3Eu }, 1u,                      { 0x7Fu, 0x3Eu, 0x13u }, 3u },
+	{ "RoutineControl, not configured",       { 0x31u, 0x01u }, 2u,               { 0x7Fu, 0x31u, 0x11u }, 3u },
+	{ "SecurityAccess, not configured",       { 0x27u, 0x01u }, 2u,               { 0x7Fu, 0x27u, 0x11u }, 3u },
+	{ "ReadDataByIdentifier, not configured", { 0x22u, 0xF1u }, 2u,               { 0x7Fu, 0x22u, 0x11u }, 3u },
+	{ "WriteDataByIdentifier, not configured",{ 0x2Eu, 0xF1u }, 2u,               { 0x7Fu, 0x2Eu, 0x11u }, 3u },
+	{ "EcuReset, not configured",             { 0x11u, 0x01u }, 2u,               { 0x7Fu, 0x11u, 0x11u }, 3u },
+	{ "ReadDTCInformation, not configured",   { 0x19u, 0x02u }, 2u,               { 0x7Fu, 0x19u, 0x11u }, 3u },
+	{ "DiagnosticSessionControl, too short",  { 0x10u }, 1u,                      { 0x7Fu, 0x10u, 0x13u }, 3u },
+	{ "unknown session",                      { 0x10u, 0x05u }, 2u,               { 0x7Fu, 0x10u, 0x12u }, 3u },
+	{ "extended session",                     { 0x10u, 0x03u }, 2u,               { 0x50u, 0x03u, 0x00u, 0x32u, 0x01u, 0xF4u }, 6u },
+	{ "programming session, suppressed",      { 0x10u, 0x82u }, 2u,               { 0u }, 0u },
+	{ "TesterPresent in programming",         { 0x3Eu, 0x00u }, 2u,               { 0x7Eu, 0x00u }, 2u },
+	{ "default session",                      { 0x10u, 0x01u }, 2u,               { 0x50u, 0x01u, 0x00u, 0x32u, 0x01u, 0xF4u }, 6u }
+};
+
+static double NowNs(void)
+{
+	struct timespec Ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	
+	return ((double)Ts.tv_sec * 1e9) + (double)Ts.tv_nsec;
+}
+
+static Dcm_MsgLenType Process(const uint8* Request, uint8 RequestLength)
+{
+	memcpy(DcmDslRxBuffer, Request, RequestLength);
+	
+	return (DcmDsdProcessRequest(RequestLength));
+}
+
+static uint32 RunCases(void)
+{
+	Dcm_MsgLenType Length;
+	uint32 Index;
+	uint32 Failed = 0u;
+	
+	for(Index = 0u; Index < (sizeof(Cases) / sizeof(Cases[0])); Index++)
+	{
+		Length = Process(Cases[Index].Request, Cases[Index].RequestLength);
+		
+		if((Length != Cases[Index].ResponseLength) || (0 != memcmp(DcmDslTxBuffer, Cases[Index].Response, Length)))
+		{
+			printf("  %-38s FAIL, %u response bytes\n", Cases[Index].Name, (unsigned)Length);
+			Failed++;
+		}
+	}
+	
+	printf("Dcm requests, %u cases                   %s\n",
+		   (unsigned)(sizeof(Cases) / sizeof(Cases[0])), (Failed == 0u) ? "PASS" : "FAIL");
+	
+	return (Failed);
+}
+
+/* A response buffer too short for the session and the timing is answered responseTooLong */
+static uint32 ResponseTooLong(void)
+{
+	uint8 Request[1]  = { 0x03u };
+	uint8 Response[4] = { 0u };
+	Dcm_MsgContextType MsgContext;
+	Dcm_NegativeResponseCodeType ErrorCode = 0u;
+	Std_ReturnType Result;
+	uint32 Failed = 0u;
+	
+	memset(&MsgContext, 0, sizeof(MsgContext));
+	MsgContext.reqData		 = Request;
+	MsgContext.reqDataLen	 = 1u;
+	MsgContext.resData		 = Response;
+	MsgContext.resMaxDataLen = sizeof(Response);
+	
+	Result = Dcm_DspDiagnosticSessionControl(DCM_INITIAL, &MsgContext, &ErrorCode);
+	
+	/* The session stays the default one */
+	if((E_NOT_OK != Result) || (DCM_E_RESPONSETOOLONG != ErrorCode) || (0u != MsgContext.resDataLen) ||
+	   (DCM_SESSION_MASK_DEFAULT != DcmDspGetSessionMask()))
+	{
+		Failed++;
+	}
+	
+	printf("DiagnosticSessionControl, 4 byte buffer %s\n", (Failed == 0u) ? "PASS" : "FAIL");
+	
+	return (Failed);
+}
+
+/* Dispatch time of one request, the first and last configured service and an unknown one */
+static void Bench(const char* Name, const uint8* Request, uint8 RequestLength)
+{
+	uint32 Loop;
+	double Start;
+	double Ns;
+	
+	Start = NowNs();
+	
+	for(Loop = 0u; Loop < BENCH_LOOPS; Loop++)
+	{
+		(void)Process(Request, RequestLength);
+	}
+	
+	Ns = (NowNs() - Start) / (double)BENCH_LOOPS;
+	
+	printf("%-38s %6.1f ns/request  response 0x%02X 0x%02X\n", Name, Ns,
+		   (unsigned)DcmDslTxBuffer[0], (unsigned)DcmDslTxBuffer[1]);
+}
+
+int main(void)
+{
+	static const uint8 TesterPresent[2]	 = { 0x3Eu, 0x00u };
+	static const uint8 DefaultSession[2] = { 0x10u, 0x01u };
+	static const uint8 NotConfigured[2]	 = { 0xBEu, 0x00u };
+	uint32 Failed;
+	
+	Dcm_DsD_Init();
+	Dcm_Dsp_Init();
+	
+	Failed  = RunCases();
+	Failed += ResponseTooLong();
+	
+	Bench("DiagnosticSessionControl, 1st service", DefaultSession, 2u);
+	Bench("TesterPresent, last service",           TesterPresent,  2u);
+	Bench("SID 0xBE, not configured",              NotConfigured,  2u);
+	
+	return ((Failed == 0u) ? 0 : 1);
+}
@@ -0,0 +1,183 @@
+/*
+	Benchmark of the C++ DIO layer (Dio.hpp) against hand written register access.
+
+	Every access is written twice, once through Dio.hpp (Cpp_*) and once as 
+	hand written masked GPIODATA loads / stores (Hand_*).
+
+	Generated code, any C++17 compiler, target register macros (no simulation):
+
+	g++ -std=c++17 -O2 -c                                                 \
+		-I../../AUTOSAR/SIM -I../../AUTOSAR/BSW/GeneralTypes              \
+		-I../../AUTOSAR/BSW/MCAL/DIO/inc -I../../AUTOSAR/BSW/MCAL/DIO/gen  \
+		main.cpp -o DioCppBench.o && objdump -d --no-show-raw-insn DioCppBench.o
+
+	(arm-none-eabi-g++ -mcpu=cortex-m4 -mthumb for the target listing) and 
+	compare the body of each Cpp_ function with the Hand_ function of the same name.
+
+	Bus accesses and host time on the simulated register bus, from this folder:
+
+	gcc -O2 -DSIM_REGISTER_ACCESS -c                                      \
+		-I../../AUTOSAR/SIM -I../../AUTOSAR/BSW/GeneralTypes              \
+		-I../../AUTOSAR/BSW/MCAL/DIO/inc -I../../AUTOSAR/BSW/MCAL/DIO/gen  \
+		-I../../AUTOSAR/BSW/MCAL/DIO/integration ../../AUTOSAR/SIM/Sim*.c
+	g++ -std=c++17 -O2 -DSIM_REGISTER_ACCESS                              \
+		-I../../AUTOSAR/SIM -I../../AUTOSAR/BSW/GeneralTypes              \
+		-I../../AUTOSAR/BSW/MCAL/DIO/inc -I../../AUTOSAR/BSW/MCAL/DIO/gen  \
+		main.cpp Sim*.o -o DioCppBench && ./DioCppBench
+
+	The run fails if a pair differs in its reads, writes, results or pin levels.
+*/
+#include "hw_memmap.h"
+#include "gpio.h"
+#include "Dio.hpp"
+
+/* Output pins of port B, read back as the group PB1..PB3 */
+using Led1		= Dio::Channel<LED1>;
+using Led2		= Dio::Channel<LED2>;
+using Led3		= Dio::Channel<LED3>;
+using Button1	= Dio::Channel<BUTTON1>;
+using LowNibble	= Dio::Group<LED1_PORT, 0x0Eu>;
+using LedPort	= Dio::Port<LED1_PORT>;
+
+/* Hand written masked address of the pins of port B */
+#define HAND_PORTB_DATA(PINS)	(DIO_PORTB_BASE + ((uint32)(PINS) << 2u))
+
+extern "C"
+{
+
+uint32 Cpp_SetLed1(uint32 Value)		{ (void)Value; Led1::Set(); return (0u); }
+uint32 Hand_SetLed1(uint32 Value)		{ (void)Value; SET_PORT((HAND_PORTB_DATA(GPIO_PIN_4)), GPIO_PIN_4); return (0u); }
+
+uint32 Cpp_WriteLed2(uint32 Value)		{ Led2::Write((Dio_LevelType)(Value & 1u)); return (0u); }
+uint32 Hand_WriteLed2(uint32 Value)		{ SET_PORT((HAND_PORTB_DATA(GPIO_PIN_5)), ((0u != (Value & 1u)) ? GPIO_PIN_5 : 0u)); return (0u); }
+
+uint32 Cpp_FlipLed3(uint32 Value)		{ (void)Value; return (Led3::Flip()); }
+uint32 Hand_FlipLed3(uint32 Value)		
+{ 
+	uint32 Level = (GET_PORT((HAND_PORTB_DATA(GPIO_PIN_6))) ^ GPIO_PIN_6);
+	
+	(void)Value;
+	SET_PORT((HAND_PORTB_DATA(GPIO_PIN_6)), Level);
+	
+	return ((Dio_LevelType)(Level >> 6u));
+}
+
+uint32 Cpp_ReadButton1(uint32 Value)	{ (void)Value; return (Button1::Read()); }
+uint32 Hand_ReadButton1(uint32 Value)	{ (void)Value; return ((Dio_LevelType)(GET_PORT((HAND_PORTB_DATA(GPIO_PIN_7))) >> 7u)); }
+
+uint32 Cpp_WriteGroup(uint32 Value)		{ LowNibble::Write((Dio_PortLevelType)Value); return (0u); }
+uint32 Hand_WriteGroup(uint32 Value)	{ SET_PORT((HAND_PORTB_DATA(0x0Eu)), ((uint32)(uint8)Value << 1u)); return (0u); }
+
+uint32 Cpp_ReadGroup(uint32 Value)		{ (void)Value; return (LowNibble::Read()); }
+uint32 Hand_ReadGroup(uint32 Value)		{ (void)Value; return ((uint8)(GET_PORT((HAND_PORTB_DATA(0x0Eu))) >> 1u)); }
+
+uint32 Cpp_WritePort(uint32 Value)		{ LedPort::Write((Dio_PortLevelType)Value); return (0u); }
+uint32 Hand_WritePort(uint32 Value)		{ SET_PORT((HAND_PORTB_DATA(0xFFu)), (uint8)Value); return (0u); }
+
+}
+
+#ifdef SIM_REGISTER_ACCESS
+
+#include <stdio.h>
+#include <time.h>
+#include "Sim.h"
+
+#define BENCH_ITERATIONS	(1000000u)
+
+typedef uint32 (*BenchFuncType)(uint32 Value);
+
+typedef struct
+{
+	const char*   Name;
+	BenchFuncType Cpp;
+	BenchFuncType Hand;
+}BenchType;
+
+/* Bus accesses, results and end state of one side of a pair */
+typedef struct
+{
+	double Ns;
+	uint32 Reads;
+	uint32 Writes;
+	uint32 Sum;
+	uint8  Pins;
+}BenchResultType;
+
+static const BenchType Benches[] =
+{
+	{ "Set LED1"              , Cpp_SetLed1     , Hand_SetLed1     },
+	{ "Write LED2 (runtime)"  , Cpp_WriteLed2   , Hand_WriteLed2   },
+	{ "Flip LED3"             , Cpp_FlipLed3    , Hand_FlipLed3    },
+	{ "Read BUTTON1"          , Cpp_ReadButton1 , Hand_ReadButton1 },
+	{ "Write group PB1..PB3"  , Cpp_WriteGroup  , Hand_WriteGroup  },
+	{ "Read group PB1..PB3"   , Cpp_ReadGroup   , Hand_ReadGroup   },
+	{ "Write port B"          , Cpp_WritePort   , Hand_WritePort   },
+};
+
+static void RunSide(const BenchFuncType Func, BenchResultType* const Result)
+{
+	struct timespec Start, End;
+	uint32 Iteration;
+	uint32 Sum = 0u;
+	
+	/* Same start state for both sides */
+	SET_PORT((HAND_PORTB_DATA(0xFFu)), 0u);
+	Sim_ResetCounters();
+	
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	
+	for(Iteration = 0u; Iteration < BENCH_ITERATIONS; Iteration++)
+	{
+		Sum += Func(Iteration);
+	}
+	
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	
+	Result->Ns	   = (((double)(End.tv_sec - Start.tv_sec) * 1e9) + (double)(End.tv_nsec - Start.tv_nsec)) / BENCH_ITERATIONS;
+	Result->Reads  = Sim_GetTotalReads();
+	Result->Writes = Sim_GetTotalWrites();
+	Result->Sum	   = Sum;
+	Result->Pins   = Sim_GetPinLevels(DIO_PORTB_BASE);
+}
+
+int main(void)
+{
+	BenchResultType Cpp;
+	BenchResultType Hand;
+	uint32 BenchIndex;
+	uint32 Failures = 0u;
+	boolean Same;
+	
+	Sim_Reset();
+	
+	/* Same pin setup as the DioTest application, BUTTON1 held high */
+	GPIOPinTypeGPIOOutput(DIO_PORTB_BASE , GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 |
+											GPIO_PIN_4 | GPIO_PIN_5 | GPIO_PIN_6);
+	Sim_SetPinInput(DIO_PORTB_BASE, GPIO_PIN_7, STD_HIGH);
+	
+	printf("%-22s %9s %9s %12s %12s  %s\n", "Access", "C++ ns", "hand ns", "reads/call", "writes/call", "match");
+	
+	for(BenchIndex = 0u; BenchIndex < (sizeof(Benches) / sizeof(Benches[0])); BenchIndex++)
+	{
+		RunSide(Benches[BenchIndex].Cpp , &Cpp);
+		RunSide(Benches[BenchIndex].Hand, &Hand);
+		
+		Same = (boolean)((Cpp.Reads == Hand.Reads) && (Cpp.Writes == Hand.Writes) &&
+						 (Cpp.Sum == Hand.Sum) && (Cpp.Pins == Hand.Pins) &&
+						 (0u == Sim_GetUnmappedAccesses()) && (0u == Sim_GetApertureFaults()));
+		
+		if(TRUE != Same)
+		{
+			Failures++;
+		}
+		
+		printf("%-22s %9.2f %9.2f %5.2f /%5.2f %5.2f /%5.2f  %s\n", Benches[BenchIndex].Name, Cpp.Ns, Hand.Ns,
+			   (double)Cpp.Reads / BENCH_ITERATIONS, (double)Hand.Reads / BENCH_ITERATIONS,
+			   (double)Cpp.Writes / BENCH_ITERATIONS, (double)Hand.Writes / BENCH_ITERATIONS,
+			   (TRUE == Same) ? "same" : "DIFFERENT");
+	}
+	
+	return ((0u == Failures) ? 0 : 1);
+}
+
+#endif /* SIM_REGISTER_ACCESS */
@@ -0,0 +1,602 @@
+/*
+	Host benchmark of the DIO driver on the simulated register bus.
+
+	Runs every Dio API on the unchanged driver sources and reports the
+	host time and the number of peripheral register reads / writes per call.
+
+	Build and run from this folder:
+
+	gcc -O2 -DSIM_REGISTER_ACCESS                                        \
+		-I../../AUTOSAR/SIM -I../../AUTOSAR/BSW/GeneralTypes             \
+		-I../../AUTOSAR/BSW/MCAL/DIO/inc -I../../AUTOSAR/BSW/MCAL/DIO/gen \
+		-I../../AUTOSAR/BSW/MCAL/DIO/integration -I../../AUTOSAR/STUB    \
+		main.c ../../AUTOSAR/BSW/MCAL/DIO/src/Dio.c                      \
+		../../AUTOSAR/BSW/MCAL/DIO/gen/Dio_Lcfg.c ../../AUTOSAR/STUB/Stub.c \
+		../../AUTOSAR/SIM/Sim.c ../../AUTOSAR/SIM/Sim_Gpio.c                \
+		../../AUTOSAR/BSW/MCAL/DIO/integration/SchM_Dio.c                 \
+		../../AUTOSAR/SIM/Sim_SysCtl.c ../../AUTOSAR/SIM/Sim_Int.c          \
+		../../AUTOSAR/SIM/Sim_Timer.c ../../AUTOSAR/SIM/Sim_Udma.c          \
+		../../AUTOSAR/SIM/Sim_Dwt.c ../../AUTOSAR/SIM/Sim_Expander.c      \
+		-o DioSim && ./DioSim
+
+	The port B aperture follows DioAhbAperture in Dio_Cfg.h, rebuild with
+	the switch toggled to compare the APB and AHB toggle loops.
+
+	Add -DREGISTER_TRACE -I../../AUTOSAR/TRACE ../../AUTOSAR/TRACE/Trace.c to
+	record the register writes (the ns/call then include the recording) and
+	save a short LED sequence to DioSim.trace, convert it with app/Trace2Vcd.
+*/
+#include <stdio.h>
+#include <time.h>
+#include "hw_memmap.h"
+#include "hw_gpio.h"
+#include "gpio.h"
+#include "hw_ints.h"
+#include "interrupt.h"
+#include "udma.h"
+#include "Sim.h"
+#include "Dio.h"
+
+#ifdef REGISTER_TRACE
+#include "Trace.h"
+#endif
+
+#if (DioExpanderApi == STD_ON)
+#include "Dio_Expander.h"
+#endif
+
+#define BENCH_ITERATIONS	(1000000u)
+
+typedef struct
+{
+	const char* Name;
+	void (*Run)(void);
+}BenchType;
+
+extern const Dio_ChannelGroupType ChannelGroup[];
+#if (DioVirtualGroupApi == STD_ON)
+extern const Dio_VirtualGroupType VirtualGroup[];
+#endif
+
+volatile Dio_LevelType     Level;
+volatile Dio_PortLevelType PortLevel;
+
+static void BenchReadChannel(void)       { Level = Dio_ReadChannel(LED1); }
+static void BenchWriteChannel(void)      { Dio_WriteChannel(LED1 , STD_HIGH); }
+static void BenchReadPort(void)          { PortLevel = Dio_ReadPort(LED1_PORT); }
+static void BenchWritePort(void)         { Dio_WritePort(LED1_PORT , 0x5A); }
+static void BenchReadChannelGroup(void)  { PortLevel = Dio_ReadChannelGroup(&ChannelGroup[1]); }
+static void BenchWriteChannelGroup(void) { Dio_WriteChannelGroup(&ChannelGroup[1] , 0x07); }
+#if (DioFlipChannelApi == STD_ON)
+static void BenchFlipChannel(void)       { Level = Dio_FlipChannel(LED2); }
+#endif
+
+/* One full period of a software generated clock on LED1 */
+static void BenchTogglePeriod(void)
+{
+	Dio_WriteChannel(LED1 , STD_HIGH);
+	Dio_WriteChannel(LED1 , STD_LOW);
+}
+
+/* One output frame of the three LEDs, written one by one and as a list */
+static const Dio_ChannelLevelType LedFrame[] =
+{
+	{ LED1 , STD_HIGH },
+	{ LED2 , STD_LOW  },
+	{ LED3 , STD_HIGH }
+};
+
+static void BenchWriteChannel3(void)
+{
+	Dio_WriteChannel(LedFrame[0].ChannelId , LedFrame[0].Level);
+	Dio_WriteChannel(LedFrame[1].ChannelId , LedFrame[1].Level);
+	Dio_WriteChannel(LedFrame[2].ChannelId , LedFrame[2].Level);
+}
+#if (DioWriteChannelListApi == STD_ON)
+static void BenchWriteChannelList3(void) { Dio_WriteChannelList(LedFrame , 3u); }
+#endif
+#if (DioInputSnapshotApi == STD_ON)
+/* Eight consumers of the button in one cycle, reading the pin or the snapshot */
+#define BUTTON_CONSUMERS	(8u)
+
+static void BenchReadButton8(void)
+{
+	uint32 Consumer;
+	
+	for(Consumer = 0u; Consumer < BUTTON_CONSUMERS; Consumer++)
+	{
+		Level = Dio_ReadChannel(BUTTON1);
+	}
+}
+
+static void BenchSnapshotButton8(void)
+{
+	uint32 Consumer;
+	
+	Dio_MainFunction();
+	
+	for(Consumer = 0u; Consumer < BUTTON_CONSUMERS; Consumer++)
+	{
+		Level = Dio_ReadChannelSnapshot(BUTTON1);
+	}
+}
+#endif
+#if (DioStaticChannelApi == STD_ON)
+static void BenchReadChannelStatic(void) { Level = Dio_ReadChannelStatic(LED1); }
+static void BenchWriteChannelStatic(void){ Dio_WriteChannelStatic(LED1 , STD_HIGH); }
+#endif
+
+static const BenchType Benches[] =
+{
+	{ "Dio_ReadChannel"       , BenchReadChannel       },
+	{ "Dio_WriteChannel"      , BenchWriteChannel      },
+	{ "Dio_ReadPort"          , BenchReadPort          },
+	{ "Dio_WritePort"         , BenchWritePort         },
+	{ "Dio_ReadChannelGroup"  , BenchReadChannelGroup  },
+	{ "Dio_WriteChannelGroup" , BenchWriteChannelGroup },
+#if (DioFlipChannelApi == STD_ON)
+	{ "Dio_FlipChannel"       , BenchFlipChannel       },
+#endif
+	{ "Toggle period (LED1)"  , BenchTogglePeriod      },
+	{ "3 x Dio_WriteChannel"  , BenchWriteChannel3     },
+#if (DioWriteChannelListApi == STD_ON)
+	{ "Dio_WriteChannelList(3)", BenchWriteChannelList3 },
+#endif
+#if (DioInputSnapshotApi == STD_ON)
+	{ "8 x Dio_ReadChannel"   , BenchReadButton8        },
+	{ "MainFunction + 8 x snap", BenchSnapshotButton8    },
+#endif
+#if (DioStaticChannelApi == STD_ON)
+	{ "Dio_ReadChannelStatic" , BenchReadChannelStatic  },
+	{ "Dio_WriteChannelStatic", BenchWriteChannelStatic },
+#endif
+};
+
+#if (DioPatternApi == STD_ON)
+
+/* Timer ticks between two pattern samples */
+#define PATTERN_PERIOD		(1000u)
+
+/* Number of passes of the repeated pattern */
+#define PATTERN_PASSES		(10000u)
+
+/* uDMA control table, owned by the integration code */
+static uint8 UdmaControlTable[1024] __attribute__((aligned(1024)));
+
+/* Full step phases of a stepper on the four pins of ChannelGroup[1] (mask 0x8E, offset 1) */
+static Dio_PortLevelType StepperPhases[4];
+
+static uint32 PatternCompletions;
+static void PatternComplete(void) { PatternCompletions++; }
+
+/* Streams the stepper phases and reports the CPU cost per sample */
+static void RunPattern(void)
+{
+	Dio_PatternType Pattern;
+	uint32 Samples;
+
+	StepperPhases[0] = DIO_PATTERN_SAMPLE(0x01u , ChannelGroup[1].offset);
+	StepperPhases[1] = DIO_PATTERN_SAMPLE(0x02u , ChannelGroup[1].offset);
+	StepperPhases[2] = DIO_PATTERN_SAMPLE(0x04u , ChannelGroup[1].offset);
+	StepperPhases[3] = DIO_PATTERN_SAMPLE(0x40u , ChannelGroup[1].offset);
+
+	Pattern.Group				 = &ChannelGroup[1];
+	Pattern.Samples				 = StepperPhases;
+	Pattern.NumOfSamples		 = 4u;
+	Pattern.Period				 = PATTERN_PERIOD;
+	Pattern.Repeat				 = TRUE;
+	Pattern.StartNotification	 = NULL_PTR;
+	Pattern.StopNotification	 = NULL_PTR;
+	Pattern.CompleteNotification = PatternComplete;
+
+	uDMAEnable();
+	uDMAControlBaseSet(UdmaControlTable);
+	IntRegister(INT_TIMER0A , Dio_PatternIsr);
+
+	(void)Dio_StartPattern(&Pattern);
+
+	Sim_ResetCounters();
+
+	Sim_AdvanceTime(PATTERN_PERIOD * 4u * PATTERN_PASSES);
+
+	Dio_StopPattern();
+
+	/* The CPU only runs in the ISR at the end of each pass */
+	Samples = Sim_GetUdmaTransfers();
+
+	printf("\nPattern engine: %lu samples, %lu completions, %lu ISR entries\n",
+		   (unsigned long)Samples, (unsigned long)PatternCompletions, (unsigned long)Sim_GetIntServedCount());
+	printf("ISR entries per sample: %.4f\n", (double)Sim_GetIntServedCount() / (double)Samples);
+}
+
+#endif /* DioPatternApi */
+
+#if (DioEdgeCaptureApi == STD_ON)
+
+/* Edges on BUTTON1 per drain of the consumer, and number of drains */
+#define EDGE_BURST			(16u)
+#define EDGE_DRAINS			(10000u)
+
+/* Virtual ticks between two edges of the input signal */
+#define EDGE_SPACING		(200u)
+
+/* Drives a square wave on BUTTON1, one virtual edge interrupt per call */
+static uint8 EdgeLevel = STD_LOW;
+
+static void EdgeToggle(void)
+{
+	EdgeLevel = (STD_LOW == EdgeLevel) ? STD_HIGH : STD_LOW;
+	
+	Sim_AdvanceTime(EDGE_SPACING);
+	Sim_SetPinInput(DIO_PORTB_BASE , GPIO_PIN_7 , EdgeLevel);
+}
+
+/* Captures bursts of edges drained in batches, then a burst which does not fit the ring */
+static void RunEdgeCapture(void)
+{
+	Dio_EdgeEventType Events[DIO_CFG_EDGE_RING_SIZE];
+	struct timespec Start, End;
+	uint32 Drain;
+	uint32 Edge;
+	uint32 Received = 0u;
+	uint32 Edges;
+	uint32 BadSpacing = 0u;
+	uint32 LastTimestamp = 0u;
+	uint32 Served;
+	uint16 Count;
+	uint16 Index;
+	
+	GPIOPinTypeGPIOInput(DIO_PORTB_BASE , GPIO_PIN_7);
+	
+	/* Cycle counter for the timestamps, as the integration code does on target */
+	Sim_WriteRegister(SIM_DWT_BASE + SIM_DWT_O_CTRL , SIM_DWT_CTRL_CYCCNTENA);
+	
+	IntRegister(INT_GPIOB , Dio_EdgeIsr);
+	Dio_StartEdgeCapture();
+	
+	Sim_ResetCounters();
+	Served = Sim_GetIntServedCount();
+	
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	
+	for(Drain = 0u; Drain < EDGE_DRAINS; Drain++)
+	{
+		for(Edge = 0u; Edge < EDGE_BURST; Edge++)
+		{
+			EdgeToggle();
+		}
+		
+		Count = Dio_ReadEdgeEvents(Events , DIO_CFG_EDGE_RING_SIZE);
+		
+		for(Index = 0u; Index < Count; Index++)
+		{
+			if((0u != Received) && ((Events[Index].Timestamp - LastTimestamp) != EDGE_SPACING))
+			{
+				BadSpacing++;
+			}
+			
+			LastTimestamp = Events[Index].Timestamp;
+			Received++;
+		}
+	}
+	
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	
+	Edges = EDGE_DRAINS * EDGE_BURST;
+	
+	printf("\nEdge capture: %lu edges, %lu events, %lu lost, %lu bad timestamps\n",
+		   (unsigned long)Edges, (unsigned long)Received, (unsigned long)Dio_GetEdgeOverflowCount(),
+		   (unsigned long)BadSpacing);
+	printf("ISR entries per edge: %.2f, register reads / writes per edge: %.2f / %.2f\n",
+		   (double)(Sim_GetIntServedCount() - Served) / (double)Edges,
+		   (double)Sim_GetTotalReads()  / (double)Edges,
+		   (double)Sim_GetTotalWrites() / (double)Edges);
+	printf("Host ns per edge (ISR + drain): %.1f\n",
+		   ((double)(End.tv_sec - Start.tv_sec) * 1e9 + (double)(End.tv_nsec - Start.tv_nsec)) / (double)Edges);
+	
+	/* A burst twice the ring size before the consumer runs, the newest half is lost */
+	for(Edge = 0u; Edge < (2u * DIO_CFG_EDGE_RING_SIZE); Edge++)
+	{
+		EdgeToggle();
+	}
+	
+	Count = Dio_ReadEdgeEvents(Events , DIO_CFG_EDGE_RING_SIZE);
+	
+	printf("Burst of %u edges: %u events read, %lu lost\n", (unsigned)(2u * DIO_CFG_EDGE_RING_SIZE),
+		   (unsigned)Count, (unsigned long)Dio_GetEdgeOverflowCount());
+	
+	/* PB3 borrowed by another driver with its own edge interrupt, the Dio handler leaves it alone */
+	GPIOPinTypeGPIOInput(DIO_PORTB_BASE , GPIO_PIN_3);
+	Sim_WriteRegister(DIO_PORTB_BASE + GPIO_O_IBE , Sim_ReadRegister(DIO_PORTB_BASE + GPIO_O_IBE) | GPIO_PIN_3);
+	Sim_WriteRegister(DIO_PORTB_BASE + GPIO_O_IM , Sim_ReadRegister(DIO_PORTB_BASE + GPIO_O_IM) | GPIO_PIN_3);
+	
+	Sim_SetPinInput(DIO_PORTB_BASE , GPIO_PIN_3 , STD_HIGH);
+	
+	Count = Dio_ReadEdgeEvents(Events , DIO_CFG_EDGE_RING_SIZE);
+	
+	printf("Foreign edge on PB3: %u events, still latched for its owner: %s\n", (unsigned)Count,
+		   (0u != (Sim_ReadRegister(DIO_PORTB_BASE + GPIO_O_RIS) & GPIO_PIN_3)) ? "yes" : "no");
+	
+	Sim_WriteRegister(DIO_PORTB_BASE + GPIO_O_IM , Sim_ReadRegister(DIO_PORTB_BASE + GPIO_O_IM) & ~(uint32)GPIO_PIN_3);
+	Sim_WriteRegister(DIO_PORTB_BASE + GPIO_O_ICR , GPIO_PIN_3);
+	GPIOPinTypeGPIOOutput(DIO_PORTB_BASE , GPIO_PIN_3);
+	
+	Dio_StopEdgeCapture();
+}
+
+#endif /* DioEdgeCaptureApi */
+
+#if (DioVirtualGroupApi == STD_ON)
+
+/* Number of writes of the skew comparison */
+#define VIRTUAL_WRITES		(100000u)
+
+/* Bus accesses between the port B and port E stores of the last write */
+static uint32 PortSkew(void)
+{
+	return (Sim_GetLastWriteSequence(DIO_PORTE_BASE) - Sim_GetLastWriteSequence(DIO_PORTB_BASE) - 1u);
+}
+
+/* Writes the 8-bit bus spread over PB0..3 and PE0..3, reports the skew between the two ports */
+static void RunVirtualGroup(void)
+{
+	Dio_VirtualGroupLevelType Value;
+	uint32 Write;
+	uint32 Skew;
+	uint32 WorstVirtual = 0u;
+	uint32 WorstPorts = 0u;
+	uint32 Masks;
+	uint32 Mismatches = 0u;
+	
+	Sim_ResetCounters();
+	Masks = Sim_GetIntMaskCount();
+	
+	for(Write = 0u; Write < VIRTUAL_WRITES; Write++)
+	{
+		Value = (Dio_VirtualGroupLevelType)(Write & 0xFFu);
+		
+		Dio_WriteVirtualGroup(&VirtualGroup[0] , Value);
+		
+		Skew = PortSkew();
+		WorstVirtual = (Skew > WorstVirtual) ? Skew : WorstVirtual;
+		
+		if(Value != Dio_ReadVirtualGroup(&VirtualGroup[0]))
+		{
+			Mismatches++;
+		}
+	}
+	
+	printf("\nVirtual group BUS8 (PB0..3, PE0..3): %lu writes, %lu read back mismatches\n",
+		   (unsigned long)VIRTUAL_WRITES, (unsigned long)Mismatches);
+	printf("Interrupt mask windows per write + read: %.2f, register reads / writes per pair: %.2f / %.2f\n",
+		   (double)(Sim_GetIntMaskCount() - Masks) / (double)VIRTUAL_WRITES,
+		   (double)Sim_GetTotalReads()  / (double)VIRTUAL_WRITES,
+		   (double)Sim_GetTotalWrites() / (double)VIRTUAL_WRITES);
+	
+	/* Same value composed of two port writes, each port is read modified written on its own */
+	for(Write = 0u; Write < VIRTUAL_WRITES; Write++)
+	{
+		Value = (Dio_VirtualGroupLevelType)(Write & 0xFFu);
+		
+		Dio_WritePort(BUS8_PORT_LOW  , (Dio_PortLevelType)((Dio_ReadPort(BUS8_PORT_LOW)  & 0xF0u) | (Value & 0x0Fu)));
+		Dio_WritePort(BUS8_PORT_HIGH , (Dio_PortLevelType)((Dio_ReadPort(BUS8_PORT_HIGH) & 0xF0u) | (Value >> 4u)));
+		
+		Skew = PortSkew();
+		WorstPorts = (Skew > WorstPorts) ? Skew : WorstPorts;
+	}
+	
+	printf("Worst case skew PB -> PE store: %lu bus accesses (virtual group), %lu (2 x Dio_WritePort)\n",
+		   (unsigned long)WorstVirtual, (unsigned long)WorstPorts);
+}
+
+#endif /* DioVirtualGroupApi */
+
+#if (DioExpanderApi == STD_ON)
+
+/* Dio_MainFunction cycles of the expander comparison */
+#define EXPANDER_CYCLES		(10000u)
+
+/* Accesses of one application cycle: the four relays, a relay read back and the DIP switch */
+static void ExpanderCycle(uint32 Cycle)
+{
+	Dio_WriteChannel(RELAY1 , (Dio_LevelType)((Cycle >> 0u) & 1u));
+	Dio_WriteChannel(RELAY2 , (Dio_LevelType)((Cycle >> 1u) & 1u));
+	Dio_WriteChannel(RELAY3 , (Dio_LevelType)((Cycle >> 2u) & 1u));
+	Dio_WriteChannel(RELAY4 , (Dio_LevelType)((Cycle >> 3u) & 1u));
+	
+	Level	  = Dio_ReadChannel(RELAY1);
+	Level	  = Dio_ReadChannel(DIPSWITCH1);
+	PortLevel = Dio_ReadPort(DIPSWITCH_PORT);
+}
+
+/* Same accesses through a per-pin driver, one transaction of one port per access */
+static void ExpanderCyclePerPin(uint32 Cycle)
+{
+	uint8 Latch = (uint8)(Cycle & 0x0Fu);
+	uint8 Data;
+	uint8 Pin;
+	
+	for(Pin = 0u; Pin < 4u; Pin++)
+	{
+		(void)Dio_ExpanderWrite(DIO_CFG_EXPANDER0_ADDRESS , &Latch , 1u);
+	}
+	
+	for(Pin = 0u; Pin < 3u; Pin++)
+	{
+		(void)Dio_ExpanderRead(DIO_CFG_EXPANDER0_ADDRESS , &Data , 1u);
+	}
+}
+
+/* Transactions and bus bits per cycle of the Dio expander backend against a per-pin driver */
+static void RunExpander(void)
+{
+	static const uint8 OutputMask[2] = { DIO_CFG_PORT_EXP0_A_OUTPUT_MASK , DIO_CFG_PORT_EXP0_B_OUTPUT_MASK };
+	uint32 Cycle;
+	uint32 Transactions;
+	uint32 BusBits;
+	uint32 ServiceBus = 0u;
+	uint32 Before;
+	
+	(void)Dio_ExpanderSetDirection(DIO_CFG_EXPANDER0_ADDRESS , OutputMask , 2u);
+	Sim_ExpanderSetPinInput(DIO_CFG_EXPANDER0_ADDRESS , 1u , 0xFFu , 0x5Au);
+	
+	Sim_ExpanderResetCounters();
+	
+	for(Cycle = 0u; Cycle < EXPANDER_CYCLES; Cycle++)
+	{
+		ExpanderCyclePerPin(Cycle);
+	}
+	
+	Transactions = Sim_GetExpanderWrites() + Sim_GetExpanderReads();
+	BusBits		 = Sim_GetExpanderBusBits();
+	
+	Sim_ExpanderResetCounters();
+	
+	for(Cycle = 0u; Cycle < EXPANDER_CYCLES; Cycle++)
+	{
+		/* The relays change every second cycle */
+		Before = Sim_GetExpanderWrites() + Sim_GetExpanderReads();
+		ExpanderCycle(Cycle >> 1u);
+		ServiceBus += (Sim_GetExpanderWrites() + Sim_GetExpanderReads()) - Before;
+		Dio_MainFunction();
+	}
+	
+	printf("\nExpander cycle (4 relay writes, 3 reads): per-pin driver %.2f transactions / %.0f bus bits\n",
+		   (double)Transactions / (double)EXPANDER_CYCLES, (double)BusBits / (double)EXPANDER_CYCLES);
+	printf("Dio expander backend: %.2f writes + %.2f reads / %.0f bus bits, %.2f transactions saved per cycle\n",
+		   (double)Sim_GetExpanderWrites() / (double)EXPANDER_CYCLES,
+		   (double)Sim_GetExpanderReads()  / (double)EXPANDER_CYCLES,
+		   (double)Sim_GetExpanderBusBits() / (double)EXPANDER_CYCLES,
+		   (double)(Transactions - Sim_GetExpanderWrites() - Sim_GetExpanderReads()) / (double)EXPANDER_CYCLES);
+	printf("Bus transactions inside the Dio services: %lu, DIP switch port read 0x%02X\n",
+		   (unsigned long)ServiceBus, (unsigned int)PortLevel);
+	
+	/* Cycles which only touch output pins request no read */
+	Sim_ExpanderResetCounters();
+	
+	for(Cycle = 0u; Cycle < EXPANDER_CYCLES; Cycle++)
+	{
+		Dio_WriteChannel(RELAY1 , (Dio_LevelType)(Cycle & 1u));
+		Level = Dio_ReadChannel(RELAY1);
+		Dio_MainFunction();
+	}
+	
+	printf("Cycles without input reads: %.2f reads per cycle\n",
+		   (double)Sim_GetExpanderReads() / (double)EXPANDER_CYCLES);
+}
+
+#endif /* DioExpanderApi */
+
+#ifdef REGISTER_TRACE
+
+/* Virtual ticks between two steps of the traced sequence */
+#define TRACE_STEP			(800u)
+
+/* Records a short LED sequence and saves it for the VCD converter */
+static void RunTrace(void)
+{
+	uint32 Step;
+	
+	Trace_Reset();
+	
+	for(Step = 0u; Step < 8u; Step++)
+	{
+		Dio_WriteChannel(LED1 , ((0u != (Step & 1u)) ? STD_HIGH : STD_LOW));
+		Sim_AdvanceTime(TRACE_STEP);
+		
+		if(0u == (Step & 3u))
+		{
+			Dio_WriteChannelGroup(&ChannelGroup[1] , (Dio_PortLevelType)Step);
+			Sim_AdvanceTime(TRACE_STEP / 4u);
+		}
+#if (DioFlipChannelApi == STD_ON)
+		(void)Dio_FlipChannel(LED3);
+#endif
+		Sim_AdvanceTime(TRACE_STEP);
+	}
+	
+	printf("\nTrace: %lu register writes recorded, %s\n", (unsigned long)Trace_Buffer.Index,
+		   (E_OK == Trace_Save("DioSim.trace")) ? "saved to DioSim.trace" : "DioSim.trace not written");
+}
+
+#endif /* REGISTER_TRACE */
+
+int main(void)
+{
+	struct timespec Start, End;
+	double Ns;
+	uint32 BenchIndex;
+	uint32 Iteration;
+
+	Sim_Reset();
+
+#if (DioAhbAperture == STD_ON)
+	/* Move the configured ports to AHB before their pins are set up */
+	Dio_EnableAhbAperture();
+#endif
+
+	/* Same pin setup as the DioTest application, on the aperture the driver uses */
+	GPIOPinTypeGPIOOutput(DIO_PORTB_BASE , GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 |
+											GPIO_PIN_4 | GPIO_PIN_5 | GPIO_PIN_6);
+#if (DioVirtualGroupApi == STD_ON)
+	GPIOPinTypeGPIOOutput(DIO_PORTE_BASE , GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+#endif
+
+#if (DioDirectionShadow == STD_ON)
+	/* Reload the direction shadow after the pin setup, as a Port driver would */
+	Dio_RefreshPortDirection(LED1_PORT);
+#if (DioVirtualGroupApi == STD_ON)
+	Dio_RefreshPortDirection(BUS8_PORT_HIGH);
+#endif
+#endif
+
+	printf("Port B aperture: %s (0x%08lX)\n\n", (DIO_PORTB_BASE == GPIO_PORTB_BASE) ? "APB" : "AHB",
+		   (unsigned long)DIO_PORTB_BASE);
+
+	printf("%-26s %10s %12s %12s\n", "API", "ns/call", "reads/call", "writes/call");
+
+	for(BenchIndex = 0; BenchIndex < (sizeof(Benches) / sizeof(Benches[0])); BenchIndex++)
+	{
+		Sim_ResetCounters();
+
+		clock_gettime(CLOCK_MONOTONIC, &Start);
+
+		for(Iteration = 0; Iteration < BENCH_ITERATIONS; Iteration++)
+		{
+			Benches[BenchIndex].Run();
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &End);
+
+		Ns = ((double)(End.tv_sec - Start.tv_sec) * 1e9 + (double)(End.tv_nsec - Start.tv_nsec)) / BENCH_ITERATIONS;
+
+		printf("%-26s %10.1f %12.2f %12.2f\n", Benches[BenchIndex].Name, Ns,
+			   (double)Sim_GetTotalReads()  / BENCH_ITERATIONS,
+			   (double)Sim_GetTotalWrites() / BENCH_ITERATIONS);
+	}
+
+#if (DioPatternApi == STD_ON)
+	RunPattern();
+#endif
+
+#if (DioEdgeCaptureApi == STD_ON)
+	RunEdgeCapture();
+#endif
+
+#if (DioVirtualGroupApi == STD_ON)
+	RunVirtualGroup();
+#endif
+
+#if (DioExpanderApi == STD_ON)
+	RunExpander();
+#endif
+
+#ifdef REGISTER_TRACE
+	RunTrace();
+#endif
+
+	/* Accesses through the aperture a port is not selected for are lost on target */
+	printf("\nAperture faults: %lu\n", (unsigned long)Sim_GetApertureFaults());
+
+	return 0;
+}
@@ -9,6 +9,7 @@
 #include "i2c.h"
 #include "pin_map.h"
 #include "Dio.h"
+#include "Dio_Expander.h"
 Std_ReturnType X ,Y , Z;
 	
 volatile uint8 A = 0b10010100;
@@ -28,6 +29,9 @@ int main(void)
 		
 		SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
 		SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
+		SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
+		SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+		SysCtlPeripheralEnable(SYSCTL_PERIPH_I2C1);
 		
 		GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE , GPIO_PIN_0);
 		GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE , GPIO_PIN_1);
@@ -42,6 +46,22 @@ int main(void)
 		GPIOPinTypeGPIOOutput(GPIO_PORTB_BASE , GPIO_PIN_5);
 		GPIOPinTypeGPIOOutput(GPIO_PORTB_BASE , GPIO_PIN_6);
 	//	GPIOPinTypeGPIOOutput(GPIO_PORTB_BASE , GPIO_PIN_7);
+
+		/* High nibble of the BUS8 virtual group */
+		GPIOPinTypeGPIOOutput(GPIO_PORTE_BASE , GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+		
+		/* I2C1 on PA6/PA7 drives the MCP23017 port expander */
+		GPIOPinConfigure(GPIO_PA6_I2C1SCL);
+		GPIOPinConfigure(GPIO_PA7_I2C1SDA);
+		GPIOPinTypeI2CSCL(GPIO_PORTA_BASE , GPIO_PIN_6);
+		GPIOPinTypeI2C(GPIO_PORTA_BASE , GPIO_PIN_7);
+		I2CMasterInitExpClk(I2C1_BASE , SysCtlClockGet() , true);
+		
+		{
+			const uint8 ExpanderOutputs[2] = {DIO_CFG_PORT_EXP0_A_OUTPUT_MASK , DIO_CFG_PORT_EXP0_B_OUTPUT_MASK};
+			
+			(void)Dio_ExpanderSetDirection(DIO_CFG_EXPANDER0_ADDRESS , ExpanderOutputs , 2u);
+		}
 		
 		//GPIOPinTypeGPIOInput(GPIO_PORTF_BASE , GPIO_PIN_6);
 	
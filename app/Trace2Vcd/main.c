@@ -0,0 +1,263 @@
+/*
+	Converts a register write trace (TRACE/Trace.h) into a VCD waveform.
+
+	The input is a raw image of Trace_Buffer, saved with Trace_Save() by the
+	host simulation or dumped by the debugger on target, e.g. in uVision:
+
+		SAVE trace.hex &Trace_Buffer, ((char*)&Trace_Buffer + sizeof(Trace_Buffer) - 1)
+
+	(converted to binary), or with GDB:
+
+		dump binary value trace.bin Trace_Buffer
+
+	Every write to a GPIODATA masked address updates the written pins, each pin
+	that was written at least once becomes a wire (PB4, PF1, ...) in the VCD.
+	Both the APB and the AHB aperture of a port are decoded.
+
+	Build and run from this folder:
+
+	gcc -O2 -I../../AUTOSAR/TRACE -I../../AUTOSAR/BSW/GeneralTypes -I../../AUTOSAR/SIM \
+		main.c -o Trace2Vcd && ./Trace2Vcd DioSim.trace DioSim.vcd
+*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "hw_memmap.h"
+#include "Trace.h"
+
+/* GPIO ports A..F, pins per port */
+#define NUM_OF_PORTS		(6u)
+#define PORT_WIDTH			(8u)
+
+/* GPIODATA masked aperture of a port, the address bits [9:2] select the written pins */
+#define DATA_ALIAS_SIZE		(0x400u)
+
+/* Header of a trace dump, the records follow */
+typedef struct
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t Size;
+	uint32_t ClockHz;
+	uint32_t Index;
+}TraceHeaderType;
+
+static const uint32_t PortBase[NUM_OF_PORTS] =
+{
+	GPIO_PORTA_BASE, GPIO_PORTB_BASE, GPIO_PORTC_BASE,
+	GPIO_PORTD_BASE, GPIO_PORTE_BASE, GPIO_PORTF_BASE
+};
+
+static const uint32_t PortAhbBase[NUM_OF_PORTS] =
+{
+	GPIO_PORTA_AHB_BASE, GPIO_PORTB_AHB_BASE, GPIO_PORTC_AHB_BASE,
+	GPIO_PORTD_AHB_BASE, GPIO_PORTE_AHB_BASE, GPIO_PORTF_AHB_BASE
+};
+
+/* Finds the port and written pins of a GPIODATA write, returns 0 for any other register */
+static int DecodeDataWrite(uint32_t Address, uint32_t* Port, uint8_t* Mask)
+{
+	uint32_t Index;
+	uint32_t Offset;
+	
+	for(Index = 0u; Index < NUM_OF_PORTS; Index++)
+	{
+		if((Address >= PortBase[Index]) && (Address < (PortBase[Index] + DATA_ALIAS_SIZE)))
+		{
+			Offset = Address - PortBase[Index];
+		}
+		else if((Address >= PortAhbBase[Index]) && (Address < (PortAhbBase[Index] + DATA_ALIAS_SIZE)))
+		{
+			Offset = Address - PortAhbBase[Index];
+		}
+		else
+		{
+			continue;
+		}
+		
+		*Port = Index;
+		*Mask = (uint8_t)(Offset >> 2u);
+		
+		return 1;
+	}
+	
+	return 0;
+}
+
+/* VCD identifier of a pin */
+static char PinId(uint32_t Port, uint32_t Pin)
+{
+	return (char)('!' + (Port * PORT_WIDTH) + Pin);
+}
+
+int main(int argc, char* argv[])
+{
+	TraceHeaderType Header;
+	static Trace_RecordType Records[0x10000u];
+	FILE* In;
+	FILE* Out = stdout;
+	uint32_t Count;
+	uint32_t First;
+	uint32_t Step;
+	uint32_t Port;
+	uint32_t Pin;
+	uint8_t  Mask;
+	uint8_t  Used[NUM_OF_PORTS] = { 0u };
+	uint8_t  Known[NUM_OF_PORTS] = { 0u };
+	uint8_t  Level[NUM_OF_PORTS] = { 0u };
+	uint8_t  NewLevel;
+	uint8_t  Value;
+	uint64_t Ticks = 0u;
+	uint64_t Time;
+	uint64_t LastTime = 0u;
+	uint32_t Written = 0u;
+	
+	if((argc < 2) || (argc > 3))
+	{
+		fprintf(stderr, "usage: %s <trace file> [<vcd file>]\n", argv[0]);
+		return 2;
+	}
+	
+	In = fopen(argv[1], "rb");
+	
+	if(NULL == In)
+	{
+		fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+		return 1;
+	}
+	
+	if((1u != fread(&Header, sizeof(Header), 1u, In)) || (TRACE_MAGIC != Header.Magic) ||
+	   (TRACE_VERSION != Header.Version) || (0u == Header.Size) || (Header.Size > 0x10000u) ||
+	   (0u != (Header.Size & (Header.Size - 1u))) || (0u == Header.ClockHz))
+	{
+		fprintf(stderr, "%s: %s is not a register trace\n", argv[0], argv[1]);
+		fclose(In);
+		return 1;
+	}
+	
+	if(Header.Size != fread(Records, sizeof(Trace_RecordType), Header.Size, In))
+	{
+		fprintf(stderr, "%s: %s is truncated\n", argv[0], argv[1]);
+		fclose(In);
+		return 1;
+	}
+	
+	fclose(In);
+	
+	/* The ring holds the last Size records once it has wrapped */
+	Count = (Header.Index < Header.Size) ? Header.Index : Header.Size;
+	First = Header.Index - Count;
+	
+	for(Step = 0u; Step < Count; Step++)
+	{
+		if(0 != DecodeDataWrite(Records[(First + Step) & (Header.Size - 1u)].Address, &Port, &Mask))
+		{
+			Used[Port] |= Mask;
+		}
+	}
+	
+	if(3 == argc)
+	{
+		Out = fopen(argv[2], "w");
+		
+		if(NULL == Out)
+		{
+			fprintf(stderr, "%s: cannot create %s\n", argv[0], argv[2]);
+			return 1;
+		}
+	}
+	
+	fprintf(Out, "$version Trace2Vcd, %u of %u writes, %u Hz $end\n", (unsigned)Count, 
+			(unsigned)Header.Index, (unsigned)Header.ClockHz);
+	fprintf(Out, "$timescale 1ns $end\n$scope module gpio $end\n");
+	
+	for(Port = 0u; Port < NUM_OF_PORTS; Port++)
+	{
+		for(Pin = 0u; Pin < PORT_WIDTH; Pin++)
+		{
+			if(0u != (Used[Port] & (1u << Pin)))
+			{
+				fprintf(Out, "$var wire 1 %c P%c%u $end\n", PinId(Port, Pin), (char)('A' + Port), (unsigned)Pin);
+			}
+		}
+	}
+	
+	fprintf(Out, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+	
+	/* Unknown until the first write */
+	for(Port = 0u; Port < NUM_OF_PORTS; Port++)
+	{
+		for(Pin = 0u; Pin < PORT_WIDTH; Pin++)
+		{
+			if(0u != (Used[Port] & (1u << Pin)))
+			{
+				fprintf(Out, "x%c\n", PinId(Port, Pin));
+			}
+		}
+	}
+	
+	fprintf(Out, "$end\n");
+	
+	for(Step = 0u; Step < Count; Step++)
+	{
+		const Trace_RecordType* Record = &Records[(First + Step) & (Header.Size - 1u)];
+		const Trace_RecordType* Previous = &Records[(First + Step - 1u) & (Header.Size - 1u)];
+		
+		/* Unwrap the 32-bit counter, records claimed by an interrupt may be a little older */
+		if(0u != Step)
+		{
+			Ticks += (uint64_t)(int64_t)(int32_t)(Record->Timestamp - Previous->Timestamp);
+		}
+		else
+		{
+			Ticks = Record->Timestamp;
+		}
+		
+		if(0 == DecodeDataWrite(Record->Address, &Port, &Mask))
+		{
+			continue;
+		}
+		
+		/* Whole seconds apart, so long traces don't overflow */
+		Time = ((Ticks / Header.ClockHz) * 1000000000u) + (((Ticks % Header.ClockHz) * 1000000000u) / Header.ClockHz);
+		
+		if(Time < LastTime)
+		{
+			Time = LastTime;
+		}
+		
+		/* A GPIODATA write only drives the 8 pins of the port */
+		Value	 = (uint8_t)(Record->Value & 0xFFu);
+		NewLevel = (uint8_t)((Level[Port] & (uint8_t)(~Mask)) | (Value & Mask));
+		
+		for(Pin = 0u; Pin < PORT_WIDTH; Pin++)
+		{
+			if((0u != (Mask & (1u << Pin))) && 
+			   ((0u == (Known[Port] & (1u << Pin))) || (((Level[Port] ^ NewLevel) & (1u << Pin)) != 0u)))
+			{
+				/* #0 is written with the initial values */
+				if(Time != LastTime)
+				{
+					fprintf(Out, "#%llu\n", (unsigned long long)Time);
+					
+					LastTime = Time;
+				}
+				
+				fprintf(Out, "%c%c\n", (0u != (NewLevel & (1u << Pin))) ? '1' : '0', PinId(Port, Pin));
+			}
+		}
+		
+		Level[Port]  = NewLevel;
+		Known[Port] |= Mask;
+		Written++;
+	}
+	
+	if(stdout != Out)
+	{
+		fclose(Out);
+	}
+	
+	fprintf(stderr, "%u GPIODATA writes of %u records converted\n", (unsigned)Written, (unsigned)Count);
+	
+	return 0;
+}
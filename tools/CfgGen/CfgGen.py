@@ -0,0 +1,1747 @@
+#!/usr/bin/env python3
+"""
+Configuration generator of the Dio, CanIf and Dcm modules.
+
+Reads the ECU description (Ecu.json next to this script by default), validates
+it and emits the pre-compile and link time configuration files of the modules:
+
+    AUTOSAR/BSW/MCAL/DIO/gen/Dio_Cfg.h, Dio_Lcfg.c
+    AUTOSAR/BSW/ECUAL/CanIf/gen/CanIf_Cfg.h, CanIf_Cfg.c
+    AUTOSAR/Service/DCM/gen/Dcm_Cfg.h, Dcm_Lcfg.c
+
+Everything the drivers would otherwise search for at run time is resolved here:
+the Dio channel decode table, the CanIf Rx CAN ID table sorted per hardware
+receive handle with the HOH to HRH table, the Dcm SID index table and the sizes
+of the CanIf Rx data buffer and the Dcm request / response buffers.
+
+All configuration errors are collected and reported together, nothing is
+written if there is one. Files are only rewritten when their content changes.
+
+    CfgGen.py [--check] [--root DIR] [CONFIG]
+
+--check reports the files which are out of date instead of writing them and
+exits with 1 if there is one, for use in the build.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_CONFIG = os.path.join(SCRIPT_DIR, "Ecu.json")
+DEFAULT_ROOT = os.path.normpath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+GENERATED_NOTE = "/* Generated by tools/CfgGen/CfgGen.py from {0}, changes are lost on the next generation */"
+
+C_IDENTIFIER = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+
+class ConfigError(Exception):
+    pass
+
+
+class Errors(object):
+    """Collects the configuration errors, so all of them are reported in one run."""
+
+    def __init__(self):
+        self.List = []
+
+    def add(self, Where, Text):
+        self.List.append("{0}: {1}".format(Where, Text))
+
+    def __len__(self):
+        return len(self.List)
+
+
+##################################################################################
+#                                  Helpers                                       #
+##################################################################################
+
+def to_int(Value, Where, Err):
+    """Integer from a JSON number or a "0x.." string, None (and an error) otherwise."""
+    if isinstance(Value, bool):
+        Err.add(Where, "expected an integer, got {0!r}".format(Value))
+        return None
+    if isinstance(Value, int):
+        return Value
+    if isinstance(Value, str):
+        try:
+            return int(Value, 0)
+        except ValueError:
+            pass
+    Err.add(Where, "expected an integer, got {0!r}".format(Value))
+    return None
+
+
+def popcount(Value):
+    return bin(Value).count("1")
+
+
+def lowest_bit(Value):
+    return (Value & -Value).bit_length() - 1
+
+
+def is_contiguous(Mask):
+    return (Mask != 0) and (((Mask >> lowest_bit(Mask)) + 1) & (Mask >> lowest_bit(Mask))) == 0
+
+
+def hex8(Value):
+    return "0x{0:02X}".format(Value)
+
+
+def tab_pad(Text, Column):
+    """Text followed by the tabs (4 columns wide) reaching Column, at least one."""
+    Tabs = 1
+    Width = (len(Text) // 4 + 1) * 4
+    while Width < Column:
+        Width += 4
+        Tabs += 1
+    return Text + "\t" * Tabs
+
+
+def aligned_defines(Pairs):
+    """#define lines of (name, value) pairs with the values aligned on one tab stop."""
+    Column = max(len("#define " + Name) for Name, _ in Pairs) // 4 * 4 + 4
+    return [tab_pad("#define " + Name, Column) + Value for Name, Value in Pairs]
+
+
+def std(Value):
+    return "STD_ON" if Value else "STD_OFF"
+
+
+def check_identifier(Name, Where, Err):
+    if not isinstance(Name, str) or not C_IDENTIFIER.match(Name):
+        Err.add(Where, "{0!r} is not a C identifier".format(Name))
+        return False
+    return True
+
+
+def check_unique(Items, Key, Where, Err):
+    Seen = set()
+    for Item in Items:
+        Value = Item.get(Key)
+        if Value in Seen:
+            Err.add(Where, "duplicate {0} {1!r}".format(Key, Value))
+        Seen.add(Value)
+
+
+def banner(FileName, Description, Specification, Date):
+    """File header of the repository, generated files may not be changed by the user."""
+    def row(Text):
+        # The right border is at column 80 with 4 column tabs, as in the hand written headers
+        while len(Text.expandtabs(4)) < 80:
+            Text += "\t"
+        return Text + " **"
+    Lines = [
+        "/**********************************************************************************",
+        "***********************************************************************************",
+        "**\t\t\t\t\t\t\t\t\t\t\t\t\t\t  \t\t\t\t\t\t **\t\t",
+        row("**\tFILENAME\t:\t" + FileName),
+        "**\t                                                      \t\t\t\t\t\t **",
+        row("**\tVERSION\t\t: \t1.0.0"),
+        "**                                                        \t\t\t\t\t\t **",
+        row("**\tDATE\t\t:\t" + Date),
+        "**                                                        \t\t\t\t\t\t **",
+        row("**\tPLATFORM\t:\tTIVA C"),
+        "**\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t **",
+        "**  VARIANT  \t: \tNA                                                           **",
+        "**                                                        \t\t\t\t\t\t **",
+        row("**\tAUTHOR\t\t:  \tMohamedSayed"),
+        "**                                                        \t\t\t\t\t\t **",
+        "**\tVENDOR\t\t: \tNA\t\t\t\t                     \t\t\t\t\t\t **",
+        "**                                                        \t\t\t\t\t\t **",
+        "**\t                                                      \t\t\t\t\t\t **",
+        row("**\tDESCRIPTION : " + Description),
+        "**                                                                               **",
+        row("**\tSPECIFICATION(S) : " + Specification),
+        "**                                                       \t\t\t\t\t\t **",
+        row("**\tMAY BE CHANGED BY USER : No"),
+        "**                                                       \t\t\t\t\t     **",
+        "***********************************************************************************/",
+    ]
+    return "\n".join(Lines) + "\n"
+
+
+def struct_rows(Rows, Indent="\t"):
+    """Positional initializers of a table, one brace block per entry as in the hand written tables."""
+    Blocks = []
+    for Comment, Fields in Rows:
+        Block = []
+        if Comment:
+            Block.append(Indent + "/* " + Comment + " */")
+        Block.append(Indent + "{")
+        Block.append(",\n".join(Indent + "\t" + Field for Field in Fields))
+        Block.append(Indent + "}")
+        Blocks.append("\n".join(Block))
+    return ",\n".join(Blocks)
+
+
+##################################################################################
+#                                    Dio                                         #
+##################################################################################
+
+DIO_SPEC = "AUTOSAR_SWS_DIODriver, AUTOSAR Release 4.3.1"
+
+DIO_MCU_PORTS = "ABCDEF"
+DIO_MAX_CHANNEL_ID = 0x53
+DIO_MAX_PORT_ID = 5
+DIO_MAX_PORT_IDS = 16
+
+# Pre-compile switches of the driver, in the order of Dio_Cfg.h, with their documentation
+DIO_SWITCHES = [
+    ("DioDevErrorDetect",
+     ["development error detection and Notification"]),
+    ("DioFlipChannelApi",
+     ["Adds / removes the service Dio_FlipChannel() from the code"]),
+    ("DioVersionInfoApi",
+     ["Adds / removes the service Dio_ GetVersionInfo() from the code"]),
+    ("DioWriteChannelListApi",
+     ["Adds / removes the service Dio_WriteChannelList() from the code"]),
+    ("DioDirectionShadow",
+     ["Write services take the output pins from a RAM shadow of the direction registers",
+      "instead of reading GPIO_O_DIR on every call, adds the service Dio_RefreshPortDirection()"]),
+    ("DioStaticChannelApi",
+     ["Adds / removes the compile time resolved Dio_ReadChannelStatic() / Dio_WriteChannelStatic()"]),
+    ("DioAhbAperture",
+     ["Accesses the ports of DIO_CFG_AHB_PORT_MASK through the AHB aperture instead of APB,",
+      "adds the service Dio_EnableAhbAperture() which shall be called before any other access",
+      "to these ports (the APB aperture of a port moved to AHB does not respond)"]),
+    ("DioPatternApi",
+     ["Adds / removes the timer triggered uDMA pattern engine Dio_StartPattern() / Dio_StopPattern(),",
+      "the uDMA controller shall be enabled and its control table set by the integration code"]),
+    ("DioInputSnapshotApi",
+     ["Adds / removes the periodic input snapshot Dio_MainFunction() with per-channel debouncing,",
+      "and the snapshot reads Dio_ReadChannelSnapshot() / Dio_ReadPortSnapshot() / Dio_ReadPortChanged()"]),
+    ("DioEdgeCaptureApi",
+     ["Adds / removes the GPIO interrupt edge capture Dio_StartEdgeCapture() / Dio_ReadEdgeEvents(),",
+      "Dio_EdgeIsr() shall be registered on the interrupt of every port of the edge configuration"]),
+    ("DioVirtualGroupApi",
+     ["Adds / removes the multi-port virtual channel groups Dio_ReadVirtualGroup() / Dio_WriteVirtualGroup(),",
+      "the ports of a group are accessed back to back inside the exclusive area"]),
+    ("DioExpanderApi",
+     ["Adds / removes the port expander backend, the port IDs above DIO_MAX_PORT_ID are the ports",
+      "of the expanders of the configuration. Writes are kept in a RAM shadow and committed by",
+      "Dio_MainFunction() with one bus transaction per changed expander. A read service which needs",
+      "input pins requests a read of their expander by the next Dio_MainFunction() and returns the",
+      "levels of the last read, expanders whose inputs are not read cost no transaction"]),
+]
+
+DIO_EDGES = {"RISING": "DIO_EDGE_RISING", "FALLING": "DIO_EDGE_FALLING", "BOTH": "DIO_EDGE_BOTH"}
+
+
+class DioPort(object):
+    def __init__(self, PortId, Symbol, Expander=None, Letter=None):
+        self.PortId = PortId
+        self.Symbol = Symbol
+        self.Expander = Expander
+        self.Letter = Letter
+        self.OutputMask = 0
+        self.ChannelMask = 0
+
+    @property
+    def IsExpander(self):
+        return self.Expander is not None
+
+    @property
+    def Base(self):
+        return "DIO_PORT{0}_BASE".format(self.Letter)
+
+
+class DioModel(object):
+    """Dio configuration resolved to ports, pins and masks."""
+
+    def __init__(self, Cfg, Err):
+        self.Cfg = Cfg
+        self.Err = Err
+        self.Switches = {}
+        self.Ports = {}
+        self.PortList = []
+        self.Aliases = []
+        self.Channels = []
+        self.Groups = []
+        self.VirtualGroups = []
+        self.Expanders = []
+
+        self.load_switches()
+        self.load_ports()
+        self.load_aliases()
+        self.load_channels()
+        self.load_groups()
+        self.load_virtual_groups()
+        self.load_features()
+
+    # ---------------------------------------------------------------- loading
+
+    def load_switches(self):
+        Switches = self.Cfg.get("Switches", {})
+        Known = [Name for Name, _ in DIO_SWITCHES]
+        for Name in Switches:
+            if Name not in Known:
+                self.Err.add("Dio.Switches", "unknown switch {0!r}".format(Name))
+        for Name in Known:
+            Value = Switches.get(Name)
+            if not isinstance(Value, bool):
+                self.Err.add("Dio.Switches." + Name, "shall be true or false")
+                Value = False
+            self.Switches[Name] = Value
+
+    def load_ports(self):
+        for Index, Letter in enumerate(DIO_MCU_PORTS):
+            Port = DioPort(Index, "DIO_PORT_" + Letter, Letter=Letter)
+            self.Ports[Letter] = Port
+            self.PortList.append(Port)
+
+        Outputs = self.Cfg.get("PortOutputs", {})
+        for Letter, Value in Outputs.items():
+            Where = "Dio.PortOutputs." + Letter
+            if Letter not in DIO_MCU_PORTS:
+                self.Err.add(Where, "unknown port")
+                continue
+            Mask = to_int(Value, Where, self.Err)
+            if Mask is not None and not (0 <= Mask <= 0xFF):
+                self.Err.add(Where, "output mask out of range")
+            elif Mask is not None:
+                self.Ports[Letter].OutputMask = Mask
+
+        Expanders = self.Cfg.get("Expanders", [])
+        check_unique(Expanders, "Name", "Dio.Expanders", self.Err)
+        Addresses = set()
+        PortId = DIO_MAX_PORT_ID + 1
+        for Index, Exp in enumerate(Expanders):
+            Where = "Dio.Expanders[{0}]".format(Index)
+            check_identifier(Exp.get("Name"), Where + ".Name", self.Err)
+            Address = to_int(Exp.get("Address"), Where + ".Address", self.Err)
+            if Address is not None:
+                if not (0x08 <= Address <= 0x77):
+                    self.Err.add(Where + ".Address", "{0} is not a 7-bit device address".format(hex8(Address)))
+                if Address in Addresses:
+                    self.Err.add(Where + ".Address", "{0} is used by another expander".format(hex8(Address)))
+                Addresses.add(Address)
+            for Key in ("Write", "Read"):
+                check_identifier(Exp.get(Key, "Dio_Expander" + Key), Where + "." + Key, self.Err)
+            Ports = Exp.get("Ports", [])
+            if not Ports:
+                self.Err.add(Where + ".Ports", "an expander needs at least one port")
+            check_unique(Ports, "Name", Where + ".Ports", self.Err)
+            Entry = {"Name": Exp.get("Name", "EXP{0}".format(Index)), "Address": Address or 0,
+                     "Comment": Exp.get("Comment"), "PortsComment": Exp.get("PortsComment"),
+                     "Write": Exp.get("Write", "Dio_ExpanderWrite"), "Read": Exp.get("Read", "Dio_ExpanderRead"),
+                     "FirstPort": PortId - (DIO_MAX_PORT_ID + 1), "Ports": []}
+            for PortIndex, PortCfg in enumerate(Ports):
+                PortWhere = "{0}.Ports[{1}]".format(Where, PortIndex)
+                Name = "{0}_{1}".format(Entry["Name"], PortCfg.get("Name"))
+                check_identifier(Name, PortWhere + ".Name", self.Err)
+                Port = DioPort(PortId, "DIO_PORT_" + Name, Expander=Index)
+                Port.Name = Name
+                Mask = to_int(PortCfg.get("Outputs", 0), PortWhere + ".Outputs", self.Err)
+                if Mask is not None and not (0 <= Mask <= 0xFF):
+                    self.Err.add(PortWhere + ".Outputs", "output mask out of range")
+                elif Mask is not None:
+                    Port.OutputMask = Mask
+                self.Ports[Name] = Port
+                self.PortList.append(Port)
+                Entry["Ports"].append(Port)
+                PortId += 1
+            self.Expanders.append(Entry)
+
+        if PortId > DIO_MAX_PORT_IDS:
+            self.Err.add("Dio.Expanders", "{0} expander ports exceed the channel ID range of {1} ports".format(
+                PortId - (DIO_MAX_PORT_ID + 1), DIO_MAX_PORT_IDS - (DIO_MAX_PORT_ID + 1)))
+        if len(self.Expanders) > 32:
+            self.Err.add("Dio.Expanders", "at most 32 expanders are supported")
+
+        Ahb = self.Cfg.get("AhbPorts", [])
+        self.AhbMask = 0
+        for Letter in Ahb:
+            if Letter not in DIO_MCU_PORTS:
+                self.Err.add("Dio.AhbPorts", "{0!r} is not a port of the MCU".format(Letter))
+            else:
+                self.AhbMask |= 1 << self.Ports[Letter].PortId
+
+    def load_aliases(self):
+        Aliases = self.Cfg.get("PortAliases", [])
+        check_unique(Aliases, "Name", "Dio.PortAliases", self.Err)
+        self.AliasMap = {}
+        for Index, Alias in enumerate(Aliases):
+            Where = "Dio.PortAliases[{0}]".format(Index)
+            if not check_identifier(Alias.get("Name"), Where + ".Name", self.Err):
+                continue
+            Target = Alias.get("Port")
+            if Target not in self.Ports:
+                self.Err.add(Where + ".Port", "unknown port {0!r}".format(Target))
+                continue
+            self.AliasMap[Alias["Name"]] = self.Ports[Target]
+            self.Aliases.append((Alias["Name"], self.Ports[Target], Alias.get("Comment")))
+
+    def resolve_port(self, Name, Where):
+        """Port of a port name, expander port name or alias, and the symbol the name is written with."""
+        if Name in self.Ports:
+            Port = self.Ports[Name]
+            return Port, Port.Symbol
+        if Name in self.AliasMap:
+            return self.AliasMap[Name], Name
+        self.Err.add(Where, "unknown port {0!r}".format(Name))
+        return None, None
+
+    def load_channels(self):
+        Channels = self.Cfg.get("Channels", [])
+        check_unique(Channels, "Name", "Dio.Channels", self.Err)
+        Used = {}
+        for Index, Ch in enumerate(Channels):
+            Where = "Dio.Channels[{0}]".format(Index)
+            check_identifier(Ch.get("Name"), Where + ".Name", self.Err)
+            Port, _ = self.resolve_port(Ch.get("Port"), Where + ".Port")
+            Pin = to_int(Ch.get("Pin"), Where + ".Pin", self.Err)
+            Direction = Ch.get("Direction")
+            if Direction not in ("INPUT", "OUTPUT"):
+                self.Err.add(Where + ".Direction", "shall be INPUT or OUTPUT")
+            if Port is None or Pin is None:
+                continue
+            if not (0 <= Pin <= 7):
+                self.Err.add(Where + ".Pin", "pin {0} out of range".format(Pin))
+                continue
+            ChannelId = (Port.PortId << 4) | Pin
+            if not Port.IsExpander and ChannelId > DIO_MAX_CHANNEL_ID:
+                self.Err.add(Where, "channel ID 0x{0:02X} exceeds DIO_MAX_CHANNEL_ID".format(ChannelId))
+                continue
+            if ChannelId in Used:
+                self.Err.add(Where, "pin already configured as channel {0}".format(Used[ChannelId]))
+                continue
+            Used[ChannelId] = Ch.get("Name")
+            IsOutput = (Port.OutputMask >> Pin) & 1
+            if Direction == "OUTPUT" and not IsOutput:
+                self.Err.add(Where, "output channel on a pin which is not in the output mask of its port")
+            if Direction == "INPUT" and IsOutput:
+                self.Err.add(Where, "input channel on a pin which is in the output mask of its port")
+            Port.ChannelMask |= 1 << Pin
+            Entry = {"Name": Ch.get("Name"), "Port": Port, "Pin": Pin, "Id": ChannelId,
+                     "Direction": Direction, "Debounce": None, "Edge": None}
+            if "Debounce" in Ch:
+                Cycles = to_int(Ch["Debounce"], Where + ".Debounce", self.Err)
+                if Cycles is not None and not (1 <= Cycles <= 255):
+                    self.Err.add(Where + ".Debounce", "shall be 1..255 cycles")
+                if Port.IsExpander:
+                    self.Err.add(Where + ".Debounce", "only channels of the MCU ports are debounced")
+                Entry["Debounce"] = Cycles
+            if "Edge" in Ch:
+                if Ch["Edge"] not in DIO_EDGES:
+                    self.Err.add(Where + ".Edge", "shall be one of " + ", ".join(sorted(DIO_EDGES)))
+                if Port.IsExpander:
+                    self.Err.add(Where + ".Edge", "only channels of the MCU ports are captured")
+                if Direction != "INPUT":
+                    self.Err.add(Where + ".Edge", "edges are captured on input channels")
+                Entry["Edge"] = Ch["Edge"]
+            self.Channels.append(Entry)
+
+    def load_groups(self):
+        for Index, Grp in enumerate(self.Cfg.get("ChannelGroups", [])):
+            Where = "Dio.ChannelGroups[{0}]".format(Index)
+            Port, Symbol = self.resolve_port(Grp.get("Port"), Where + ".Port")
+            Mask = to_int(Grp.get("Mask"), Where + ".Mask", self.Err)
+            if Port is None or Mask is None:
+                continue
+            if not (0 < Mask <= 0xFF):
+                self.Err.add(Where + ".Mask", "shall be 0x01..0xFF")
+                continue
+            self.Groups.append({"Port": Port, "Symbol": Symbol, "Mask": Mask,
+                                "Offset": lowest_bit(Mask), "Comment": Grp.get("Comment")})
+
+    def load_virtual_groups(self):
+        Groups = self.Cfg.get("VirtualGroups", [])
+        check_unique(Groups, "Name", "Dio.VirtualGroups", self.Err)
+        for Index, Grp in enumerate(Groups):
+            Where = "Dio.VirtualGroups[{0}]".format(Index)
+            Parts = []
+            Shift = 0
+            Seen = set()
+            for PartIndex, Part in enumerate(Grp.get("Parts", [])):
+                PartWhere = "{0}.Parts[{1}]".format(Where, PartIndex)
+                Port, Symbol = self.resolve_port(Part.get("Port"), PartWhere + ".Port")
+                Mask = to_int(Part.get("Mask"), PartWhere + ".Mask", self.Err)
+                if Port is None or Mask is None:
+                    continue
+                if Port.IsExpander:
+                    self.Err.add(PartWhere + ".Port", "virtual groups are made of MCU ports")
+                    continue
+                if Port.PortId in Seen:
+                    self.Err.add(PartWhere + ".Port", "at most one part per port in a group")
+                Seen.add(Port.PortId)
+                if not (0 < Mask <= 0xFF) or not is_contiguous(Mask):
+                    self.Err.add(PartWhere + ".Mask", "shall be adjoining pins of the port")
+                    continue
+                Parts.append({"Port": Port, "Symbol": Symbol, "Mask": Mask,
+                              "Offset": lowest_bit(Mask), "Shift": Shift})
+                Shift += popcount(Mask)
+            if not Parts:
+                self.Err.add(Where + ".Parts", "a virtual group needs at least one part")
+            if Shift > 32:
+                self.Err.add(Where, "{0} bits do not fit Dio_VirtualGroupLevelType".format(Shift))
+            self.VirtualGroups.append({"Name": Grp.get("Name"), "Comment": Grp.get("Comment"), "Parts": Parts})
+
+    def load_features(self):
+        Sw = self.Switches
+        self.InputChannels = [Ch for Ch in self.Channels if Ch["Debounce"] is not None]
+        self.EdgeChannels = [Ch for Ch in self.Channels if Ch["Edge"] is not None]
+
+        # A feature without configuration would produce a zero sized table, and a configuration without its feature is lost
+        Features = [
+            ("DioInputSnapshotApi", self.InputChannels, "debounced channels"),
+            ("DioEdgeCaptureApi", self.EdgeChannels, "edge channels"),
+            ("DioVirtualGroupApi", self.VirtualGroups, "virtual groups"),
+            ("DioExpanderApi", self.Expanders, "expanders"),
+        ]
+        for Switch, Items, Text in Features:
+            if Sw[Switch] and not Items:
+                self.Err.add("Dio.Switches." + Switch, "is on but no {0} are configured".format(Text))
+            if Items and not Sw[Switch]:
+                self.Err.add("Dio.Switches." + Switch, "is off but {0} are configured".format(Text))
+
+        if Sw["DioEdgeCaptureApi"]:
+            Size = to_int(self.Cfg.get("EdgeRingSize"), "Dio.EdgeRingSize", self.Err)
+            if Size is not None and (Size < 2 or Size > 256 or (Size & (Size - 1)) != 0):
+                self.Err.add("Dio.EdgeRingSize", "shall be a power of two of 2..256")
+            self.EdgeRingSize = Size or 0
+            Address = to_int(self.Cfg.get("EdgeTimestampAddress"), "Dio.EdgeTimestampAddress", self.Err)
+            if Address is not None and (Address & 3) != 0:
+                self.Err.add("Dio.EdgeTimestampAddress", "shall be a 32-bit aligned register address")
+            self.EdgeTimestampAddress = Address or 0
+
+        if Sw["DioPatternApi"]:
+            Timer = self.Cfg.get("PatternTimer", {})
+            for Key in ("Base", "Interrupt", "UdmaChannel"):
+                check_identifier(Timer.get(Key), "Dio.PatternTimer." + Key, self.Err)
+            self.PatternTimer = Timer
+
+        if not Sw["DioExpanderApi"]:
+            for Grp in self.Groups:
+                if Grp["Port"].IsExpander:
+                    self.Err.add("Dio.ChannelGroups", "group on an expander port but DioExpanderApi is off")
+
+        # Every port the driver accesses at run time shall pass the port ID check: the ports of the
+        # channels, of the channel groups and of the virtual group parts, which may have no channel
+        self.PortIdMask = 0
+        for Ch in self.Channels:
+            if not Ch["Port"].IsExpander:
+                self.PortIdMask |= 1 << Ch["Port"].PortId
+        for Grp in self.Groups:
+            if not Grp["Port"].IsExpander:
+                self.PortIdMask |= 1 << Grp["Port"].PortId
+        for Grp in self.VirtualGroups:
+            for Part in Grp["Parts"]:
+                self.PortIdMask |= 1 << Part["Port"].PortId
+
+    # ---------------------------------------------------------------- queries
+
+    def mcu_channels(self):
+        return [Ch for Ch in self.Channels if not Ch["Port"].IsExpander]
+
+    def expander_channels(self):
+        return [Ch for Ch in self.Channels if Ch["Port"].IsExpander]
+
+    def channel_symbol(self, Ch):
+        if Ch["Port"].IsExpander:
+            return "(0x{0:02X}u)".format(Ch["Id"])
+        return "DIO_CHANNEL_{0}_{1}".format(Ch["Port"].Letter, Ch["Pin"])
+
+    def port_groups(self, Channels):
+        """Ports of a channel list in port ID order with the mask of the channels on each."""
+        Masks = {}
+        for Ch in Channels:
+            Masks[Ch["Port"]] = Masks.get(Ch["Port"], 0) | (1 << Ch["Pin"])
+        return sorted(Masks.items(), key=lambda Item: Item[0].PortId)
+
+
+def dio_cfg_h(Dio, Source):
+    Sw = Dio.Switches
+    L = []
+    L.append("#ifndef DIO_CFG_H")
+    L.append("#define DIO_CFG_H")
+    L.append("")
+    L.append(GENERATED_NOTE.format(Source))
+    L.append("")
+    L.append("#include \"gpio.h\"")
+    L.append("")
+    L.append("/* Dio configutration file Vendor */")
+    L.append("#define DIO_CFG_VENDOR_ID\t(0x40u)")
+    L.append("")
+    L.append("/*\tMoudle Version\t1.0.0 */")
+    L.append("#define DIO_CFG_SW_MAJOR_VERSION\t\t\t(0X01u)")
+    L.append("#define DIO_CFG_SW_MINOR_VERSION\t\t\t(0X00u)")
+    L.append("#define DIO_CFG_SW_PATCH_VERSION\t\t\t(0X00u)")
+    L.append("")
+    L.append("/* Autosar version 4.3.1 */")
+    L.append("#define DIO_CFG_AR_RELEASE_MAJOR_VERSION\t(0X04u)")
+    L.append("#define DIO_CFG_AR_RELEASE_MINOR_VERSION\t(0X03u)")
+    L.append("#define DIO_CFG_AR_RELEASE_PATCH_VERSION\t(0X01u)")
+    L.append("")
+    for Name, Doc in DIO_SWITCHES:
+        if len(Doc) == 1:
+            L.append("/* " + Doc[0] + " */")
+        else:
+            L.append("/* ")
+            L.extend("   " + Line for Line in Doc)
+            L.append("*/")
+        L.append(tab_pad("#define " + Name, 44) + std(Sw[Name]))
+        L.append("")
+
+    Mcu = Dio.mcu_channels()
+    Groups = [Grp for Grp in Dio.Groups if not Grp["Port"].IsExpander]
+    ExpGroups = [Grp for Grp in Dio.Groups if Grp["Port"].IsExpander]
+    L.append("/* Configured channels, channel groups and ports */")
+    L.append("#define NUM_OF_USED_PINS\t\t{0}".format(len(Mcu)))
+    L.append("#define NUM_OF_USED_PORTS\t\t{0}".format(popcount(Dio.PortIdMask)))
+    if ExpGroups:
+        L.append("#if (DioExpanderApi == STD_ON)")
+        L.append("#define NUM_OF_USED_GROUPS\t{0}".format(len(Groups) + len(ExpGroups)))
+        L.append("#else")
+        L.append("#define NUM_OF_USED_GROUPS\t{0}".format(len(Groups)))
+        L.append("#endif /* DioExpanderApi */")
+    else:
+        L.append("#define NUM_OF_USED_GROUPS\t\t{0}".format(len(Groups)))
+    L.append("")
+    L.append("")
+    if Mcu:
+        L.extend(aligned_defines([(Ch["Name"], Dio.channel_symbol(Ch)) for Ch in Mcu]))
+        L.append("")
+        L.extend(aligned_defines([(Ch["Name"] + "_PORT", Ch["Port"].Symbol) for Ch in Mcu]))
+        L.append("")
+    L.append("/* Output pins of each port after the board pin setup, initial value of the direction shadow */")
+    for Port in Dio.PortList[:DIO_MAX_PORT_ID + 1]:
+        L.append("#define DIO_CFG_PORT_{0}_OUTPUT_MASK\t({1}u)".format(Port.Letter, hex8(Port.OutputMask)))
+    L.append("")
+    L.append("/* Configured channels of each port, used to validate constant channel IDs at compile time */")
+    for Port in Dio.PortList[:DIO_MAX_PORT_ID + 1]:
+        L.append("#define DIO_CFG_PORT_{0}_CHANNEL_MASK\t({1}u)".format(Port.Letter, hex8(Port.ChannelMask)))
+    L.append("")
+    L.append("/*")
+    L.append("   Ports used by the channels, channel groups or virtual groups, bit n set for port ID n.")
+    L.append("   A port may be used by a group only and have no channel (DIO_CFG_PORT_x_CHANNEL_MASK 0x00),")
+    L.append("   it is still a valid port of Dio_ReadPort / Dio_WritePort.")
+    L.append("*/")
+    L.append("#define DIO_CFG_USED_PORT_MASK\t\t({0}u)".format(hex8(Dio.PortIdMask)))
+    L.append("")
+    L.append("/* Ports accessed through the AHB aperture if DioAhbAperture is STD_ON, bit n set for port ID n */")
+    L.append("#define DIO_CFG_AHB_PORT_MASK\t\t({0}u)".format(hex8(Dio.AhbMask)))
+    L.append("")
+
+    if Sw["DioPatternApi"]:
+        L.append("/* Timer, timer interrupt and uDMA channel requested by the timer, used by the pattern engine */")
+        L.append("#define DIO_CFG_PATTERN_TIMER_BASE\t\t{0}".format(Dio.PatternTimer["Base"]))
+        L.append("#define DIO_CFG_PATTERN_TIMER_INT\t\t{0}".format(Dio.PatternTimer["Interrupt"]))
+        L.append("#define DIO_CFG_PATTERN_UDMA_CHANNEL\t{0}".format(Dio.PatternTimer["UdmaChannel"]))
+        L.append("")
+
+    if Sw["DioInputSnapshotApi"]:
+        L.append("/* Input channels debounced by Dio_MainFunction, and the ports they are sampled from */")
+        L.append("#define DIO_CFG_NUM_OF_INPUT_CHANNELS\t{0}".format(len(Dio.InputChannels)))
+        L.append("#define DIO_CFG_NUM_OF_INPUT_PORTS\t\t{0}".format(len(Dio.port_groups(Dio.InputChannels))))
+        L.append("")
+        for Ch in Dio.InputChannels:
+            L.append("/* Consecutive Dio_MainFunction cycles a new level of {0} shall be sampled before it is taken */".format(Ch["Name"]))
+            L.append("#define DIO_CFG_{0}_DEBOUNCE\t\t({1}u)".format(Ch["Name"], Ch["Debounce"]))
+        L.append("")
+
+    if Sw["DioEdgeCaptureApi"]:
+        L.append("/* Channels captured by the edge interrupt, and the ports they are on */")
+        L.append("#define DIO_CFG_NUM_OF_EDGE_CHANNELS\t{0}".format(len(Dio.EdgeChannels)))
+        L.append("#define DIO_CFG_NUM_OF_EDGE_PORTS\t\t{0}".format(len(Dio.port_groups(Dio.EdgeChannels))))
+        L.append("")
+        L.append("/* Edge events buffered between the edge interrupt and the consumer, shall be a power of two */")
+        L.append("#define DIO_CFG_EDGE_RING_SIZE\t\t\t({0}u)".format(Dio.EdgeRingSize))
+        L.append("")
+        L.append("/* ")
+        L.append("   Free running up counter read for the event timestamps (DWT_CYCCNT), the integration code ")
+        L.append("   shall enable it (DEMCR.TRCENA and DWT_CTRL.CYCCNTENA) before the edge capture is started")
+        L.append("*/")
+        L.append("#define DIO_CFG_EDGE_TIMESTAMP_ADDRESS\t(0x{0:08X}u)".format(Dio.EdgeTimestampAddress))
+        L.append("")
+
+    if Sw["DioVirtualGroupApi"]:
+        L.append("/* Virtual channel groups, and their parts (at most one part per port in a group) */")
+        L.append("#define DIO_CFG_NUM_OF_VIRTUAL_GROUPS\t\t{0}".format(len(Dio.VirtualGroups)))
+        L.append("#define DIO_CFG_NUM_OF_VIRTUAL_GROUP_PARTS\t{0}".format(sum(len(G["Parts"]) for G in Dio.VirtualGroups)))
+        L.append("")
+
+    McuAliases = [A for A in Dio.Aliases if not A[1].IsExpander]
+    ExpAliases = [A for A in Dio.Aliases if A[1].IsExpander]
+    L.extend(alias_lines(McuAliases))
+
+    if Sw["DioExpanderApi"]:
+        L.append("/* Port expanders, and their ports (port ID DIO_EXPANDER_FIRST_PORT_ID + index) */")
+        L.append("#define DIO_CFG_NUM_OF_EXPANDERS\t\t{0}".format(len(Dio.Expanders)))
+        L.append("#define DIO_CFG_NUM_OF_EXPANDER_PORTS\t{0}".format(sum(len(E["Ports"]) for E in Dio.Expanders)))
+        L.append("")
+        for Index, Exp in enumerate(Dio.Expanders):
+            Comment = " ({0})".format(Exp["Comment"]) if Exp["Comment"] else ""
+            L.append("/* 7-bit bus address of expander {0}{1} */".format(Index, Comment))
+            L.append("#define DIO_CFG_EXPANDER{0}_ADDRESS\t\t({1}u)".format(Index, hex8(Exp["Address"])))
+            L.append("")
+            Comment = ", " + Exp["PortsComment"] if Exp["PortsComment"] else ""
+            L.append("/* Ports of expander {0}{1} */".format(Index, Comment))
+            for Port in Exp["Ports"]:
+                L.append("#define {0}\t\t({1}u)".format(Port.Symbol, Port.PortId))
+            L.append("")
+        ExpChannels = Dio.expander_channels()
+        if ExpChannels:
+            L.extend(aligned_defines([(Ch["Name"], Dio.channel_symbol(Ch)) for Ch in ExpChannels]))
+            L.append("")
+        L.extend(alias_lines(ExpAliases))
+        L.append("/* Output pins and configured channels of the expander ports */")
+        ExpPorts = [Port for Exp in Dio.Expanders for Port in Exp["Ports"]]
+        for Port in ExpPorts:
+            L.append("#define DIO_CFG_PORT_{0}_OUTPUT_MASK\t\t({1}u)".format(Port.Name, hex8(Port.OutputMask)))
+        for Port in ExpPorts:
+            L.append("#define DIO_CFG_PORT_{0}_CHANNEL_MASK\t({1}u)".format(Port.Name, hex8(Port.ChannelMask)))
+        L.append("")
+
+    L.append("")
+    L.append("#endif /*DIO_CFG_H*/")
+    return "\n".join(L) + "\n"
+
+
+def alias_lines(Aliases):
+    """Port aliases of the application, the aliases sharing a comment are written as one block."""
+    L = []
+    Blocks = []
+    for Name, Port, Comment in Aliases:
+        if Comment is not None or not Blocks:
+            Blocks.append((Comment, []))
+        Blocks[-1][1].append((Name, Port.Symbol))
+    for Comment, Pairs in Blocks:
+        if Comment:
+            L.append("/* " + Comment + " */")
+        L.extend(aligned_defines(Pairs))
+        L.append("")
+    return L
+
+
+def dio_lcfg_c(Dio, Source):
+    Sw = Dio.Switches
+    L = []
+    L.append("")
+    L.append(GENERATED_NOTE.format(Source))
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t    \tInclude Headers\t\t\t\t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("#include \"Dio.h\"")
+    L.append("#include \"Dio_MemMap.h\"")
+    L.append("#include \"hw_memmap.h\"")
+    L.append("#include \"hw_ints.h\"")
+    L.append("")
+    L.append("#if (DioExpanderApi == STD_ON)")
+    L.append("#include \"Dio_Expander.h\"")
+    L.append("#endif /* DioExpanderApi */")
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t        Macros Definition       \t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("/* Decode entry of a channel ID which is not part of the configuration */")
+    L.append("#define DIO_DECODE_UNUSED\t\t\t\t\t\t\t{ 0x00000000UL, 0x00000000UL, 0x00u, 0x00u, DIO_PIN_INPUT, FALSE }")
+    L.append("")
+    L.append("/* Decode entry of a configured channel */")
+    L.append("#define DIO_DECODE_CHANNEL(BASE, PORT, PIN, DIR)\t{ (BASE), DIO_MASKED_DATA_ADDRESS((BASE), (1u << (PIN))), \\")
+    L.append("\t\t\t\t\t\t\t\t\t\t\t\t\t  (uint8)(1u << (PIN)), (PORT), (DIR), TRUE }")
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t        Configuration Objects      \t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+
+    Mcu = Dio.mcu_channels()
+    L.append("const Dio_PortChannelConfig ChannelConfig[NUM_OF_USED_PINS] = ")
+    L.append("{")
+    L.append(struct_rows([(None, [Ch["Name"], Ch["Name"] + "_PORT", "DIO_PIN_" + Ch["Direction"]]) for Ch in Mcu]))
+    L.append("};")
+    L.append("")
+
+    Groups = [Grp for Grp in Dio.Groups if not Grp["Port"].IsExpander]
+    ExpGroups = [Grp for Grp in Dio.Groups if Grp["Port"].IsExpander]
+    L.append("const Dio_ChannelGroupType ChannelGroup[NUM_OF_USED_GROUPS] =")
+    L.append("{")
+    L.append(struct_rows([(Grp["Comment"], [hex8(Grp["Mask"]), str(Grp["Offset"]), Grp["Symbol"],
+                                            "DIO_MASKED_DATA_ADDRESS({0}, {1})".format(Grp["Port"].Base, hex8(Grp["Mask"]))])
+                          for Grp in Groups]))
+    if ExpGroups:
+        L.append("#if (DioExpanderApi == STD_ON)")
+        L.append("\t,")
+        L.append(struct_rows([(Grp["Comment"] or "Expander groups have no data address",
+                               [hex8(Grp["Mask"]), str(Grp["Offset"]), Grp["Symbol"], "0x00000000UL"])
+                              for Grp in ExpGroups]))
+        L.append("#endif /* DioExpanderApi */")
+    L.append("};")
+    L.append("")
+    L.append("")
+
+    # The decode table resolves every channel ID to its port and pin, so no access searches the configuration
+    Decode = ["DIO_DECODE_UNUSED"] * (DIO_MAX_CHANNEL_ID + 1)
+    for Ch in Mcu:
+        Decode[Ch["Id"]] = "DIO_DECODE_CHANNEL({0}, {1}, {2}u, DIO_PIN_{3})".format(
+            Ch["Port"].Base, Ch["Port"].Symbol, Ch["Pin"], Ch["Direction"])
+    L.append("/* ")
+    L.append("   Channel decode table indexed by the channel ID, ")
+    L.append("   resolves a channel to its port and pin in constant time")
+    L.append("*/")
+    L.append("const Dio_ChannelDecodeType ChannelDecode[DIO_NUM_OF_CHANNEL_IDS] =")
+    L.append("{")
+    L.append(",\n".join("\t/* 0x{0:02X} */\t{1}".format(Id, Entry) for Id, Entry in enumerate(Decode)))
+    L.append("};")
+    L.append("")
+    L.append("/* Output pins of each port, kept in RAM so the Port driver can refresh it */")
+    L.append("uint8 PortOutputMask[DIO_MAX_PORT_ID + 1u] =")
+    L.append("{")
+    L.append(",\n".join("\tDIO_CFG_PORT_{0}_OUTPUT_MASK".format(Letter) for Letter in DIO_MCU_PORTS))
+    L.append("};")
+    L.append("")
+
+    if Sw["DioInputSnapshotApi"]:
+        L.append("#if (DioInputSnapshotApi == STD_ON)")
+        L.append("")
+        L.append("/* Input channels debounced by Dio_MainFunction */")
+        L.append("const Dio_InputChannelConfigType InputChannel[DIO_CFG_NUM_OF_INPUT_CHANNELS] =")
+        L.append("{")
+        L.append(struct_rows([(None, [Ch["Name"], "DIO_CFG_{0}_DEBOUNCE".format(Ch["Name"])]) for Ch in Dio.InputChannels]))
+        L.append("};")
+        L.append("")
+        L.append("/* Ports sampled by Dio_MainFunction, one masked read of the input pins per port */")
+        L.append("const Dio_InputPortType InputPort[DIO_CFG_NUM_OF_INPUT_PORTS] =")
+        L.append("{")
+        L.append(struct_rows([(None, [Port.Symbol, hex8(Mask), "DIO_MASKED_DATA_ADDRESS({0}, {1})".format(Port.Base, hex8(Mask))])
+                              for Port, Mask in Dio.port_groups(Dio.InputChannels)]))
+        L.append("};")
+        L.append("")
+        L.append("#endif /* DioInputSnapshotApi */")
+        L.append("")
+
+    if Sw["DioEdgeCaptureApi"]:
+        L.append("#if (DioEdgeCaptureApi == STD_ON)")
+        L.append("")
+        L.append("/* Channels captured by the edge interrupt */")
+        L.append("const Dio_EdgeChannelConfigType EdgeChannel[DIO_CFG_NUM_OF_EDGE_CHANNELS] =")
+        L.append("{")
+        L.append(struct_rows([(None, [Ch["Name"], DIO_EDGES[Ch["Edge"]]]) for Ch in Dio.EdgeChannels]))
+        L.append("};")
+        L.append("")
+        L.append("/* Ports of the edge channels, their edge pins and their GPIO interrupt */")
+        L.append("const Dio_EdgePortType EdgePort[DIO_CFG_NUM_OF_EDGE_PORTS] =")
+        L.append("{")
+        L.append(struct_rows([(None, [Port.Symbol, hex8(Mask), "INT_GPIO" + Port.Letter]) for Port, Mask in Dio.port_groups(Dio.EdgeChannels)]))
+        L.append("};")
+        L.append("")
+        L.append("#endif /* DioEdgeCaptureApi */")
+        L.append("")
+
+    if Sw["DioVirtualGroupApi"]:
+        L.append("#if (DioVirtualGroupApi == STD_ON)")
+        L.append("")
+        L.append("/* Parts of the virtual groups, the parts of a group follow each other */")
+        L.append("const Dio_VirtualGroupPartType VirtualGroupPart[DIO_CFG_NUM_OF_VIRTUAL_GROUP_PARTS] =")
+        L.append("{")
+        Rows = []
+        for Grp in Dio.VirtualGroups:
+            for Index, Part in enumerate(Grp["Parts"]):
+                Rows.append((Grp["Name"] if Index == 0 else None,
+                             [Part["Symbol"], hex8(Part["Mask"]), str(Part["Offset"]), str(Part["Shift"]),
+                              "DIO_MASKED_DATA_ADDRESS({0}, {1})".format(Part["Port"].Base, hex8(Part["Mask"]))]))
+        L.append(struct_rows(Rows))
+        L.append("};")
+        L.append("")
+        L.append("const Dio_VirtualGroupType VirtualGroup[DIO_CFG_NUM_OF_VIRTUAL_GROUPS] =")
+        L.append("{")
+        Rows = []
+        First = 0
+        for Grp in Dio.VirtualGroups:
+            Rows.append((None, ["&VirtualGroupPart[{0}]".format(First), str(len(Grp["Parts"]))]))
+            First += len(Grp["Parts"])
+        L.append(struct_rows(Rows))
+        L.append("};")
+        L.append("")
+        L.append("#endif /* DioVirtualGroupApi */")
+        L.append("")
+
+    if Sw["DioExpanderApi"]:
+        L.append("#if (DioExpanderApi == STD_ON)")
+        L.append("")
+        L.append("/* Port expanders and the bus transactions of their transport */")
+        L.append("const Dio_ExpanderType Expander[DIO_CFG_NUM_OF_EXPANDERS] =")
+        L.append("{")
+        L.append(struct_rows([(None, [Exp["Write"], Exp["Read"], "DIO_CFG_EXPANDER{0}_ADDRESS".format(Index),
+                                      str(Exp["FirstPort"]), str(len(Exp["Ports"]))])
+                              for Index, Exp in enumerate(Dio.Expanders)]))
+        L.append("};")
+        L.append("")
+        L.append("/* Expander ports in port ID order, the ports of an expander follow each other */")
+        L.append("const Dio_ExpanderPortType ExpanderPort[DIO_CFG_NUM_OF_EXPANDER_PORTS] =")
+        L.append("{")
+        L.append(struct_rows([(None, [str(Index), "DIO_CFG_PORT_{0}_OUTPUT_MASK".format(Port.Name),
+                                      "DIO_CFG_PORT_{0}_CHANNEL_MASK".format(Port.Name)])
+                              for Index, Exp in enumerate(Dio.Expanders) for Port in Exp["Ports"]]))
+        L.append("};")
+        L.append("")
+        L.append("#endif /* DioExpanderApi */")
+        L.append("")
+
+    L.append("Dio_ConfigType Dio_Config = ")
+    L.append("{")
+    L.append("\tChannelConfig,")
+    L.append("\tChannelGroup,")
+    L.append("\tChannelDecode,")
+    L.append("\tPortOutputMask")
+    for Switch, Members in (("DioInputSnapshotApi", ["InputChannel", "InputPort"]),
+                            ("DioEdgeCaptureApi", ["EdgeChannel", "EdgePort"]),
+                            ("DioVirtualGroupApi", ["VirtualGroup"]),
+                            ("DioExpanderApi", ["Expander", "ExpanderPort"])):
+        if Sw[Switch]:
+            L.append("#if ({0} == STD_ON)".format(Switch))
+            L.append("\t,")
+            L.append(",\n".join("\t" + Member for Member in Members))
+            L.append("#endif /* {0} */".format(Switch))
+    L.append("};")
+    return "\n".join(L) + "\n"
+
+
+##################################################################################
+#                                   CanIf                                        #
+##################################################################################
+
+CANIF_SPEC = "AUTOSAR_SWS_CANInterface, AUTOSAR Release 4.3.1"
+
+CANIF_SWITCHES = [
+    ("CANIF_DEV_ERROR_DETECT",
+     "Development error detection and notification"),
+    ("CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API",
+     "Adds / removes the service CanIf_ReadTxNotifStatus() from the code"),
+    ("CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API",
+     "Adds / removes the service CanIf_ReadRxNotifStatus() from the code"),
+    ("CANIF_PUBLIC_READRXPDU_DATA_API",
+     "Adds / removes the service CanIf_ReadRxPduData() from the code"),
+    ("CANIF_PUBLIC_SETDYNAMICTXID_API",
+     "Adds / removes the service CanIf_SetDynamicTxId() from the code"),
+    ("CANIF_PUBLIC_TX_BUFFERING",
+     "Adds / removes the buffering of Tx L-PDUs which find no free hardware object"),
+    ("CANIF_RX_DEFERRED_PROCESSING",
+     "Adds / removes the Rx queue, CanIf_RxIndication() only queues the frame and\n"
+     "CanIf_MainFunctionRx() resolves it to its L-PDU and notifies the upper layer"),
+    ("CANIF_RX_ISR_MEASUREMENT",
+     "Adds / removes the time measurement of CanIf_RxIndication() in the receive interrupt"),
+    ("CANIF_BUSOFF_RECOVERY",
+     "Adds / removes the bus-off restart schedule of CanIf_MainFunctionBusOff() and\n"
+     "the service CanIf_GetBusOffStatistics()"),
+]
+
+CAN_ID_EXTENDED = 0x80000000
+CANIF_MAX_MASK_RANGES = 64
+CAN_FD_LENGTHS = (0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64)
+
+
+class CanIfModel(object):
+    """CanIf configuration resolved to table indexes and sorted Rx CAN IDs."""
+
+    def __init__(self, Cfg, Err):
+        self.Cfg = Cfg
+        self.Err = Err
+        self.Switches = {}
+        for Name, _ in CANIF_SWITCHES:
+            Value = Cfg.get("Switches", {}).get(Name)
+            if not isinstance(Value, bool):
+                Err.add("CanIf.Switches." + Name, "shall be true or false")
+                Value = False
+            self.Switches[Name] = Value
+        for Name in Cfg.get("Switches", {}):
+            if Name not in self.Switches:
+                Err.add("CanIf.Switches", "unknown switch {0!r}".format(Name))
+
+        self.load_controllers()
+        self.Hths = self.load_hohs("Hths")
+        self.load_tx_buffers()
+        self.Hrhs = self.load_hohs("Hrhs")
+        Hohs = {}
+        for Kind, Items in (("HTH", self.Hths), ("HRH", self.Hrhs)):
+            for Item in Items:
+                if Item["Hoh"] in Hohs:
+                    Err.add("CanIf." + Kind, "hardware object {0} of {1} is used by {2}".format(
+                        Item["Hoh"], Item["Name"], Hohs[Item["Hoh"]]))
+                Hohs[Item["Hoh"]] = Item["Name"]
+        self.NumOfHoh = (max(Hohs) + 1) if Hohs else 0
+        self.TxPdus = self.load_pdus("TxPdus", self.Hths, "Hth")
+        self.RxPdus = self.load_pdus("RxPdus", self.Hrhs, "Hrh")
+        self.check_tx_ids()
+        self.build_rx_table()
+        self.UlHeaders = Cfg.get("UpperLayerHeaders", [])
+        self.TxPadding = to_int(Cfg.get("TxPaddingValue", 0), "CanIf.TxPaddingValue", Err)
+        if self.TxPadding is not None and not (0 <= self.TxPadding <= 0xFF):
+            Err.add("CanIf.TxPaddingValue", "shall be a byte")
+        self.TxMaxDlc = max([Pdu["Dlc"] for Pdu in self.TxPdus] + [1])
+        self.load_rx_queue()
+
+        if not self.TxPdus:
+            Err.add("CanIf.TxPdus", "at least one Tx PDU is needed")
+        if not self.RxPdus:
+            Err.add("CanIf.RxPdus", "at least one Rx PDU is needed")
+
+    def load_controllers(self):
+        Controllers = self.Cfg.get("Controllers", [])
+        check_unique(Controllers, "Name", "CanIf.Controllers", self.Err)
+        self.Controllers = {}
+        self.BusOffPeriod = 0
+        if self.Switches["CANIF_BUSOFF_RECOVERY"]:
+            Period = to_int(self.Cfg.get("BusOffMainFunctionPeriodMs"), "CanIf.BusOffMainFunctionPeriodMs", self.Err)
+            if Period is not None and not (1 <= Period <= 1000):
+                self.Err.add("CanIf.BusOffMainFunctionPeriodMs", "shall be 1..1000 ms")
+            self.BusOffPeriod = Period or 0
+        elif "BusOffMainFunctionPeriodMs" in self.Cfg:
+            self.Err.add("CanIf.BusOffMainFunctionPeriodMs", "CANIF_BUSOFF_RECOVERY is off")
+        for Index, Ctrl in enumerate(Controllers):
+            Where = "CanIf.Controllers[{0}]".format(Index)
+            check_identifier(Ctrl.get("Name"), Where + ".Name", self.Err)
+            Id = to_int(Ctrl.get("Id"), Where + ".Id", self.Err)
+            if Id is not None and not (0 <= Id <= 0xFF):
+                self.Err.add(Where + ".Id", "out of range")
+            for Fct in ("BusOffNotification", "ModeIndication"):
+                if Fct in Ctrl:
+                    check_identifier(Ctrl[Fct], Where + "." + Fct, self.Err)
+            Entry = {"Name": Ctrl.get("Name"), "Id": Id or 0, "Fd": bool(Ctrl.get("Fd", False)),
+                     "BusOffNotification": Ctrl.get("BusOffNotification"),
+                     "ModeIndication": Ctrl.get("ModeIndication")}
+            Entry.update(self.load_bus_off(Ctrl.get("BusOff", {}), Where + ".BusOff"))
+            self.Controllers[Ctrl.get("Name")] = Entry
+        if not self.Controllers:
+            self.Err.add("CanIf.Controllers", "at least one controller is needed")
+        # The controller state and configuration tables are indexed by the controller ID
+        if sorted(Ctrl["Id"] for Ctrl in self.Controllers.values()) != list(range(len(self.Controllers))):
+            self.Err.add("CanIf.Controllers", "the controller IDs shall be 0 .. {0}".format(len(self.Controllers) - 1))
+
+    def load_bus_off(self, BusOff, Where):
+        """Tx buffer handling and restart schedule of a controller after a bus-off."""
+        Result = {"Retain": False, "FastAttempts": 0, "FastTicks": 0, "SlowTicks": 0}
+        Policy = BusOff.get("TxBuffers", "FLUSH")
+        if Policy not in ("FLUSH", "RETAIN"):
+            self.Err.add(Where + ".TxBuffers", "shall be FLUSH or RETAIN")
+        elif Policy == "RETAIN" and not self.Switches["CANIF_PUBLIC_TX_BUFFERING"]:
+            self.Err.add(Where + ".TxBuffers", "CANIF_PUBLIC_TX_BUFFERING is off")
+        Result["Retain"] = Policy == "RETAIN"
+        Schedule = [Key for Key in ("FastDelayMs", "FastAttempts", "SlowDelayMs") if Key in BusOff]
+        if not self.Switches["CANIF_BUSOFF_RECOVERY"]:
+            for Key in Schedule:
+                self.Err.add(Where + "." + Key, "CANIF_BUSOFF_RECOVERY is off")
+            return Result
+        Attempts = to_int(BusOff.get("FastAttempts"), Where + ".FastAttempts", self.Err)
+        if Attempts is not None and not (0 <= Attempts <= 0xFF):
+            self.Err.add(Where + ".FastAttempts", "shall be 0..255")
+        Result["FastAttempts"] = Attempts or 0
+        for Key, Name in (("FastDelayMs", "FastTicks"), ("SlowDelayMs", "SlowTicks")):
+            Delay = to_int(BusOff.get(Key), Where + "." + Key, self.Err)
+            if Delay is None or not self.BusOffPeriod:
+                continue
+            if Delay % self.BusOffPeriod != 0 or not (1 <= Delay // self.BusOffPeriod <= 0xFFFF):
+                self.Err.add(Where + "." + Key, "shall be 1..65535 periods of {0} ms".format(self.BusOffPeriod))
+                continue
+            Result[Name] = Delay // self.BusOffPeriod
+        return Result
+
+    def load_hohs(self, Key):
+        Items = self.Cfg.get(Key, [])
+        check_unique(Items, "Name", "CanIf." + Key, self.Err)
+        Result = []
+        for Index, Item in enumerate(Items):
+            Where = "CanIf.{0}[{1}]".format(Key, Index)
+            check_identifier(Item.get("Name"), Where + ".Name", self.Err)
+            Hoh = to_int(Item.get("Hoh"), Where + ".Hoh", self.Err)
+            if Hoh is not None and not (0 <= Hoh <= 0xFFFE):
+                self.Err.add(Where + ".Hoh", "out of range")
+            Ctrl = self.Controllers.get(Item.get("Controller"))
+            if Ctrl is None:
+                self.Err.add(Where + ".Controller", "unknown controller {0!r}".format(Item.get("Controller")))
+            Result.append({"Name": Item.get("Name"), "Index": Index, "Hoh": Hoh or 0, "Controller": Ctrl})
+        return Result
+
+    def load_rx_queue(self):
+        """Rx queue between the receive interrupt and CanIf_MainFunctionRx(), and the ISR time stamp register."""
+        Queue = self.Cfg.get("RxQueue", {})
+        self.RxQueueSize = self.RxQueueBudget = 0
+        if self.Switches["CANIF_RX_DEFERRED_PROCESSING"]:
+            Size = to_int(Queue.get("Size"), "CanIf.RxQueue.Size", self.Err)
+            if Size is not None and (Size < 2 or Size > 0x8000 or (Size & (Size - 1)) != 0):
+                self.Err.add("CanIf.RxQueue.Size", "shall be a power of two of 2..0x8000")
+            Budget = to_int(Queue.get("Budget"), "CanIf.RxQueue.Budget", self.Err)
+            if Budget is not None and Size is not None and not (1 <= Budget <= Size):
+                self.Err.add("CanIf.RxQueue.Budget", "shall be 1..Size frames")
+            self.RxQueueSize = Size or 0
+            self.RxQueueBudget = Budget or 0
+        elif Queue:
+            self.Err.add("CanIf.RxQueue", "CANIF_RX_DEFERRED_PROCESSING is off")
+        # Frames of a CAN FD controller carry up to 64 bytes
+        self.RxQueueDataSize = 64 if any(Ctrl["Fd"] for Ctrl in self.Controllers.values()) else 8
+        self.IsrTimestampAddress = 0
+        if self.Switches["CANIF_RX_ISR_MEASUREMENT"]:
+            Address = to_int(self.Cfg.get("IsrTimestampAddress"), "CanIf.IsrTimestampAddress", self.Err)
+            if Address is not None and (Address & 3) != 0:
+                self.Err.add("CanIf.IsrTimestampAddress", "shall be a 32-bit aligned register address")
+            self.IsrTimestampAddress = Address or 0
+
+    def load_tx_buffers(self):
+        """Tx buffer of every HTH, the buffers share one array and each HTH owns a slice of it."""
+        self.TxBufferSize = 0
+        for Hth in self.Hths:
+            Where = "CanIf.Hths[{0}].BufferSize".format(Hth["Index"])
+            Size = to_int(self.Cfg["Hths"][Hth["Index"]].get("BufferSize", 0), Where, self.Err) or 0
+            if not (0 <= Size <= 0xFF):
+                self.Err.add(Where, "shall be 0 to 255")
+                Size = 0
+            if Size and not self.Switches["CANIF_PUBLIC_TX_BUFFERING"]:
+                self.Err.add(Where, "CANIF_PUBLIC_TX_BUFFERING is off")
+            Hth["BufferOffset"] = self.TxBufferSize
+            Hth["BufferSize"] = Size
+            self.TxBufferSize += Size
+
+    def load_pdus(self, Key, Handles, HandleKey):
+        Items = self.Cfg.get(Key, [])
+        check_unique(Items, "Name", "CanIf." + Key, self.Err)
+        ByName = dict((H["Name"], H) for H in Handles)
+        Result = []
+        for Index, Item in enumerate(Items):
+            Where = "CanIf.{0}[{1}]".format(Key, Index)
+            check_identifier(Item.get("Name"), Where + ".Name", self.Err)
+            Extended = bool(Item.get("Extended", False))
+            RawId = Item.get("CanId")
+            if RawId is None and Key == "RxPdus" and isinstance(Item.get("CanIdRange"), list) and Item["CanIdRange"]:
+                RawId = Item["CanIdRange"][0]
+            CanId = to_int(RawId, Where + ".CanId", self.Err)
+            if CanId is not None and not (0 <= CanId <= (0x1FFFFFFF if Extended else 0x7FF)):
+                self.Err.add(Where + ".CanId", "0x{0:X} is not a valid {1} CAN ID".format(
+                    CanId, "extended" if Extended else "standard"))
+            Handle = ByName.get(Item.get(HandleKey))
+            if Handle is None:
+                self.Err.add(Where + "." + HandleKey, "unknown handle {0!r}".format(Item.get(HandleKey)))
+            Dlc = to_int(Item.get("Dlc", 8), Where + ".Dlc", self.Err)
+            Fd = Handle is not None and Handle["Controller"] is not None and Handle["Controller"]["Fd"]
+            if Dlc is not None and not (Dlc in CAN_FD_LENGTHS if Fd else 0 <= Dlc <= 8):
+                self.Err.add(Where + ".Dlc", "{0} is not a valid {1}frame length".format(Dlc, "CAN FD " if Fd else ""))
+            UlId = to_int(Item.get("UlId", Index), Where + ".UlId", self.Err)
+            Pdu = {"Name": Item.get("Name"), "Index": Index, "CanId": CanId or 0, "Extended": Extended,
+                   "Handle": Handle, "Dlc": Dlc or 0, "UlId": UlId or 0,
+                   "ReadNotifyStatus": bool(Item.get("ReadNotifyStatus", False)),
+                   "ReadData": bool(Item.get("ReadData", False)),
+                   "Truncation": bool(Item.get("Truncation", False)),
+                   "Dynamic": Item.get("Type", "STATIC") == "DYNAMIC"}
+            if Item.get("Type", "STATIC") not in ("STATIC", "DYNAMIC"):
+                self.Err.add(Where + ".Type", "shall be STATIC or DYNAMIC")
+            for Fct in ("TxConfirmation", "RxIndication"):
+                if Fct in Item:
+                    check_identifier(Item[Fct], Where + "." + Fct, self.Err)
+            Pdu["TxConfirmation"] = Item.get("TxConfirmation")
+            Pdu["RxIndication"] = Item.get("RxIndication")
+            if Key == "RxPdus":
+                Pdu["Ranges"] = self.rx_ranges(Item, Pdu, Where)
+            elif "CanIdRange" in Item or "CanIdMask" in Item:
+                self.Err.add(Where, "CAN ID ranges and masks are only supported for Rx PDUs")
+            if Key == "TxPdus":
+                if Pdu["ReadNotifyStatus"] and not self.Switches["CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API"]:
+                    self.Err.add(Where + ".ReadNotifyStatus", "CANIF_PUBLIC_READTXPDU_NOTIFY_STATUS_API is off")
+                if Pdu["Dynamic"] and not self.Switches["CANIF_PUBLIC_SETDYNAMICTXID_API"]:
+                    self.Err.add(Where + ".Type", "CANIF_PUBLIC_SETDYNAMICTXID_API is off")
+            else:
+                if Pdu["ReadNotifyStatus"] and not self.Switches["CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API"]:
+                    self.Err.add(Where + ".ReadNotifyStatus", "CANIF_PUBLIC_READRXPDU_NOTIFY_STATUS_API is off")
+                if Pdu["ReadData"] and not self.Switches["CANIF_PUBLIC_READRXPDU_DATA_API"]:
+                    self.Err.add(Where + ".ReadData", "CANIF_PUBLIC_READRXPDU_DATA_API is off")
+            Result.append(Pdu)
+        if len(Result) > 0xFFFF:
+            self.Err.add("CanIf." + Key, "more PDUs than PduIdType can hold")
+        return Result
+
+    def rx_ranges(self, Item, Pdu, Where):
+        """CAN ID ranges accepted by an Rx PDU: one ID, one CanIdRange, or the ranges covered by a CanIdMask."""
+        Width = 29 if Pdu["Extended"] else 11
+        Limit = (1 << Width) - 1
+        if "CanIdRange" in Item and "CanIdMask" in Item:
+            self.Err.add(Where, "CanIdRange and CanIdMask exclude each other")
+            return []
+        if "CanIdRange" in Item:
+            Range = Item["CanIdRange"]
+            if not isinstance(Range, list) or len(Range) != 2:
+                self.Err.add(Where + ".CanIdRange", "shall be [Lower, Upper]")
+                return []
+            Lower = to_int(Range[0], Where + ".CanIdRange", self.Err)
+            Upper = to_int(Range[1], Where + ".CanIdRange", self.Err)
+            if Lower is None or Upper is None:
+                return []
+            if not (0 <= Lower <= Upper <= Limit):
+                self.Err.add(Where + ".CanIdRange", "0x{0:X}..0x{1:X} is not a valid {2} CAN ID range".format(
+                    Lower, Upper, "extended" if Pdu["Extended"] else "standard"))
+                return []
+            return [(Lower, Upper)]
+        if "CanIdMask" in Item:
+            Mask = to_int(Item["CanIdMask"], Where + ".CanIdMask", self.Err)
+            if Mask is None or not (0 <= Mask <= Limit):
+                self.Err.add(Where + ".CanIdMask", "shall be a {0} bit mask".format(Width))
+                return []
+            # The don't care bits below the lowest mask bit form one range, every other
+            # don't care bit doubles the number of ranges
+            DontCare = ~Mask & Limit
+            Run = 0
+            while Run < Width and (DontCare >> Run) & 1:
+                Run += 1
+            Bits = [Bit for Bit in range(Run, Width) if (DontCare >> Bit) & 1]
+            if (1 << len(Bits)) > CANIF_MAX_MASK_RANGES:
+                self.Err.add(Where + ".CanIdMask", "0x{0:X} covers {1} CAN ID ranges, at most {2} are supported".format(
+                    Mask, 1 << len(Bits), CANIF_MAX_MASK_RANGES))
+                return []
+            Base = Pdu["CanId"] & Mask
+            Ranges = []
+            for Combination in range(1 << len(Bits)):
+                Lower = Base | sum(1 << Bit for Position, Bit in enumerate(Bits) if (Combination >> Position) & 1)
+                Ranges.append((Lower, Lower + (1 << Run) - 1))
+            return sorted(Ranges)
+        return [(Pdu["CanId"], Pdu["CanId"])]
+
+    @staticmethod
+    def can_id(Pdu):
+        return Pdu["CanId"] | (CAN_ID_EXTENDED if Pdu["Extended"] else 0)
+
+    def check_tx_ids(self):
+        """Two static Tx PDUs with the same CAN ID on one controller would collide in arbitration."""
+        Seen = {}
+        for Pdu in self.TxPdus:
+            if Pdu["Dynamic"] or Pdu["Handle"] is None or Pdu["Handle"]["Controller"] is None:
+                continue
+            Key = (Pdu["Handle"]["Controller"]["Name"], self.can_id(Pdu))
+            if Key in Seen:
+                self.Err.add("CanIf.TxPdus", "{0} and {1} are sent with the same CAN ID on {2}".format(
+                    Seen[Key], Pdu["Name"], Key[0]))
+            Seen[Key] = Pdu["Name"]
+
+    def build_rx_table(self):
+        """
+        Rx CAN ID table, one run per HRH in HRH order. The ranges of the PDUs are split into
+        disjoint [Lower, Upper] entries sorted by CAN ID for a binary search, where ranges
+        overlap the narrower one wins (a single CAN ID beats a range containing it).
+        """
+        self.RxTable = []
+        for Hrh in self.Hrhs:
+            Items = []
+            for Pdu in self.RxPdus:
+                if Pdu["Handle"] is Hrh:
+                    Type = CAN_ID_EXTENDED if Pdu["Extended"] else 0
+                    Items.extend((Lower | Type, Upper | Type, Pdu) for Lower, Upper in Pdu["Ranges"])
+            Points = sorted(set([Lower for Lower, _, _ in Items] + [Upper + 1 for _, Upper, _ in Items]))
+            Entries = []
+            Reported = set()
+            for Position in range(len(Points) - 1):
+                Lower, Upper = Points[Position], Points[Position + 1] - 1
+                Covering = sorted((Item for Item in Items if Item[0] <= Lower and Item[1] >= Upper),
+                                  key=lambda Item: Item[1] - Item[0])
+                if not Covering:
+                    continue
+                Best = Covering[0]
+                for Other in Covering[1:]:
+                    if Other[1] - Other[0] != Best[1] - Best[0] or Other[2] is Best[2]:
+                        continue
+                    Pair = (Best[2]["Name"], Other[2]["Name"])
+                    if Pair not in Reported:
+                        Reported.add(Pair)
+                        self.Err.add("CanIf.RxPdus", "{0} and {1} are received with the same CAN ID{2} on {3}".format(
+                            Pair[0], Pair[1], "" if Best[0] == Best[1] else " range", Hrh["Name"]))
+                if Entries and Entries[-1][2] is Best[2] and Entries[-1][1] + 1 == Lower:
+                    Entries[-1][1] = Upper
+                else:
+                    Entries.append([Lower, Upper, Best[2]])
+            Hrh["RxIdFirst"] = len(self.RxTable)
+            Hrh["RxIdCount"] = len(Entries)
+            self.RxTable.extend(Entries)
+        self.RxDataSize = 0
+        for Pdu in self.RxPdus:
+            Pdu["DataOffset"] = self.RxDataSize if Pdu["ReadData"] else 0
+            if Pdu["ReadData"]:
+                self.RxDataSize += Pdu["Dlc"]
+        if self.RxDataSize > 0xFFFF:
+            self.Err.add("CanIf.RxPdus", "the L-PDUs read by CanIf_ReadRxPduData() need more than 65535 bytes")
+        self.NumOfDynamicTx = 0
+        for Pdu in self.TxPdus:
+            Pdu["DynamicIndex"] = self.NumOfDynamicTx if Pdu["Dynamic"] else None
+            if Pdu["Dynamic"]:
+                self.NumOfDynamicTx += 1
+
+
+def canif_cfg_h(CanIf, Source):
+    L = []
+    L.append("#ifndef CANIF_CFG_H")
+    L.append("#define CANIF_CFG_H")
+    L.append("")
+    L.append(GENERATED_NOTE.format(Source))
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t    \tInclude Headers\t\t\t\t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("#include \"Std_Types.h\"")
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t        Macros Definition       \t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    for Name, Doc in CANIF_SWITCHES:
+        if "\n" not in Doc:
+            L.append("/* " + Doc + " */")
+        else:
+            L.append("/* ")
+            L.extend("   " + Line for Line in Doc.split("\n"))
+            L.append("*/")
+        L.append(tab_pad("#define " + Name, 52) + std(CanIf.Switches[Name]))
+        L.append("")
+    L.append("/* Configured L-PDUs, hardware objects and controllers */")
+    L.append("#define TX_CAN_L_PDU_NUM\t\t\t\t\t({0}u)".format(len(CanIf.TxPdus)))
+    L.append("#define RX_CAN_L_PDU_NUM\t\t\t\t\t({0}u)".format(len(CanIf.RxPdus)))
+    L.append("#define CANIF_NUM_OF_HTHS\t\t\t\t\t({0}u)".format(len(CanIf.Hths)))
+    L.append("#define CANIF_NUM_OF_HRHS\t\t\t\t\t({0}u)".format(len(CanIf.Hrhs)))
+    L.append("#define CANIF_NUM_OF_CONTROLLERS\t\t\t({0}u)".format(len(CanIf.Controllers)))
+    L.append("")
+    L.append("/* Hardware objects of the CAN driver, size of the HOH to HRH table */")
+    L.append("#define CANIF_NUM_OF_HOHS\t\t\t\t\t({0}u)".format(CanIf.NumOfHoh))
+    L.append("")
+    L.append("/* Rx CAN ID table entries, longest run of one HRH (bounds the binary search) */")
+    L.append("#define CANIF_NUM_OF_RX_IDS\t\t\t\t\t({0}u)".format(len(CanIf.RxTable)))
+    L.append("#define CANIF_MAX_RX_IDS_PER_HRH\t\t\t({0}u)".format(max([H["RxIdCount"] for H in CanIf.Hrhs] + [0])))
+    L.append("")
+    L.append("/* Byte the L-SDUs shorter than the DLC of their Tx L-PDU are padded with */")
+    L.append("#define CANIF_TX_PADDING_VALUE\t\t\t\t({0}u)".format(hex8(CanIf.TxPadding)))
+    L.append("")
+    L.append("/* Longest Tx L-PDU, size of the padding buffer of CanIf_Transmit() */")
+    L.append("#define CANIF_TX_MAX_DLC\t\t\t\t\t({0}u)".format(CanIf.TxMaxDlc))
+    L.append("")
+    L.append("/* Tx L-PDUs of type CANIF_TXPDU_DYNAMIC, size of the RAM table of their current CAN IDs */")
+    L.append("#define CANIF_NUM_OF_DYNAMIC_TX_PDUS\t\t({0}u)".format(max(CanIf.NumOfDynamicTx, 1)))
+    L.append("")
+    L.append("/* Tx buffer entries of all HTHs, each HTH owns CanIfHthBufferSize entries from CanIfHthBufferOffset */")
+    L.append("#define CANIF_TX_BUFFER_SIZE\t\t\t\t({0}u)".format(max(CanIf.TxBufferSize, 1)))
+    L.append("")
+    if CanIf.Switches["CANIF_RX_DEFERRED_PROCESSING"]:
+        L.append("/* Frames queued between the receive interrupt and CanIf_MainFunctionRx(), shall be a power of two */")
+        L.append("#define CANIF_RX_QUEUE_SIZE\t\t\t\t\t({0}u)".format(CanIf.RxQueueSize))
+        L.append("")
+        L.append("/* Data bytes kept per queued frame, 64 if a controller runs CAN FD */")
+        L.append("#define CANIF_RX_QUEUE_DATA_SIZE\t\t\t({0}u)".format(CanIf.RxQueueDataSize))
+        L.append("")
+        L.append("/* Queued frames processed by one CanIf_MainFunctionRx() call */")
+        L.append("#define CANIF_RX_MAIN_FUNCTION_BUDGET\t\t({0}u)".format(CanIf.RxQueueBudget))
+        L.append("")
+    if CanIf.Switches["CANIF_RX_ISR_MEASUREMENT"]:
+        L.append("/* ")
+        L.append("   Free running up counter read at entry and exit of CanIf_RxIndication() (DWT_CYCCNT), the")
+        L.append("   integration code shall enable it (DEMCR.TRCENA and DWT_CTRL.CYCCNTENA) before CanIf_Init()")
+        L.append("*/")
+        L.append("#define CANIF_RX_ISR_TIMESTAMP_ADDRESS\t\t(0x{0:08X}u)".format(CanIf.IsrTimestampAddress))
+        L.append("")
+    if CanIf.Switches["CANIF_BUSOFF_RECOVERY"]:
+        L.append("/* Period of the CanIf_MainFunctionBusOff() calls, unit of the recovery times */")
+        L.append("#define CANIF_BUSOFF_MAIN_FUNCTION_PERIOD_MS\t({0}u)".format(CanIf.BusOffPeriod))
+        L.append("")
+    L.append("/* Bytes of each of the two Rx data banks, the sum of the lengths of the L-PDUs read by CanIf_ReadRxPduData() */")
+    L.append("#define CANIF_RX_DATA_BUFFER_SIZE\t\t\t({0}u)".format(max(CanIf.RxDataSize, 1)))
+    L.append("")
+    L.append("/* Symbolic names of the Tx L-PDUs, CanIfTxSduId */")
+    L.extend(aligned_defines([("CanIfConf_CanIfTxPduCfg_" + Pdu["Name"], "({0}u)".format(Pdu["Index"])) for Pdu in CanIf.TxPdus]))
+    L.append("")
+    L.append("/* Symbolic names of the Rx L-PDUs, CanIfRxSduId */")
+    L.extend(aligned_defines([("CanIfConf_CanIfRxPduCfg_" + Pdu["Name"], "({0}u)".format(Pdu["Index"])) for Pdu in CanIf.RxPdus]))
+    L.append("")
+    L.append("/* Symbolic names of the controllers */")
+    L.extend(aligned_defines([("CanIfConf_CanIfCtrlCfg_" + Ctrl["Name"], "({0}u)".format(Ctrl["Id"]))
+                              for Ctrl in sorted(CanIf.Controllers.values(), key=lambda C: C["Id"])]))
+    L.append("")
+    L.append("#endif /* CANIF_CFG_H */")
+    return "\n".join(L) + "\n"
+
+
+def canif_cfg_c(CanIf, Source):
+    L = []
+    L.append("")
+    L.append(GENERATED_NOTE.format(Source))
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t    \tInclude Headers\t\t\t\t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("#include \"CanIf.h\"")
+    for Header in CanIf.UlHeaders:
+        L.append("#include \"{0}\"".format(Header))
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t        Configuration Objects      \t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+
+    def raw_id_text(CanId):
+        if CanId & CAN_ID_EXTENDED:
+            return "(0x{0:08X}UL | CAN_ID_TYPE_EXTENDED)".format(CanId & ~CAN_ID_EXTENDED)
+        return "0x{0:03X}UL".format(CanId)
+
+    def can_id_text(Pdu):
+        return raw_id_text(CanIfModel.can_id(Pdu))
+
+    L.append("/* Tx L-PDUs in Tx PDU ID order, the current CAN ID of a dynamic L-PDU is kept in RAM by CanIf */")
+    L.append("const CanIfTxPduCfgType CanIfTxPduCfg[TX_CAN_L_PDU_NUM] =")
+    L.append("{")
+    L.append(struct_rows([(Pdu["Name"], [can_id_text(Pdu), str(Pdu["UlId"]), str(Pdu["Handle"]["Index"]),
+                                         str(Pdu["Handle"]["Hoh"]),
+                                         "CanIfConf_CanIfCtrlCfg_" + Pdu["Handle"]["Controller"]["Name"],
+                                         str(Pdu["Dlc"]), "TRUE" if Pdu["Truncation"] else "FALSE",
+                                         "CANIF_TXPDU_DYNAMIC" if Pdu["Dynamic"] else "CANIF_TXPDU_STATIC",
+                                         "TRUE" if Pdu["ReadNotifyStatus"] else "FALSE",
+                                         "CANIF_INVALID_DYNAMIC_ID" if Pdu["DynamicIndex"] is None else str(Pdu["DynamicIndex"]),
+                                         Pdu["TxConfirmation"] or "NULL_PTR"])
+                          for Pdu in CanIf.TxPdus]))
+    L.append("};")
+    L.append("")
+    L.append("/* Rx L-PDUs in Rx PDU ID order */")
+    L.append("const CanIfRxPduCfgType CanIfRxPduCfg[RX_CAN_L_PDU_NUM] =")
+    L.append("{")
+    L.append(struct_rows([(Pdu["Name"], [can_id_text(Pdu), str(Pdu["UlId"]), str(Pdu["Handle"]["Index"] if Pdu["Handle"] else 0),
+                                         str(Pdu["Dlc"]), "TRUE" if Pdu["ReadNotifyStatus"] else "FALSE",
+                                         "TRUE" if Pdu["ReadData"] else "FALSE", str(Pdu["DataOffset"]),
+                                         Pdu["RxIndication"] or "NULL_PTR"])
+                          for Pdu in CanIf.RxPdus]))
+    L.append("};")
+    L.append("")
+    L.append("/* ")
+    L.append("   Rx CAN ID table, the disjoint [Lower, Upper] entries of an HRH follow each other")
+    L.append("   sorted by CAN ID so a received frame is resolved to its L-PDU with a binary search")
+    L.append("*/")
+    L.append("const CanIfRxIdEntryType CanIfRxId[CANIF_NUM_OF_RX_IDS] =")
+    L.append("{")
+    Rows = []
+    for Hrh in CanIf.Hrhs:
+        for Position in range(Hrh["RxIdCount"]):
+            Lower, Upper, Pdu = CanIf.RxTable[Hrh["RxIdFirst"] + Position]
+            Rows.append("{0}\t{{ {1}, {2}, CanIfConf_CanIfRxPduCfg_{3} }}".format(
+                "\t/* " + Hrh["Name"] + " */\n" if Position == 0 else "", raw_id_text(Lower), raw_id_text(Upper),
+                Pdu["Name"]))
+    L.append(",\n".join(Rows))
+    L.append("};")
+    L.append("")
+    L.append("/* Hardware transmit handles */")
+    L.append("const CanIfHthCfgType CanIfHthCfg[CANIF_NUM_OF_HTHS] =")
+    L.append("{")
+    L.append(struct_rows([(Hth["Name"], [str(Hth["Hoh"]), "CanIfConf_CanIfCtrlCfg_" + Hth["Controller"]["Name"]
+                                         if Hth["Controller"] else "0",
+                                         str(Hth["BufferOffset"]), str(Hth["BufferSize"])]) for Hth in CanIf.Hths]))
+    L.append("};")
+    L.append("")
+    L.append("/* Hardware receive handles and their runs of the Rx CAN ID table */")
+    L.append("const CanIfHrhCfgType CanIfHrhCfg[CANIF_NUM_OF_HRHS] =")
+    L.append("{")
+    L.append(struct_rows([(Hrh["Name"], [str(Hrh["Hoh"]), "CanIfConf_CanIfCtrlCfg_" + Hrh["Controller"]["Name"]
+                                         if Hrh["Controller"] else "0", str(Hrh["RxIdFirst"]), str(Hrh["RxIdCount"])])
+                          for Hrh in CanIf.Hrhs]))
+    L.append("};")
+    L.append("")
+    HohToHrh = ["CANIF_INVALID_HRH"] * CanIf.NumOfHoh
+    for Hrh in CanIf.Hrhs:
+        HohToHrh[Hrh["Hoh"]] = "{0}u".format(Hrh["Index"])
+    L.append("/* HRH index of every hardware object of the CAN driver, resolves CanIf_RxIndication() in constant time */")
+    L.append("const uint16 CanIfHohToHrh[CANIF_NUM_OF_HOHS] =")
+    L.append("{")
+    L.append(",\n".join("\t/* {0} */\t{1}".format(Hoh, Entry) for Hoh, Entry in enumerate(HohToHrh)))
+    L.append("};")
+    L.append("")
+    L.append("/* CAN controllers in controller ID order */")
+    L.append("const CanIfCtrlCfgType CanIfCtrlCfg[CANIF_NUM_OF_CONTROLLERS] =")
+    L.append("{")
+    L.append(struct_rows([(Ctrl["Name"], ["CANIF_BUSOFF_RETAIN_TX_BUFFERS" if Ctrl["Retain"] else "CANIF_BUSOFF_FLUSH_TX_BUFFERS",
+                                          str(Ctrl["FastAttempts"]), str(Ctrl["FastTicks"]), str(Ctrl["SlowTicks"]),
+                                          Ctrl["BusOffNotification"] or "NULL_PTR", Ctrl["ModeIndication"] or "NULL_PTR"])
+                          for Ctrl in sorted(CanIf.Controllers.values(), key=lambda C: C["Id"])]))
+    L.append("};")
+    L.append("")
+    L.append("const CanIfInitCfgType CanIfInitCfg =")
+    L.append("{")
+    L.append("\tCanIfTxPduCfg,")
+    L.append("\tCanIfRxPduCfg,")
+    L.append("\tCanIfRxId,")
+    L.append("\tCanIfHthCfg,")
+    L.append("\tCanIfHrhCfg,")
+    L.append("\tCanIfHohToHrh,")
+    L.append("\tCanIfCtrlCfg")
+    L.append("};")
+    L.append("")
+    L.append("const CanIf_ConfigType CanIf_Config =")
+    L.append("{")
+    L.append("\t&CanIfInitCfg")
+    L.append("};")
+    return "\n".join(L) + "\n"
+
+
+##################################################################################
+#                                    Dcm                                         #
+##################################################################################
+
+DCM_SPEC = "AUTOSAR_SWS_DiagnosticCommunicationManager, AUTR 4.3.1"
+
+# Largest request / response of a single frame free ISO 15765-2 transfer
+DCM_MAX_BUFFER_SIZE = 4095
+
+
+class DcmModel(object):
+    """Dcm service table sorted by SID with its SID index table and the DSL buffer sizes."""
+
+    def __init__(self, Cfg, Err):
+        self.Cfg = Cfg
+        self.Err = Err
+        self.DevErrorDetect = Cfg.get("DevErrorDetect", False)
+        if not isinstance(self.DevErrorDetect, bool):
+            Err.add("Dcm.DevErrorDetect", "shall be true or false")
+
+        Sessions = Cfg.get("Sessions", [])
+        check_unique(Sessions, "Name", "Dcm.Sessions", Err)
+        check_unique(Sessions, "Id", "Dcm.Sessions", Err)
+        if not (1 <= len(Sessions) <= 8):
+            Err.add("Dcm.Sessions", "1..8 sessions are supported")
+        self.Sessions = []
+        for Index, Session in enumerate(Sessions):
+            Where = "Dcm.Sessions[{0}]".format(Index)
+            check_identifier(Session.get("Name"), Where + ".Name", Err)
+            Id = to_int(Session.get("Id"), Where + ".Id", Err)
+            if Id is not None and not (0x01 <= Id <= 0x7F):
+                Err.add(Where + ".Id", "session IDs are 0x01..0x7F")
+            self.Sessions.append({"Name": Session.get("Name"), "Id": Id or 0, "Mask": 1 << Index})
+        # Dcm_Dsp_Init() starts in the first session
+        if self.Sessions and self.Sessions[0]["Id"] != 0x01:
+            Err.add("Dcm.Sessions[0].Id", "the first session is the default session 0x01")
+        SessionMasks = dict((S["Name"], S["Mask"]) for S in self.Sessions)
+
+        Services = Cfg.get("Services", [])
+        self.Services = []
+        Seen = {}
+        for Index, Service in enumerate(Services):
+            Where = "Dcm.Services[{0}]".format(Index)
+            Sid = to_int(Service.get("Sid"), Where + ".Sid", Err)
+            if Sid is None:
+                continue
+            # Requests are 0x00..0x3E and 0x80..0xBE, 0x40.. and 0xC0.. are the positive responses, 0x7F the negative one
+            if not ((0x00 <= Sid <= 0x3E) or (0x80 <= Sid <= 0xBE)):
+                Err.add(Where + ".Sid", "{0} is not a request service ID".format(hex8(Sid)))
+            if Sid in Seen:
+                Err.add(Where + ".Sid", "{0} is already configured for {1}".format(hex8(Sid), Seen[Sid]))
+            Seen[Sid] = Service.get("Name")
+            check_identifier(Service.get("Name"), Where + ".Name", Err)
+            check_identifier(Service.get("Function"), Where + ".Function", Err)
+            Subfunc = bool(Service.get("Subfunction", False))
+            MinLength = to_int(Service.get("MinLength", 2 if Subfunc else 1), Where + ".MinLength", Err) or 0
+            MaxLength = to_int(Service.get("MaxLength", MinLength), Where + ".MaxLength", Err) or 0
+            MaxResponse = to_int(Service.get("MaxResponseLength", 1), Where + ".MaxResponseLength", Err) or 0
+            if MinLength < (2 if Subfunc else 1):
+                Err.add(Where + ".MinLength", "shorter than the service ID{0}".format(" and sub-function" if Subfunc else ""))
+            if MaxLength < MinLength:
+                Err.add(Where + ".MaxLength", "shorter than MinLength")
+            if MaxLength > DCM_MAX_BUFFER_SIZE:
+                Err.add(Where + ".MaxLength", "exceeds the {0} bytes of one transfer".format(DCM_MAX_BUFFER_SIZE))
+            if not (1 <= MaxResponse <= DCM_MAX_BUFFER_SIZE):
+                Err.add(Where + ".MaxResponseLength", "shall be 1..{0}".format(DCM_MAX_BUFFER_SIZE))
+            Mask = 0
+            for Name in Service.get("Sessions", []):
+                if Name not in SessionMasks:
+                    Err.add(Where + ".Sessions", "unknown session {0!r}".format(Name))
+                else:
+                    Mask |= SessionMasks[Name]
+            if Mask == 0:
+                Err.add(Where + ".Sessions", "the service is not allowed in any session")
+            Security = to_int(Service.get("SecurityLevels", "0x01"), Where + ".SecurityLevels", Err) or 0
+            if not (0 < Security <= 0xFF):
+                Err.add(Where + ".SecurityLevels", "shall be a non-empty 8-bit mask")
+            self.Services.append({"Name": Service.get("Name"), "Sid": Sid, "Subfunc": Subfunc,
+                                  "MinLength": MinLength, "MaxLength": MaxLength, "MaxResponse": MaxResponse,
+                                  "SessionMask": Mask, "SecurityMask": Security, "Function": Service.get("Function")})
+        if not self.Services:
+            Err.add("Dcm.Services", "at least one service is needed")
+        if len(self.Services) > 0xFE:
+            Err.add("Dcm.Services", "the SID index table holds at most 254 services")
+        self.Services.sort(key=lambda S: S["Sid"])
+        self.RxBufferSize = max([S["MaxLength"] for S in self.Services] + [1])
+        # Every request can be answered with a negative response (0x7F, SID, NRC)
+        self.TxBufferSize = max([S["MaxResponse"] for S in self.Services] + [3])
+
+
+def dcm_cfg_h(Dcm, Source):
+    L = []
+    L.append("#ifndef DCM_CFG_H")
+    L.append("#define DCM_CFG_H")
+    L.append("")
+    L.append(GENERATED_NOTE.format(Source))
+    L.append("")
+    L.append("/* Development error detection and notification */")
+    L.append("#define DCM_DEV_ERROR_DETECT\t\t\t\t{0}".format(std(Dcm.DevErrorDetect)))
+    L.append("")
+    L.append("/* Configured diagnostic services */")
+    L.append("#define DCM_NUM_OF_SERVICES\t\t\t\t\t({0}u)".format(len(Dcm.Services)))
+    L.append("")
+    L.append("/* Request and response buffers of the DSL, the longest configured request and response in bytes */")
+    L.append("#define DCM_DSL_RX_BUFFER_SIZE\t\t\t\t({0}u)".format(Dcm.RxBufferSize))
+    L.append("#define DCM_DSL_TX_BUFFER_SIZE\t\t\t\t({0}u)".format(Dcm.TxBufferSize))
+    L.append("")
+    L.append("/* Configured diagnostic sessions */")
+    L.append("#define DCM_NUM_OF_SESSIONS\t\t\t\t\t({0}u)".format(len(Dcm.Sessions)))
+    L.append("")
+    L.append("/* Diagnostic sessions, the session control value and its bit in DcmDsdSidTabSessionLevelRef */")
+    Pairs = []
+    for Session in Dcm.Sessions:
+        Pairs.append(("DCM_SESSION_" + Session["Name"], "(0x{0:02X}u)".format(Session["Id"])))
+        Pairs.append(("DCM_SESSION_MASK_" + Session["Name"], "(0x{0:02X}u)".format(Session["Mask"])))
+    L.extend(aligned_defines(Pairs))
+    L.append("")
+    L.append("/* Service IDs of the configured services */")
+    L.extend(aligned_defines([("DCM_SID_" + Service["Name"], "(0x{0:02X}u)".format(Service["Sid"])) for Service in Dcm.Services]))
+    L.append("")
+    L.append("#endif /* DCM_CFG_H */")
+    return "\n".join(L) + "\n"
+
+
+def dcm_lcfg_c(Dcm, Source):
+    L = []
+    L.append("")
+    L.append(GENERATED_NOTE.format(Source))
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t    \tInclude Headers\t\t\t\t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("#include \"Dcm_Lcfg.h\"")
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t        Functions Prototype        \t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("/* Processing functions of the configured services */")
+    for Function in sorted(set(S["Function"] for S in Dcm.Services)):
+        L.append("extern Std_ReturnType {0}(Dcm_ExtendedOpStatusType OpStatus, Dcm_MsgContextType* pMsgContext, "
+                 "Dcm_NegativeResponseCodeType* ErrorCode);".format(Function))
+    L.append("")
+    L.append("/*****************************************************************/")
+    L.append("/*\t\t\t\t        Configuration Objects      \t\t         */")
+    L.append("/*****************************************************************/")
+    L.append("")
+    L.append("/* Service table sorted by service ID */")
+    L.append("const Dcm_DsdServiceType DcmDsdService[DCM_NUM_OF_SERVICES] =")
+    L.append("{")
+    Rows = []
+    for Service in Dcm.Services:
+        Sessions = " | ".join("DCM_SESSION_MASK_" + S["Name"] for S in Dcm.Sessions if Service["SessionMask"] & S["Mask"])
+        Rows.append((Service["Name"], ["DCM_SID_" + Service["Name"], "TRUE" if Service["Subfunc"] else "FALSE",
+                                       "(" + Sessions + ")", "0x{0:02X}u".format(Service["SecurityMask"]),
+                                       "{0}u".format(Service["MinLength"]), "{0}u".format(Service["MaxLength"]),
+                                       Service["Function"]]))
+    L.append(struct_rows(Rows))
+    L.append("};")
+    L.append("")
+    Index = ["DCM_SID_NOT_SUPPORTED"] * 256
+    for Position, Service in enumerate(Dcm.Services):
+        Index[Service["Sid"]] = "{0}u".format(Position)
+    L.append("/* ")
+    L.append("   Index of every service ID in the service table, a request is dispatched ")
+    L.append("   to its service in constant time instead of searching the service table")
+    L.append("*/")
+    L.append("const uint8 DcmDsdSidIndex[DCM_NUM_OF_SIDS] =")
+    L.append("{")
+    L.append(",\n".join("\t/* 0x{0:02X} */\t{1}".format(Sid, Entry) for Sid, Entry in enumerate(Index)))
+    L.append("};")
+    L.append("")
+    L.append("/* Session control value of every session, entry n is the session of bit n of DcmDsdSidTabSessionLevelRef */")
+    L.append("const uint8 DcmDspSessionId[DCM_NUM_OF_SESSIONS] =")
+    L.append("{")
+    L.append(",\n".join("\tDCM_SESSION_" + Session["Name"] for Session in Dcm.Sessions))
+    L.append("};")
+    L.append("")
+    L.append("/* Request and response buffers of the DSL */")
+    L.append("uint8 DcmDslRxBuffer[DCM_DSL_RX_BUFFER_SIZE];")
+    L.append("uint8 DcmDslTxBuffer[DCM_DSL_TX_BUFFER_SIZE];")
+    return "\n".join(L) + "\n"
+
+
+##################################################################################
+#                                   Driver                                       #
+##################################################################################
+
+def generate(Config, Source):
+    """Validates the configuration and returns the generated files, path relative to the repository root."""
+    Err = Errors()
+    for Section in ("Dio", "CanIf", "Dcm"):
+        if Section not in Config:
+            Err.add(Section, "section is missing")
+    if len(Err):
+        raise ConfigError(Err.List)
+
+    Dio = DioModel(Config["Dio"], Err)
+    CanIf = CanIfModel(Config["CanIf"], Err)
+    Dcm = DcmModel(Config["Dcm"], Err)
+    if len(Err):
+        raise ConfigError(Err.List)
+
+    DioDir = "AUTOSAR/BSW/MCAL/DIO/gen"
+    CanIfDir = "AUTOSAR/BSW/ECUAL/CanIf/gen"
+    DcmDir = "AUTOSAR/Service/DCM/gen"
+    return [
+        (DioDir + "/Dio_Cfg.h",
+         banner("Dio_Cfg.h", "Digital I/O Driver coniguration file", DIO_SPEC, "2021-3-22") + dio_cfg_h(Dio, Source)),
+        (DioDir + "/Dio_Lcfg.c",
+         banner("Dio_Lcfg.c", "Digital I/O Driver link time configuration file", DIO_SPEC, "2021-3-22") + dio_lcfg_c(Dio, Source)),
+        (CanIfDir + "/CanIf_Cfg.h",
+         banner("CanIf_Cfg.h", "CanIf pre-compile configuration file", CANIF_SPEC, "2021-4-8") + canif_cfg_h(CanIf, Source)),
+        (CanIfDir + "/CanIf_Cfg.c",
+         banner("CanIf_Cfg.c", "CanIf link time configuration file", CANIF_SPEC, "2021-4-8") + canif_cfg_c(CanIf, Source)),
+        (DcmDir + "/Dcm_Cfg.h",
+         banner("Dcm_Cfg.h", "Dcm pre-compile configuration file", DCM_SPEC, "2021-5-16") + dcm_cfg_h(Dcm, Source)),
+        (DcmDir + "/Dcm_Lcfg.c",
+         banner("Dcm_Lcfg.c", "Dcm link time configuration file", DCM_SPEC, "2021-5-16") + dcm_lcfg_c(Dcm, Source)),
+    ]
+
+
+def main(Argv):
+    Parser = argparse.ArgumentParser(description="Generates the Dio, CanIf and Dcm configuration files.")
+    Parser.add_argument("config", nargs="?", default=DEFAULT_CONFIG, help="ECU description (default: Ecu.json)")
+    Parser.add_argument("--root", default=DEFAULT_ROOT, help="repository root the files are written to")
+    Parser.add_argument("--check", action="store_true", help="only report the files which are out of date")
+    Args = Parser.parse_args(Argv)
+
+    try:
+        with open(Args.config) as File:
+            Config = json.load(File)
+    except (IOError, ValueError) as Error:
+        sys.stderr.write("{0}: {1}\n".format(Args.config, Error))
+        return 1
+
+    try:
+        Files = generate(Config, os.path.basename(Args.config))
+    except ConfigError as Error:
+        for Line in Error.args[0]:
+            sys.stderr.write("{0}: error: {1}\n".format(Args.config, Line))
+        sys.stderr.write("{0} configuration error(s), nothing generated\n".format(len(Error.args[0])))
+        return 1
+
+    Stale = 0
+    for Path, Text in Files:
+        FullPath = os.path.join(Args.root, Path)
+        try:
+            with open(FullPath, newline="") as File:
+                Current = File.read()
+        except IOError:
+            Current = None
+        if Current == Text:
+            continue
+        Stale += 1
+        if Args.check:
+            sys.stdout.write("out of date: {0}\n".format(Path))
+        else:
+            if not os.path.isdir(os.path.dirname(FullPath)):
+                os.makedirs(os.path.dirname(FullPath))
+            with open(FullPath, "w", newline="") as File:
+                File.write(Text)
+            sys.stdout.write("generated: {0}\n".format(Path))
+
+    return 1 if (Args.check and Stale) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))